@@ -61,6 +61,7 @@
 #include <bmx/wave/WaveFileIO.h>
 #include <bmx/st436/ST436Element.h>
 #include <bmx/st436/RDD6Metadata.h>
+#include <bmx/frame/MMapFrame.h>
 #include <bmx/URI.h>
 #include <bmx/MXFHTTPFile.h>
 #include <bmx/MXFUtils.h>
@@ -395,6 +396,8 @@ static void usage(const char *cmd)
     if (mxf_http_is_supported()) {
         fprintf(stderr, " --http-min-read <bytes>\n");
         fprintf(stderr, "                          Set the minimum number of bytes to read when accessing a file over HTTP. The default is %u.\n", DEFAULT_HTTP_MIN_READ);
+        fprintf(stderr, " --http-parallel <count>\n");
+        fprintf(stderr, "                          Keep <count> concurrent byte range requests of --http-min-read bytes in flight ahead of the read position\n");
     }
     fprintf(stderr, "  --no-precharge          Don't output clip/track with precharge. Adjust the start position and duration instead\n");
     fprintf(stderr, "  --no-rollout            Don't output clip/track with rollout. Adjust the duration instead\n");
@@ -407,7 +410,14 @@ static void usage(const char *cmd)
     fprintf(stderr, "  --mmap-file             Use memory-mapped file I/O for the MXF files\n");
     fprintf(stderr, "                          Note: this may reduce file I/O performance and was found to be slower over network drives\n");
 #endif
+#else
+    fprintf(stderr, "  --mmap-file             Use memory-mapped file I/O for reading the input MXF files\n");
+    fprintf(stderr, "  --seq-scan              Set the sequential scan hint for the memory-mapped input files\n");
+    fprintf(stderr, "  --read-ahead            Read the input MXF files ahead of the current position in a separate I/O thread\n");
+    fprintf(stderr, "  --direct-io             Use direct I/O (O_DIRECT) for writing the output MXF files, bypassing the page cache\n");
+    fprintf(stderr, "  --write-behind          Coalesce writes to the output MXF files and write them in a separate I/O thread. Can't be used with --direct-io\n");
 #endif
+    fprintf(stderr, "  --read-cache            Cache recently read input MXF file pages, e.g. to avoid re-reading header metadata and index table segments\n");
     fprintf(stderr, "  --avcihead <format> <file> <offset>\n");
     fprintf(stderr, "                          Default AVC-Intra sequence header data (512 bytes) to use when the input file does not have it\n");
     fprintf(stderr, "                          <format> is a comma separated list of one or more of the following integer values:\n");
@@ -790,10 +800,17 @@ int main(int argc, const char** argv)
     uint16_t rdd6_lines[2] = {DEFAULT_RDD6_LINES[0], DEFAULT_RDD6_LINES[1]};
     uint8_t rdd6_sdid = DEFAULT_RDD6_SDID;
     uint32_t http_min_read = DEFAULT_HTTP_MIN_READ;
+    uint32_t http_parallel = 0;
     bool mp_track_num = false;
-#if defined(_WIN32) && !defined(__MINGW32__)
+#if !defined(__MINGW32__)
     bool use_mmap_file = false;
 #endif
+#if !defined(_WIN32)
+    bool use_direct_io = false;
+    bool use_read_ahead = false;
+    bool use_write_behind = false;
+#endif
+    bool use_read_cache = false;
     vector<EmbedXMLInfo> embed_xml;
     EmbedXMLInfo next_embed_xml;
     bool ignore_d10_aes3_flags = false;
@@ -1124,6 +1141,23 @@ int main(int argc, const char** argv)
             http_min_read = (uint32_t)(uvalue);
             cmdln_index++;
         }
+        else if (strcmp(argv[cmdln_index], "--http-parallel") == 0)
+        {
+            if (cmdln_index + 1 >= argc)
+            {
+                usage(argv[0]);
+                fprintf(stderr, "Missing argument for option '%s'\n", argv[cmdln_index]);
+                return 1;
+            }
+            if (sscanf(argv[cmdln_index + 1], "%u", &uvalue) != 1)
+            {
+                usage(argv[0]);
+                fprintf(stderr, "Invalid value '%s' for option '%s'\n", argv[cmdln_index + 1], argv[cmdln_index]);
+                return 1;
+            }
+            http_parallel = (uint32_t)(uvalue);
+            cmdln_index++;
+        }
         else if (strcmp(argv[cmdln_index], "--no-precharge") == 0)
         {
             no_precharge = true;
@@ -1165,7 +1199,32 @@ int main(int argc, const char** argv)
             use_mmap_file = true;
         }
 #endif
+#else
+        else if (strcmp(argv[cmdln_index], "--mmap-file") == 0)
+        {
+            use_mmap_file = true;
+        }
+        else if (strcmp(argv[cmdln_index], "--seq-scan") == 0)
+        {
+            input_file_flags |= MXF_MMAP_FLAG_SEQUENTIAL_SCAN;
+        }
+        else if (strcmp(argv[cmdln_index], "--read-ahead") == 0)
+        {
+            use_read_ahead = true;
+        }
+        else if (strcmp(argv[cmdln_index], "--direct-io") == 0)
+        {
+            use_direct_io = true;
+        }
+        else if (strcmp(argv[cmdln_index], "--write-behind") == 0)
+        {
+            use_write_behind = true;
+        }
 #endif
+        else if (strcmp(argv[cmdln_index], "--read-cache") == 0)
+        {
+            use_read_cache = true;
+        }
         else if (strcmp(argv[cmdln_index], "--avcihead") == 0)
         {
             if (cmdln_index + 3 >= argc)
@@ -2243,6 +2302,14 @@ int main(int argc, const char** argv)
         return 1;
     }
 
+#if !defined(_WIN32)
+    if (use_direct_io && use_write_behind) {
+        usage(argv[0]);
+        fprintf(stderr, "Options '--direct-io' and '--write-behind' can't be used together\n");
+        return 1;
+    }
+#endif
+
     if (clip_type != CW_AVID_CLIP_TYPE)
         allow_no_avci_head = false;
     if (clip_type != CW_AVID_CLIP_TYPE && clip_type != CW_OP1A_CLIP_TYPE)
@@ -2378,9 +2445,16 @@ int main(int argc, const char** argv)
         if (rw_interleave)
             file_factory.SetRWInterleave(rw_interleave_size);
         file_factory.SetHTTPMinReadSize(http_min_read);
-#if defined(_WIN32) && !defined(__MINGW32__)
+        file_factory.SetHTTPParallelRanges(http_parallel);
+        file_factory.SetUseReadCache(use_read_cache);
+#if !defined(__MINGW32__)
         file_factory.SetUseMMapFile(use_mmap_file);
 #endif
+#if !defined(_WIN32)
+        file_factory.SetUseDirectIO(use_direct_io);
+        file_factory.SetUseReadAhead(use_read_ahead);
+        file_factory.SetUseWriteBehind(use_write_behind);
+#endif
 
         if (use_group_reader && input_filenames.size() > 1) {
             MXFGroupReader *group_reader = new MXFGroupReader();
@@ -2665,6 +2739,14 @@ int main(int argc, const char** argv)
             throw false;
         }
 
+#if !defined(_WIN32)
+        // reference frame data in the memory-mapped input files rather than copying it
+        if (use_mmap_file) {
+            for (i = 0; i < reader->GetNumTrackReaders(); i++)
+                reader->GetTrackReader(i)->GetFrameBuffer()->SetFrameFactory(new MMapFrameFactory(), true);
+        }
+#endif
+
 
         // set read limits
 
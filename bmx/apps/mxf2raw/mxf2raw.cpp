@@ -56,6 +56,7 @@
 #include <bmx/essence_parser/SoundConversion.h>
 #include <bmx/st436/ST436Element.h>
 #include <bmx/st436/RDD6Metadata.h>
+#include <bmx/frame/MMapFrame.h>
 #include <bmx/MD5.h>
 #include <bmx/CRC32.h>
 #include <bmx/MXFHTTPFile.h>
@@ -1634,7 +1635,19 @@ static void usage(const char *cmd)
     fprintf(stderr, " --mmap-file           Use memory-mapped file I/O for the MXF files\n");
     fprintf(stderr, "                       Note: this may reduce file I/O performance and was found to be slower over network drives\n");
 #endif
+#else
+    fprintf(stderr, " --mmap-file           Use memory-mapped file I/O for reading the MXF files\n");
+    fprintf(stderr, " --no-seq-scan         Do not set the sequential scan hint for the memory-mapped files\n");
+    fprintf(stderr, " --read-ahead          Read ahead of the current position in a separate I/O thread\n");
 #endif
+    fprintf(stderr, " --read-cache          Cache recently read file pages, e.g. to avoid re-reading header metadata and index table segments\n");
+    fprintf(stderr, " --lazy-header         Decode header metadata sets only when they are first accessed\n");
+    fprintf(stderr, " --sidecar-cache       Load the partitions, header metadata and index table from a '.bmxcache' file next to the MXF file\n");
+    fprintf(stderr, "                       The cache file is (re-)written if it is missing or out of date\n");
+    fprintf(stderr, " --sidecar-cache-dir <dir>\n");
+    fprintf(stderr, "                       Same as --sidecar-cache, but the cache files are stored in <dir>\n");
+    fprintf(stderr, " --build-index         Build a missing index table by scanning the frame wrapped, intra-frame coded essence when opening a complete file\n");
+    fprintf(stderr, "                       The built index table is stored in the sidecar cache file if --sidecar-cache is used\n");
     fprintf(stderr, " --gf                  Support growing files. Retry reading a frame when it fails\n");
     fprintf(stderr, " --gf-retries <max>    Set the maximum times to retry reading a frame. The default is %u.\n", DEFAULT_GF_RETRIES);
     fprintf(stderr, " --gf-delay <sec>      Set the delay (in seconds) between a failure to read and a retry. The default is %f.\n", DEFAULT_GF_RETRY_DELAY);
@@ -1643,6 +1656,8 @@ static void usage(const char *cmd)
     if (mxf_http_is_supported()) {
         fprintf(stderr, " --http-min-read <bytes>\n");
         fprintf(stderr, "                       Set the minimum number of bytes to read when accessing a file over HTTP. The default is %u.\n", DEFAULT_HTTP_MIN_READ);
+        fprintf(stderr, " --http-parallel <count>\n");
+        fprintf(stderr, "                       Keep <count> concurrent byte range requests of --http-min-read bytes in flight ahead of the read position\n");
     }
     fprintf(stderr, "\n");
     fprintf(stderr, " --text-out <prefix>   Extract text based objects to files starting with <prefix>\n");
@@ -1704,7 +1719,7 @@ int main(int argc, const char** argv)
 #if defined(_WIN32)
     int file_flags = MXF_WIN32_FLAG_SEQUENTIAL_SCAN;
 #else
-    int file_flags = 0;
+    int file_flags = MXF_MMAP_FLAG_SEQUENTIAL_SCAN;
 #endif
     bool realtime = false;
     float rt_factor = 1.0;
@@ -1713,10 +1728,19 @@ int main(int argc, const char** argv)
     float gf_retry_delay = DEFAULT_GF_RETRY_DELAY;
     float gf_rate_after_fail = DEFAULT_GF_RATE_AFTER_FAIL;
     uint32_t http_min_read = DEFAULT_HTTP_MIN_READ;
+    uint32_t http_parallel = 0;
     ChecksumType checkum_type;
-#if defined(_WIN32) && !defined(__MINGW32__)
+#if !defined(__MINGW32__)
     bool use_mmap_file = false;
 #endif
+#if !defined(_WIN32)
+    bool use_read_ahead = false;
+#endif
+    bool use_read_cache = false;
+    bool lazy_header = false;
+    bool use_sidecar_cache = false;
+    const char *sidecar_cache_dir = "";
+    bool build_index = false;
     const char *text_output_prefix = 0;
     bool mca_detail = false;
     unsigned int uvalue;
@@ -2110,7 +2134,48 @@ int main(int argc, const char** argv)
             use_mmap_file = true;
         }
 #endif
+#else
+        else if (strcmp(argv[cmdln_index], "--mmap-file") == 0)
+        {
+            use_mmap_file = true;
+        }
+        else if (strcmp(argv[cmdln_index], "--no-seq-scan") == 0)
+        {
+            file_flags &= ~MXF_MMAP_FLAG_SEQUENTIAL_SCAN;
+        }
+        else if (strcmp(argv[cmdln_index], "--read-ahead") == 0)
+        {
+            use_read_ahead = true;
+        }
 #endif
+        else if (strcmp(argv[cmdln_index], "--read-cache") == 0)
+        {
+            use_read_cache = true;
+        }
+        else if (strcmp(argv[cmdln_index], "--lazy-header") == 0)
+        {
+            lazy_header = true;
+        }
+        else if (strcmp(argv[cmdln_index], "--sidecar-cache") == 0)
+        {
+            use_sidecar_cache = true;
+        }
+        else if (strcmp(argv[cmdln_index], "--sidecar-cache-dir") == 0)
+        {
+            if (cmdln_index + 1 >= argc)
+            {
+                usage(argv[0]);
+                fprintf(stderr, "Missing argument for option '%s'\n", argv[cmdln_index]);
+                return 1;
+            }
+            use_sidecar_cache = true;
+            sidecar_cache_dir = argv[cmdln_index + 1];
+            cmdln_index++;
+        }
+        else if (strcmp(argv[cmdln_index], "--build-index") == 0)
+        {
+            build_index = true;
+        }
         else if (strcmp(argv[cmdln_index], "--gf") == 0)
         {
             growing_file = true;
@@ -2194,6 +2259,23 @@ int main(int argc, const char** argv)
             http_min_read = (uint32_t)(uvalue);
             cmdln_index++;
         }
+        else if (strcmp(argv[cmdln_index], "--http-parallel") == 0)
+        {
+            if (cmdln_index + 1 >= argc)
+            {
+                usage(argv[0]);
+                fprintf(stderr, "Missing argument for option '%s'\n", argv[cmdln_index]);
+                return 1;
+            }
+            if (sscanf(argv[cmdln_index + 1], "%u", &uvalue) != 1)
+            {
+                usage(argv[0]);
+                fprintf(stderr, "Invalid value '%s' for option '%s'\n", argv[cmdln_index + 1], argv[cmdln_index]);
+                return 1;
+            }
+            http_parallel = (uint32_t)(uvalue);
+            cmdln_index++;
+        }
         else if (strcmp(argv[cmdln_index], "--regtest") == 0)
         {
             BMX_REGRESSION_TEST = true;
@@ -2354,9 +2436,14 @@ int main(int argc, const char** argv)
             file_factory.SetInputChecksumTypes(file_checksum_types);
         file_factory.SetInputFlags(file_flags);
         file_factory.SetHTTPMinReadSize(http_min_read);
-#if defined(_WIN32) && !defined(__MINGW32__)
+        file_factory.SetHTTPParallelRanges(http_parallel);
+        file_factory.SetUseReadCache(use_read_cache);
+#if !defined(__MINGW32__)
         file_factory.SetUseMMapFile(use_mmap_file);
 #endif
+#if !defined(_WIN32)
+        file_factory.SetUseReadAhead(use_read_ahead);
+#endif
 
         if (use_group_reader && input_filenames.size() > 1) {
             MXFGroupReader *group_reader = new MXFGroupReader();
@@ -2367,6 +2454,9 @@ int main(int argc, const char** argv)
                 grp_file_reader->SetFileFactory(&file_factory, false);
                 grp_file_reader->GetPackageResolver()->SetFileFactory(&file_factory, false);
                 grp_file_reader->SetST436ManifestFrameCount(st436_manifest_count);
+                grp_file_reader->SetLazyHeaderMetadata(lazy_header);
+                grp_file_reader->SetSidecarCache(use_sidecar_cache, sidecar_cache_dir);
+                grp_file_reader->SetBuildIndex(build_index);
                 result = grp_file_reader->Open(input_filenames[i]);
                 if (result != MXFFileReader::MXF_RESULT_SUCCESS) {
                     log_error("Failed to open MXF file '%s': %s\n", get_input_filename(input_filenames[i]),
@@ -2390,6 +2480,9 @@ int main(int argc, const char** argv)
                 seq_file_reader->SetFileFactory(&file_factory, false);
                 seq_file_reader->GetPackageResolver()->SetFileFactory(&file_factory, false);
                 seq_file_reader->SetST436ManifestFrameCount(st436_manifest_count);
+                seq_file_reader->SetLazyHeaderMetadata(lazy_header);
+                seq_file_reader->SetSidecarCache(use_sidecar_cache, sidecar_cache_dir);
+                seq_file_reader->SetBuildIndex(build_index);
                 result = seq_file_reader->Open(input_filenames[i]);
                 if (result != MXFFileReader::MXF_RESULT_SUCCESS) {
                     log_error("Failed to open MXF file '%s': %s\n", get_input_filename(input_filenames[i]),
@@ -2410,6 +2503,9 @@ int main(int argc, const char** argv)
             file_reader->SetFileFactory(&file_factory, false);
             file_reader->GetPackageResolver()->SetFileFactory(&file_factory, false);
             file_reader->SetST436ManifestFrameCount(st436_manifest_count);
+            file_reader->SetLazyHeaderMetadata(lazy_header);
+            file_reader->SetSidecarCache(use_sidecar_cache, sidecar_cache_dir);
+            file_reader->SetBuildIndex(build_index);
             if (do_as11_info)
                 as11_register_extensions(file_reader);
             if (do_as10_info)
@@ -2443,6 +2539,15 @@ int main(int argc, const char** argv)
 
         mxfRational edit_rate = reader->GetEditRate();
 
+#if !defined(_WIN32)
+        // reference frame data in the memory-mapped files rather than copying it
+        if (use_mmap_file) {
+            size_t i;
+            for (i = 0; i < reader->GetNumTrackReaders(); i++)
+                reader->GetTrackReader(i)->GetFrameBuffer()->SetFrameFactory(new MMapFrameFactory(), true);
+        }
+#endif
+
 
         // check ANC track is present if RDD-6 extraction requested
         bool have_anc_track = false;
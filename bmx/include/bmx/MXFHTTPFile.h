@@ -47,6 +47,9 @@ bool mxf_http_is_url(const std::string &url_str);
 
 MXFFile* mxf_http_file_open_read(const std::string &url_str, uint32_t min_read_size);
 
+// keeps num_ranges concurrent requests of range_size bytes in flight ahead of the read position
+MXFFile* mxf_http_file_open_read_parallel(const std::string &url_str, uint32_t range_size, uint32_t num_ranges);
+
 
 };
 
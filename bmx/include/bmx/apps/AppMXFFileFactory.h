@@ -41,12 +41,17 @@
 #include <bmx/URI.h>
 
 #include <mxf/mxf_rw_intl_file.h>
+#include <mxf/mxf_cache_file.h>
 
 #if defined(_WIN32)
 #include <mxf/mxf_win32_file.h>
 #if !defined(__MINGW32__)
 #include <mxf/mxf_win32_mmap.h>
 #endif
+#else
+#include <mxf/mxf_mmap_file.h>
+#include <mxf/mxf_readahead_file.h>
+#include <mxf/mxf_writebehind_file.h>
 #endif
 
 
@@ -66,9 +71,16 @@ public:
     void SetInputFlags(int flags);
     void SetRWInterleave(uint32_t rw_interleave_size);
     void SetHTTPMinReadSize(uint32_t size);
-#if defined(_WIN32) && !defined(__MINGW32__)
+    void SetHTTPParallelRanges(uint32_t num_ranges);
+    void SetUseReadCache(bool enable);
+#if !defined(__MINGW32__)
     void SetUseMMapFile(bool enable);
 #endif
+#if !defined(_WIN32)
+    void SetUseDirectIO(bool enable);
+    void SetUseReadAhead(bool enable);
+    void SetUseWriteBehind(bool enable);
+#endif
 
 public:
     virtual mxfpp::File* OpenNew(std::string filename);
@@ -105,9 +117,16 @@ private:
     std::vector<InputChecksumFile> mInputChecksumFiles;
     MXFRWInterleaver *mRWInterleaver;
     uint32_t mHTTPMinReadSize;
-#if defined(_WIN32) && !defined(__MINGW32__)
+    uint32_t mHTTPParallelRanges;
+    bool mUseReadCache;
+#if !defined(__MINGW32__)
     bool mUseMMapFile;
 #endif
+#if !defined(_WIN32)
+    bool mUseDirectIO;
+    bool mUseReadAhead;
+    bool mUseWriteBehind;
+#endif
 };
 
 
@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2017, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Author: Philip de Nier
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef BMX_MMAP_FRAME_H_
+#define BMX_MMAP_FRAME_H_
+
+
+#include <bmx/frame/Frame.h>
+
+#include <mxf/mxf_file.h>
+
+
+struct MXFMMapRegion;
+
+
+
+namespace bmx
+{
+
+
+class MMapFrame : public Frame
+{
+public:
+    MMapFrame();
+    MMapFrame(const MMapFrame &from);
+    virtual ~MMapFrame();
+
+    virtual uint32_t GetSize() const;
+    virtual const unsigned char* GetBytes() const;
+
+    virtual void Grow(uint32_t min_size);
+    virtual uint32_t GetSizeAvailable() const;
+    virtual unsigned char* GetBytesAvailable() const;
+    virtual void SetSize(uint32_t size);
+    virtual void IncrementSize(uint32_t inc);
+
+    virtual Frame* Clone();
+
+public:
+    bool ReadMapped(MXFFile *mxf_file, uint32_t size);
+
+    bool IsMapped() const { return mRegion != 0; }
+
+private:
+    void CopyMapped();
+
+private:
+    MXFMMapRegion *mRegion;
+    const unsigned char *mRegionBytes;
+    uint32_t mRegionSize;
+    ByteArray mData;
+};
+
+
+class MMapFrameFactory : public FrameFactory
+{
+public:
+    virtual ~MMapFrameFactory() {};
+
+    virtual Frame* CreateFrame();
+};
+
+
+};
+
+
+
+#endif
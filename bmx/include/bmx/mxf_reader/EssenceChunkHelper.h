@@ -75,6 +75,9 @@ public:
 
     size_t GetNumIndexedPartitions() const { return mNumIndexedPartitions; }
 
+    size_t GetNumChunks() const                      { return mEssenceChunks.size(); }
+    const EssenceChunk& GetChunk(size_t index) const { return mEssenceChunks[index]; }
+
 public:
     bool IsComplete() const { return mIsComplete; }
 
@@ -88,11 +91,14 @@ public:
 private:
     void EssenceOffsetUpdate(int64_t essence_offset);
     void FilePositionUpdate(int64_t file_position);
+    size_t FindChunk(const std::vector<int64_t> &chunk_starts, int64_t value) const;
 
 private:
     MXFFileReader *mFileReader;
     uint32_t mAvidFirstFrameOffset;
     std::vector<EssenceChunk> mEssenceChunks;
+    std::vector<int64_t> mChunkEssenceOffsets;  // sorted search keys, parallel to mEssenceChunks
+    std::vector<int64_t> mChunkFilePositions;
     size_t mLastEssenceChunk;
     size_t mNumIndexedPartitions;
     bool mIsComplete;
@@ -108,7 +108,12 @@ public:
 
     bool IsComplete() const;
 
+    bool HaveBuiltIndexTable() const                    { return mBuiltIndexTable; }
+    const IndexTableHelper* GetIndexTableHelper() const { return &mIndexTableHelper; }
+
 private:
+    void BuildIndexTable();
+
     uint32_t ReadClipWrappedSamples(uint32_t num_samples);
     uint32_t ReadFrameWrappedSamples(uint32_t num_samples);
 
@@ -147,6 +152,7 @@ private:
 
     EssenceChunkHelper mEssenceChunkHelper;
     IndexTableHelper mIndexTableHelper;
+    bool mBuiltIndexTable;
 
     FrameMetadataReader *mFrameMetadataReader;
 
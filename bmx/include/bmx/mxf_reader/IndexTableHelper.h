@@ -64,6 +64,10 @@ public:
                     int64_t *stream_offset);
 
 public:
+    void GetIndexEntryArrays(uint32_t num_entries, MXFIndexEntryArrays *arrays);
+
+    void WriteIndexTableSegment(mxfpp::File *file, uint32_t index_sid, uint32_t body_sid) const;
+
     bool CanAppendIndexEntry() const;
     void AppendIndexEntry(uint32_t num_entries, int8_t temporal_offset, int8_t key_frame_offset, uint8_t flags,
                           int64_t stream_offset);
@@ -85,7 +89,14 @@ public:
     void CopyIndexEntries(const IndexTableHelperSegment *segment, uint32_t duration);
 
 private:
-    unsigned char *mIndexEntries;
+    void AllocIndexEntries(uint32_t num_entries);
+
+private:
+    // index entry fields are stored in separate arrays
+    int64_t *mStreamOffsets;
+    int8_t *mTemporalOffsets;
+    int8_t *mKeyFrameOffsets;
+    uint8_t *mFlags;
     uint32_t mAllocIndexEntries;
     uint32_t mNumIndexEntries;
     uint32_t mEntriesStart;
@@ -138,12 +149,19 @@ public:
 
     bool GetIndexEntry(MXFIndexEntryExt *entry, int64_t position);
 
+    uint32_t GetNumSegments() const { return (uint32_t)mSegments.size(); }
+    void WriteIndexTableSegments(mxfpp::File *file, uint32_t index_sid, uint32_t body_sid) const;
+
 private:
+    int64_t ReadIndexTableSegment(mxfpp::File *file, uint64_t len);
+
     void InsertCBEIndexSegment(std::auto_ptr<IndexTableHelperSegment> &new_segment_ap);
     void InsertVBEIndexSegment(std::auto_ptr<IndexTableHelperSegment> &new_segment_ap);
 
     IndexTableHelperSegment* CreateStartSegment(IndexTableHelperSegment *segment, uint32_t duration);
 
+    size_t FindSegment(int64_t position);
+
 private:
     MXFFileReader *mFileReader;
     mxfpp::File *mFile;
@@ -152,6 +170,8 @@ private:
 
     std::vector<IndexTableHelperSegment*> mSegments;
     size_t mLastEditUnitSegment;
+    std::vector<int64_t> mSegmentStarts;
+    bool mSegmentStartsValid;
 
     uint32_t mEditUnitSize;
 
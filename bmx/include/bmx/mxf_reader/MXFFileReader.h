@@ -53,6 +53,8 @@ namespace bmx
 {
 
 
+class MXFSidecarCache;
+
 
 class MXFFileReader : public MXFReader
 {
@@ -91,6 +93,9 @@ public:
     void SetFileFactory(MXFFileFactory *factory, bool take_ownership);
     virtual void SetEmptyFrames(bool enable);
     void SetST436ManifestFrameCount(uint32_t count);     // default: 2 frames used to extract manifest
+    void SetLazyHeaderMetadata(bool enable);             // default false: decode all header metadata sets on read
+    void SetSidecarCache(bool enable, std::string cache_dir = "");  // default false; empty dir: next to the file
+    void SetBuildIndex(bool enable);                     // default false: don't scan the essence to build a missing index
     virtual void SetFileIndex(MXFFileIndex *file_index, bool take_ownership);
     virtual void SetMCALabelIndex(MXFMCALabelIndex *label_index, bool take_ownership);
 
@@ -258,6 +263,11 @@ private:
     uint32_t mRequireFrameInfoCount;
     uint32_t mST436ManifestCount;
 
+    bool mUseSidecarCache;
+    std::string mSidecarCacheDir;
+    MXFSidecarCache *mSidecarCache;
+    bool mBuildIndex;
+
     std::set<mxfpp::SourcePackage*> mMCALabelIndexedPackages;
 };
 
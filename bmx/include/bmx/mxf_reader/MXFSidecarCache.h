@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2017, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Author: Philip de Nier
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef BMX_MXF_SIDECAR_CACHE_H_
+#define BMX_MXF_SIDECAR_CACHE_H_
+
+#include <string>
+#include <vector>
+
+#include <libMXF++/MXF.h>
+
+
+
+namespace bmx
+{
+
+
+class IndexTableHelper;
+
+
+// A sidecar cache file holds a snapshot of the partition packs, header metadata and index table segments
+// of a complete MXF file. The index table segments are either copied from the file or were built by scanning
+// the essence. The snapshot is valid for as long as the MXF file size, modification time and the digest of
+// the start and end of the file are unchanged.
+class MXFSidecarCache
+{
+public:
+    static std::string GetDefaultFilename(const std::string &mxf_filename, const std::string &cache_dir);
+
+public:
+    MXFSidecarCache(const std::string &filename);
+    ~MXFSidecarCache();
+
+    // the MXF file's header partition must have been read
+    bool Load(mxfpp::File *mxf_file, const std::string &mxf_filename);
+    bool IsLoaded() const { return mCacheFile != 0; }
+
+    mxfpp::File* SeekHeaderMetadata();
+    mxfpp::File* SeekIndexTableSegments(uint32_t *count);
+
+    void AddIndexTableSegment(int64_t position, uint64_t size);
+    void SetBuiltIndexTable(const IndexTableHelper *index_table, uint32_t index_sid, uint32_t body_sid);
+    void Save(mxfpp::File *mxf_file, const mxfpp::Partition *metadata_partition);
+
+private:
+    bool ReadIdentity(mxfpp::File *mxf_file, const std::string &mxf_filename);
+    bool ReadSnapshot(mxfpp::File *mxf_file);
+    void WriteSnapshot(mxfpp::File *cache_file, mxfpp::File *mxf_file, const mxfpp::Partition *metadata_partition);
+    void CopyBytes(mxfpp::File *cache_file, mxfpp::File *mxf_file, int64_t position, uint64_t size);
+
+private:
+    std::string mFilename;
+    mxfpp::File *mCacheFile;
+
+    bool mHaveIdentity;
+    int64_t mFileSize;
+    int64_t mFileModTime;
+    unsigned char mFileDigest[16];
+
+    int64_t mHeaderMetadataOffset;
+    int64_t mIndexTableOffset;
+    uint32_t mIndexTableSegmentCount;
+
+    std::vector<std::pair<int64_t, uint64_t> > mIndexTableSegments;
+    const IndexTableHelper *mBuiltIndexTable;
+    uint32_t mBuiltIndexSID;
+    uint32_t mBuiltBodySID;
+};
+
+
+};
+
+
+
+#endif
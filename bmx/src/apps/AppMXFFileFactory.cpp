@@ -54,9 +54,16 @@ AppMXFFileFactory::AppMXFFileFactory()
     mInputFlags = 0;
     mRWInterleaver = 0;
     mHTTPMinReadSize = 64 * 1024;
-#if defined(_WIN32) && !defined(__MINGW32__)
+    mHTTPParallelRanges = 0;
+    mUseReadCache = false;
+#if !defined(__MINGW32__)
     mUseMMapFile = false;
 #endif
+#if !defined(_WIN32)
+    mUseDirectIO = false;
+    mUseReadAhead = false;
+    mUseWriteBehind = false;
+#endif
 }
 
 AppMXFFileFactory::~AppMXFFileFactory()
@@ -98,13 +105,40 @@ void AppMXFFileFactory::SetHTTPMinReadSize(uint32_t size)
     mHTTPMinReadSize = size;
 }
 
-#if defined(_WIN32) && !defined(__MINGW32__)
+void AppMXFFileFactory::SetHTTPParallelRanges(uint32_t num_ranges)
+{
+    mHTTPParallelRanges = num_ranges;
+}
+
+void AppMXFFileFactory::SetUseReadCache(bool enable)
+{
+    mUseReadCache = enable;
+}
+
+#if !defined(__MINGW32__)
 void AppMXFFileFactory::SetUseMMapFile(bool enable)
 {
     mUseMMapFile = enable;
 }
 #endif
 
+#if !defined(_WIN32)
+void AppMXFFileFactory::SetUseDirectIO(bool enable)
+{
+    mUseDirectIO = enable;
+}
+
+void AppMXFFileFactory::SetUseReadAhead(bool enable)
+{
+    mUseReadAhead = enable;
+}
+
+void AppMXFFileFactory::SetUseWriteBehind(bool enable)
+{
+    mUseWriteBehind = enable;
+}
+#endif
+
 File* AppMXFFileFactory::OpenNew(string filename)
 {
     MXFFile *mxf_file = 0;
@@ -122,7 +156,15 @@ File* AppMXFFileFactory::OpenNew(string filename)
 #endif
             BMX_CHECK(mxf_win32_file_open_new(filename.c_str(), 0, &mxf_file));
 #else
-        BMX_CHECK(mxf_disk_file_open_new(filename.c_str(), &mxf_file));
+        if (mUseDirectIO && mUseWriteBehind)
+            BMX_EXCEPTION(("Direct I/O and write-behind can't be used together for writing new files"));
+
+        if (mUseDirectIO)
+            BMX_CHECK(mxf_disk_file_open_new_direct(filename.c_str(), &mxf_file));
+        else if (mUseWriteBehind)
+            BMX_CHECK(mxf_writebehind_file_open_new(filename.c_str(), 0, 0, &mxf_file));
+        else
+            BMX_CHECK(mxf_disk_file_open_new(filename.c_str(), &mxf_file));
 #endif
 
         if (mRWInterleaver) {
@@ -152,7 +194,10 @@ File* AppMXFFileFactory::OpenRead(string filename)
             uri_str = "stdin:";
         } else {
             if (mxf_http_is_url(filename)) {
-                mxf_file = mxf_http_file_open_read(filename, mHTTPMinReadSize);
+                if (mHTTPParallelRanges > 0)
+                    mxf_file = mxf_http_file_open_read_parallel(filename, mHTTPMinReadSize, mHTTPParallelRanges);
+                else
+                    mxf_file = mxf_http_file_open_read(filename, mHTTPMinReadSize);
                 uri_str = filename;
             } else {
 #if defined(_WIN32)
@@ -163,9 +208,24 @@ File* AppMXFFileFactory::OpenRead(string filename)
 #endif
                     BMX_CHECK(mxf_win32_file_open_read(filename.c_str(), mInputFlags, &mxf_file));
 #else
-                BMX_CHECK(mxf_disk_file_open_read(filename.c_str(), &mxf_file));
+                if (mUseMMapFile) {
+                    BMX_CHECK(mxf_mmap_file_open_read(filename.c_str(), mInputFlags, 0, &mxf_file));
+                } else {
+                    BMX_CHECK(mxf_disk_file_open_read(filename.c_str(), &mxf_file));
+                    if (mUseReadAhead) {
+                        MXFFile *readahead_mxf_file;
+                        BMX_CHECK(mxf_readahead_file_wrap(mxf_file, 0, 0, &readahead_mxf_file));
+                        mxf_file = readahead_mxf_file;
+                    }
+                }
 #endif
             }
+
+            if (mUseReadCache) {
+                MXFCacheFile *cache_file;
+                BMX_CHECK(mxf_cache_file_open_read(mxf_file, 0, 0, 4, &cache_file));
+                mxf_file = mxf_cache_file_get_file(cache_file);
+            }
         }
 
         if (!mInputChecksumTypes.empty()) {
@@ -37,6 +37,10 @@
 #include <cstdio>
 #include <cstdlib>
 
+#if !defined(_WIN32)
+#include <pthread.h>
+#endif
+
 #include <mxf/mxf.h>
 
 #include <bmx/MXFChecksumFile.h>
@@ -48,11 +52,21 @@ using namespace std;
 using namespace bmx;
 
 
+#define CHECKSUM_BUFFER_SIZE    (1024 * 1024)
+#define NUM_CHECKSUM_BUFFERS    8
+
+
 struct bmx::MXFChecksumFile
 {
     MXFFile *mxf_file;
 };
 
+typedef struct
+{
+    unsigned char *data;
+    uint32_t size;
+} ChecksumBuffer;
+
 struct MXFFileSysData
 {
     MXFChecksumFile checksum_file;
@@ -62,9 +76,111 @@ struct MXFFileSysData
     int64_t checksum_position;
     bool force_update;
     bool checksum_final;
+
+#if !defined(_WIN32)
+    // the checksum is updated in a separate thread using data copied into a ring of buffers.
+    // The buffer following the queued buffers is filled by the reader or writer
+    pthread_t thread;
+    bool thread_started;
+    bool sync_init;
+    pthread_mutex_t mutex;          // protects the queue state below
+    pthread_cond_t queue_cond;      // signals the checksum thread that buffers are queued or it must stop
+    pthread_cond_t space_cond;      // signals the reader or writer that queued buffers have been processed
+    ChecksumBuffer buffers[NUM_CHECKSUM_BUFFERS];
+    uint32_t queue_first;
+    uint32_t queue_count;
+    bool stop;
+#endif
 };
 
 
+#if !defined(_WIN32)
+
+static void* checksum_thread(void *arg)
+{
+    MXFFileSysData *sys_data = (MXFFileSysData*)arg;
+
+    pthread_mutex_lock(&sys_data->mutex);
+    while (true) {
+        while (sys_data->queue_count == 0 && !sys_data->stop)
+            pthread_cond_wait(&sys_data->queue_cond, &sys_data->mutex);
+        if (sys_data->queue_count == 0)
+            break;
+
+        ChecksumBuffer *buffer = &sys_data->buffers[sys_data->queue_first];
+        pthread_mutex_unlock(&sys_data->mutex);
+
+        sys_data->checksum->Update(buffer->data, buffer->size);
+
+        pthread_mutex_lock(&sys_data->mutex);
+        buffer->size = 0;
+        sys_data->queue_first = (sys_data->queue_first + 1) % NUM_CHECKSUM_BUFFERS;
+        sys_data->queue_count--;
+        pthread_cond_signal(&sys_data->space_cond);
+    }
+    pthread_mutex_unlock(&sys_data->mutex);
+
+    return 0;
+}
+
+static ChecksumBuffer* get_fill_buffer(MXFFileSysData *sys_data)
+{
+    pthread_mutex_lock(&sys_data->mutex);
+    while (sys_data->queue_count == NUM_CHECKSUM_BUFFERS)
+        pthread_cond_wait(&sys_data->space_cond, &sys_data->mutex);
+    ChecksumBuffer *buffer = &sys_data->buffers[(sys_data->queue_first + sys_data->queue_count) % NUM_CHECKSUM_BUFFERS];
+    pthread_mutex_unlock(&sys_data->mutex);
+
+    return buffer;
+}
+
+static void queue_fill_buffer(MXFFileSysData *sys_data)
+{
+    pthread_mutex_lock(&sys_data->mutex);
+    sys_data->queue_count++;
+    pthread_cond_signal(&sys_data->queue_cond);
+    pthread_mutex_unlock(&sys_data->mutex);
+}
+
+static void copy_to_checksum_buffers(MXFFileSysData *sys_data, const uint8_t *data, uint64_t count)
+{
+    uint64_t rem_count = count;
+    while (rem_count > 0) {
+        ChecksumBuffer *buffer = get_fill_buffer(sys_data);
+        uint32_t copy_count = CHECKSUM_BUFFER_SIZE - buffer->size;
+        if (copy_count > rem_count)
+            copy_count = (uint32_t)rem_count;
+        memcpy(&buffer->data[buffer->size], &data[count - rem_count], copy_count);
+        buffer->size += copy_count;
+        rem_count -= copy_count;
+
+        if (buffer->size == CHECKSUM_BUFFER_SIZE)
+            queue_fill_buffer(sys_data);
+    }
+}
+
+static void stop_checksum_thread(MXFFileSysData *sys_data)
+{
+    if (!sys_data->thread_started)
+        return;
+
+    // queue the partially filled buffer and wait for the thread to process all queued buffers before stopping
+    ChecksumBuffer *buffer = get_fill_buffer(sys_data);
+    if (buffer->size > 0)
+        queue_fill_buffer(sys_data);
+
+    pthread_mutex_lock(&sys_data->mutex);
+    sys_data->stop = true;
+    pthread_cond_signal(&sys_data->queue_cond);
+    pthread_mutex_unlock(&sys_data->mutex);
+
+    pthread_join(sys_data->thread, 0);
+    sys_data->thread_started = false;
+}
+
+#endif
+
+
 static bool update_checksum_to_position(MXFChecksumFile *checksum_file, int64_t position)
 {
     MXFFile *mxf_file = checksum_file->mxf_file;
@@ -135,11 +251,30 @@ static void update_checksum_to_nonseekable_end(MXFChecksumFile *checksum_file)
 
 static void checksum_file_close(MXFFileSysData *sys_data)
 {
+#if !defined(_WIN32)
+    stop_checksum_thread(sys_data);
+#endif
+
     if (sys_data->target)
         mxf_file_close(&sys_data->target);
 }
 
-static uint32_t checksum_file_read(MXFFileSysData *sys_data, uint8_t *data, uint32_t count)
+static void update_checksum(MXFFileSysData *sys_data, const uint8_t *data, uint64_t count)
+{
+#if defined(_WIN32)
+    uint64_t rem_count = count;
+    while (rem_count > 0) {
+        uint32_t update_count = (rem_count > UINT32_MAX ? UINT32_MAX : (uint32_t)rem_count);
+        sys_data->checksum->Update(&data[count - rem_count], update_count);
+        rem_count -= update_count;
+    }
+#else
+    copy_to_checksum_buffers(sys_data, data, count);
+#endif
+    sys_data->checksum_position += count;
+}
+
+static uint64_t checksum_file_read_64(MXFFileSysData *sys_data, uint8_t *data, uint64_t count)
 {
     if (sys_data->force_update &&
         !update_checksum_to_position(&sys_data->checksum_file, sys_data->position))
@@ -147,17 +282,15 @@ static uint32_t checksum_file_read(MXFFileSysData *sys_data, uint8_t *data, uint
         return 0;
     }
 
-    uint32_t result = mxf_file_read(sys_data->target, data, count);
+    uint64_t result = mxf_file_read_64(sys_data->target, data, count);
 
     if (result > 0) {
         if (!sys_data->checksum_final &&
-            sys_data->position          <= sys_data->checksum_position &&
-            sys_data->position + result >  sys_data->checksum_position)
+            sys_data->position                    <= sys_data->checksum_position &&
+            sys_data->position + (int64_t)result  >  sys_data->checksum_position)
         {
-            uint32_t checksum_count = (uint32_t)(sys_data->position + result - sys_data->checksum_position);
-            sys_data->checksum->Update(&data[(uint32_t)(sys_data->checksum_position - sys_data->position)],
-                                       checksum_count);
-            sys_data->checksum_position += checksum_count;
+            update_checksum(sys_data, &data[sys_data->checksum_position - sys_data->position],
+                            sys_data->position + result - sys_data->checksum_position);
         }
         sys_data->position += result;
     }
@@ -165,25 +298,33 @@ static uint32_t checksum_file_read(MXFFileSysData *sys_data, uint8_t *data, uint
     return result;
 }
 
-static uint32_t checksum_file_write(MXFFileSysData *sys_data, const uint8_t *data, uint32_t count)
+static uint64_t checksum_file_write_64(MXFFileSysData *sys_data, const uint8_t *data, uint64_t count)
 {
     BMX_CHECK_M(sys_data->position == sys_data->checksum_position,
                 ("File modification not supported when using the MXF checksum file"));
 
-    uint32_t result = mxf_file_write(sys_data->target, data, count);
+    uint64_t result = mxf_file_write_64(sys_data->target, data, count);
 
     if (result > 0) {
         // sys_data->position == sys_data->checksum_position
-        if (!sys_data->checksum_final) {
-            sys_data->checksum->Update(data, result);
-            sys_data->checksum_position += result;
-        }
+        if (!sys_data->checksum_final)
+            update_checksum(sys_data, data, result);
         sys_data->position += result;
     }
 
     return result;
 }
 
+static uint32_t checksum_file_read(MXFFileSysData *sys_data, uint8_t *data, uint32_t count)
+{
+    return (uint32_t)checksum_file_read_64(sys_data, data, count);
+}
+
+static uint32_t checksum_file_write(MXFFileSysData *sys_data, const uint8_t *data, uint32_t count)
+{
+    return (uint32_t)checksum_file_write_64(sys_data, data, count);
+}
+
 static int checksum_file_getc(MXFFileSysData *sys_data)
 {
     if (sys_data->force_update &&
@@ -197,8 +338,7 @@ static int checksum_file_getc(MXFFileSysData *sys_data)
     if (result != EOF) {
         if (!sys_data->checksum_final && sys_data->position == sys_data->checksum_position) {
             unsigned char byte = (unsigned char)result;
-            sys_data->checksum->Update(&byte, 1);
-            sys_data->checksum_position++;
+            update_checksum(sys_data, &byte, 1);
         }
         sys_data->position++;
     }
@@ -217,8 +357,7 @@ static int checksum_file_putc(MXFFileSysData *sys_data, int c)
         // sys_data->position == sys_data->checksum_position
         if (!sys_data->checksum_final) {
             unsigned char byte = (unsigned char)c;
-            sys_data->checksum->Update(&byte, 1);
-            sys_data->checksum_position++;
+            update_checksum(sys_data, &byte, 1);
         }
         sys_data->position++;
     }
@@ -294,6 +433,17 @@ static int64_t checksum_file_size(MXFFileSysData *sys_data)
 static void free_checksum_file(MXFFileSysData *sys_data)
 {
     if (sys_data) {
+#if !defined(_WIN32)
+        stop_checksum_thread(sys_data);
+        if (sys_data->sync_init) {
+            pthread_cond_destroy(&sys_data->space_cond);
+            pthread_cond_destroy(&sys_data->queue_cond);
+            pthread_mutex_destroy(&sys_data->mutex);
+        }
+        size_t i;
+        for (i = 0; i < NUM_CHECKSUM_BUFFERS; i++)
+            delete [] sys_data->buffers[i].data;
+#endif
         delete sys_data->checksum;
         free(sys_data);
     }
@@ -320,6 +470,20 @@ MXFChecksumFile* bmx::mxf_checksum_file_open(MXFFile *target, ChecksumType type)
 
         checksum_file->sysData->checksum_file.mxf_file = checksum_file;
 
+#if !defined(_WIN32)
+        size_t i;
+        for (i = 0; i < NUM_CHECKSUM_BUFFERS; i++)
+            checksum_file->sysData->buffers[i].data = new unsigned char[CHECKSUM_BUFFER_SIZE];
+
+        pthread_mutex_init(&checksum_file->sysData->mutex, 0);
+        pthread_cond_init(&checksum_file->sysData->queue_cond, 0);
+        pthread_cond_init(&checksum_file->sysData->space_cond, 0);
+        checksum_file->sysData->sync_init = true;
+
+        BMX_CHECK(pthread_create(&checksum_file->sysData->thread, 0, checksum_thread, checksum_file->sysData) == 0);
+        checksum_file->sysData->thread_started = true;
+#endif
+
         checksum_file->close         = checksum_file_close;
         checksum_file->read          = checksum_file_read;
         checksum_file->write         = checksum_file_write;
@@ -330,6 +494,8 @@ MXFChecksumFile* bmx::mxf_checksum_file_open(MXFFile *target, ChecksumType type)
         checksum_file->tell          = checksum_file_tell;
         checksum_file->is_seekable   = checksum_file_is_seekable;
         checksum_file->size          = checksum_file_size;
+        checksum_file->read_64       = checksum_file_read_64;
+        checksum_file->write_64      = checksum_file_write_64;
         checksum_file->free_sys_data = free_checksum_file;
 
         checksum_file->minLLen       = target->minLLen;
@@ -377,6 +543,10 @@ bool bmx::mxf_checksum_file_final(MXFChecksumFile *checksum_file)
         update_checksum_to_nonseekable_end(checksum_file);
     }
 
+#if !defined(_WIN32)
+    stop_checksum_thread(sys_data);
+#endif
+
     sys_data->checksum->Final();
     sys_data->checksum_final = true;
 
@@ -41,6 +41,9 @@
 #include <stdlib.h>
 #include <stdio.h>
 
+#include <deque>
+#include <vector>
+
 #include <curl/curl.h>
 
 #include <mxf/mxf.h>
@@ -59,6 +62,19 @@ typedef struct
     MXFFile *mxf_file;
 } MXFHTTPFile;
 
+typedef struct
+{
+    CURL *curl;
+    int64_t range_first;
+    uint32_t range_size;
+    unsigned char *data;
+    uint32_t data_size;
+    bool in_multi;
+    bool done;
+    CURLcode result;
+    char error_buf[CURL_ERROR_SIZE];
+} RangeRequest;
+
 struct MXFFileSysData
 {
     MXFHTTPFile http_file;
@@ -71,6 +87,15 @@ struct MXFFileSysData
     uint32_t buffer_size;
     uint32_t buffer_alloc_size;
     bool disable_response_code_warn;
+
+    // parallel range requests mode: a window of requests in file order is kept in flight ahead of the position
+    CURLM *multi;
+    uint32_t range_size;
+    uint32_t num_ranges;
+    int64_t file_size;
+    deque<RangeRequest*> window;
+    vector<RangeRequest*> free_requests;
+    int64_t next_range_first;
 };
 
 typedef struct
@@ -79,8 +104,8 @@ typedef struct
     int64_t range_first;
     int64_t range_last;
     uint8_t *client_data;
-    uint32_t client_rem_count;
-    uint32_t read_count;
+    uint64_t client_rem_count;
+    uint64_t read_count;
     bool accept_range_recv;
     bool accept_bytes_range;
 } CURLReceiveInfo;
@@ -146,11 +171,12 @@ static size_t curl_data_cb(void* ptr, size_t size, size_t nmemb, void *priv)
 
   size_t rec_count = size * nmemb;
 
-  uint32_t client_copy_count = 0;
+  size_t client_copy_count = 0;
   if (info->client_rem_count > 0) {
-      client_copy_count = info->client_rem_count;
-      if (client_copy_count > rec_count)
-          client_copy_count = (uint32_t)(rec_count);
+      if (info->client_rem_count > rec_count)
+          client_copy_count = rec_count;
+      else
+          client_copy_count = (size_t)info->client_rem_count;
       memcpy(&info->client_data[info->read_count], ptr, client_copy_count);
       info->client_rem_count   -= client_copy_count;
       info->sys_data->position += client_copy_count;
@@ -167,21 +193,207 @@ static size_t curl_data_cb(void* ptr, size_t size, size_t nmemb, void *priv)
       info->read_count            += buf_copy_count;
   }
 
-  return (size_t)client_copy_count + (size_t)buf_copy_count;
+  return client_copy_count + (size_t)buf_copy_count;
+}
+
+
+static size_t curl_range_data_cb(void* ptr, size_t size, size_t nmemb, void *priv)
+{
+  RangeRequest *request = (RangeRequest*)priv;
+
+  size_t rec_count = size * nmemb;
+
+  // returning less than rec_count results in a CURLE_WRITE_ERROR, e.g. if the server ignored the range
+  size_t copy_count = request->range_size - request->data_size;
+  if (copy_count > rec_count)
+      copy_count = rec_count;
+  memcpy(&request->data[request->data_size], ptr, copy_count);
+  request->data_size += (uint32_t)copy_count;
+
+  return copy_count;
+}
+
+static void release_range_request(MXFFileSysData *sys_data, RangeRequest *request)
+{
+    if (request->in_multi) {
+        // removing an unfinished transfer from the multi handle aborts it
+        curl_multi_remove_handle(sys_data->multi, request->curl);
+        request->in_multi = false;
+    }
+    sys_data->free_requests.push_back(request);
+}
+
+static void cancel_range_requests(MXFFileSysData *sys_data)
+{
+    size_t i;
+    for (i = 0; i < sys_data->window.size(); i++)
+        release_range_request(sys_data, sys_data->window[i]);
+    sys_data->window.clear();
+}
+
+static void start_range_request(MXFFileSysData *sys_data)
+{
+    RangeRequest *request;
+    if (sys_data->free_requests.empty()) {
+        request = new RangeRequest;
+        memset(request, 0, sizeof(*request));
+        request->curl = curl_easy_init();
+        if (!request->curl) {
+            delete request;
+            BMX_EXCEPTION(("Failed to initialise curl handle for HTTP range request"));
+        }
+        request->data = new unsigned char[sys_data->range_size];
+    } else {
+        request = sys_data->free_requests.back();
+        sys_data->free_requests.pop_back();
+    }
+
+    request->range_first = sys_data->next_range_first;
+    request->range_size  = sys_data->range_size;
+    if (request->range_size > sys_data->file_size - request->range_first)
+        request->range_size = (uint32_t)(sys_data->file_size - request->range_first);
+    request->data_size = 0;
+    request->done      = false;
+    request->result    = CURLE_OK;
+
+    char range_buf[64];
+    bmx_snprintf(range_buf, sizeof(range_buf), "%" PRId64 "-%" PRId64,
+                 request->range_first, request->range_first + request->range_size - 1);
+
+    curl_easy_reset(request->curl);
+    curl_easy_setopt(request->curl, CURLOPT_ERRORBUFFER, request->error_buf);
+    curl_easy_setopt(request->curl, CURLOPT_NOPROGRESS, 1);
+    curl_easy_setopt(request->curl, CURLOPT_URL, sys_data->url_str.c_str());
+    curl_easy_setopt(request->curl, CURLOPT_RANGE, range_buf);
+    curl_easy_setopt(request->curl, CURLOPT_WRITEFUNCTION, curl_range_data_cb);
+    curl_easy_setopt(request->curl, CURLOPT_WRITEDATA, (void*)request);
+    curl_easy_setopt(request->curl, CURLOPT_PRIVATE, (void*)request);
+    curl_easy_setopt(request->curl, CURLOPT_FAILONERROR, 1);
+
+    if (curl_multi_add_handle(sys_data->multi, request->curl) != CURLM_OK) {
+        sys_data->free_requests.push_back(request);
+        BMX_EXCEPTION(("Failed to add HTTP range request to curl multi handle"));
+    }
+    request->in_multi = true;
+
+    sys_data->window.push_back(request);
+    sys_data->next_range_first += request->range_size;
+}
+
+static bool wait_range_request(MXFFileSysData *sys_data, RangeRequest *request)
+{
+    while (!request->done) {
+        int running;
+        CURLMcode mresult = curl_multi_perform(sys_data->multi, &running);
+        if (mresult != CURLM_OK && mresult != CURLM_CALL_MULTI_PERFORM) {
+            log_error("HTTP multi request failed: %s\n", curl_multi_strerror(mresult));
+            return false;
+        }
+
+        CURLMsg *msg;
+        int msgs_left;
+        while ((msg = curl_multi_info_read(sys_data->multi, &msgs_left))) {
+            if (msg->msg == CURLMSG_DONE) {
+                RangeRequest *done_request = 0;
+                curl_easy_getinfo(msg->easy_handle, CURLINFO_PRIVATE, (char**)&done_request);
+                done_request->done   = true;
+                done_request->result = msg->data.result;
+            }
+        }
+
+        if (!request->done && running > 0)
+            curl_multi_wait(sys_data->multi, 0, 0, 1000, 0);
+    }
+
+    return true;
+}
+
+static uint64_t http_file_read_parallel(MXFFileSysData *sys_data, uint8_t *data, uint64_t count)
+{
+    uint64_t rem_count = count;
+
+    sys_data->eof = 0;
+
+    while (rem_count > 0) {
+        // drop requests that end before the position
+        while (!sys_data->window.empty() &&
+               sys_data->window.front()->range_first + sys_data->window.front()->range_size <= sys_data->position)
+        {
+            release_range_request(sys_data, sys_data->window.front());
+            sys_data->window.pop_front();
+        }
+        if (sys_data->window.empty() || sys_data->window.front()->range_first > sys_data->position) {
+            cancel_range_requests(sys_data);
+            sys_data->next_range_first = sys_data->position;
+        }
+
+        if (sys_data->position >= sys_data->file_size) {
+            sys_data->eof = 1;
+            break;
+        }
+
+        while (sys_data->window.size() < sys_data->num_ranges && sys_data->next_range_first < sys_data->file_size)
+            start_range_request(sys_data);
+
+        RangeRequest *request = sys_data->window.front();
+        if (!wait_range_request(sys_data, request)) {
+            cancel_range_requests(sys_data);
+            break;
+        }
+        if (request->result != CURLE_OK) {
+            if (request->result == CURLE_WRITE_ERROR)
+                log_error("HTTP server does not support byte range requests\n");
+            else
+                log_error("HTTP request failed: %s (curl result %d)\n", request->error_buf, request->result);
+            cancel_range_requests(sys_data);
+            break;
+        }
+
+        uint32_t offset = (uint32_t)(sys_data->position - request->range_first);
+        if (offset >= request->data_size) {
+            // the file is shorter than expected
+            sys_data->eof = 1;
+            break;
+        }
+
+        uint32_t copy_count = request->data_size - offset;
+        if (copy_count > rem_count)
+            copy_count = (uint32_t)rem_count;
+        memcpy(&data[count - rem_count], &request->data[offset], copy_count);
+        rem_count          -= copy_count;
+        sys_data->position += copy_count;
+    }
+
+    return count - rem_count;
 }
 
 
 static void http_file_close(MXFFileSysData *sys_data)
 {
+    if (sys_data->multi) {
+        cancel_range_requests(sys_data);
+        size_t i;
+        for (i = 0; i < sys_data->free_requests.size(); i++) {
+            curl_easy_cleanup(sys_data->free_requests[i]->curl);
+            delete [] sys_data->free_requests[i]->data;
+            delete sys_data->free_requests[i];
+        }
+        sys_data->free_requests.clear();
+        curl_multi_cleanup(sys_data->multi);
+        sys_data->multi = 0;
+    }
     if (sys_data->curl)
         curl_easy_cleanup(sys_data->curl);
     delete [] sys_data->buffer;
 }
 
-static uint32_t http_file_read(MXFFileSysData *sys_data, uint8_t *data, uint32_t count)
+static uint64_t http_file_read_64(MXFFileSysData *sys_data, uint8_t *data, uint64_t count)
 {
+    if (sys_data->multi)
+        return http_file_read_parallel(sys_data, data, count);
+
     uint8_t *data_ptr  = data;
-    uint32_t rem_count = count;
+    uint64_t rem_count = count;
 
     sys_data->eof = 0;
 
@@ -189,7 +401,7 @@ static uint32_t http_file_read(MXFFileSysData *sys_data, uint8_t *data, uint32_t
     if (sys_data->buffer_pos < sys_data->buffer_size) {
         buffer_copy_size = sys_data->buffer_size - sys_data->buffer_pos;
         if (buffer_copy_size > rem_count)
-            buffer_copy_size = rem_count;
+            buffer_copy_size = (uint32_t)rem_count;
         if (buffer_copy_size > 0) {
             memcpy(data_ptr, &sys_data->buffer[sys_data->buffer_pos], buffer_copy_size);
             sys_data->buffer_pos += buffer_copy_size;
@@ -272,6 +484,11 @@ static uint32_t http_file_read(MXFFileSysData *sys_data, uint8_t *data, uint32_t
     return count - rem_count;
 }
 
+static uint32_t http_file_read(MXFFileSysData *sys_data, uint8_t *data, uint32_t count)
+{
+    return (uint32_t)http_file_read_64(sys_data, data, count);
+}
+
 static uint32_t http_file_write(MXFFileSysData *sys_data, const uint8_t *data, uint32_t count)
 {
     (void)sys_data;
@@ -315,6 +532,9 @@ static int http_file_is_seekable(MXFFileSysData *sys_data)
 
 static int64_t http_file_size(MXFFileSysData *sys_data)
 {
+    if (sys_data->multi)
+        return sys_data->file_size;
+
     int64_t file_size = -1;
 
     // note: not using CURLINFO_CONTENT_LENGTH_DOWNLOAD because it returns a double
@@ -354,7 +574,15 @@ static int http_file_seek(MXFFileSysData *sys_data, int64_t offset, int whence)
         return 0;
     }
 
-    if (sys_data->position != new_position) {
+    if (sys_data->multi) {
+        // cancel the outstanding range requests if the new position is outside the window
+        if (!sys_data->window.empty() &&
+            (new_position < sys_data->window.front()->range_first || new_position >= sys_data->next_range_first))
+        {
+            cancel_range_requests(sys_data);
+        }
+        sys_data->position = new_position;
+    } else if (sys_data->position != new_position) {
         int64_t pos_diff = new_position - sys_data->position;
         if (sys_data->buffer_size > 0 &&
             pos_diff >= - (int64_t)sys_data->buffer_pos &&
@@ -411,6 +639,12 @@ MXFFile* bmx::mxf_http_file_open_read(const string &url_str, uint32_t min_read_s
         http_file->sysData->buffer_pos = 0;
         http_file->sysData->buffer_size = 0;
         http_file->sysData->buffer_alloc_size = 0;
+        http_file->sysData->disable_response_code_warn = false;
+        http_file->sysData->multi = 0;
+        http_file->sysData->range_size = 0;
+        http_file->sysData->num_ranges = 0;
+        http_file->sysData->file_size = -1;
+        http_file->sysData->next_range_first = 0;
 
         BMX_CHECK((http_file->sysData->curl = curl_easy_init()) != 0);
         if (min_read_size > 0) {
@@ -428,6 +662,7 @@ MXFFile* bmx::mxf_http_file_open_read(const string &url_str, uint32_t min_read_s
         http_file->tell          = http_file_tell;
         http_file->is_seekable   = http_file_is_seekable;
         http_file->size          = http_file_size;
+        http_file->read_64       = http_file_read_64;
         http_file->free_sys_data = free_http_file;
 
         return http_file;
@@ -440,6 +675,33 @@ MXFFile* bmx::mxf_http_file_open_read(const string &url_str, uint32_t min_read_s
     }
 }
 
+MXFFile* bmx::mxf_http_file_open_read_parallel(const string &url_str, uint32_t range_size, uint32_t num_ranges)
+{
+    BMX_CHECK(range_size > 0 && num_ranges > 0);
+
+    MXFFile *http_file = mxf_http_file_open_read(url_str, 0);
+    try
+    {
+        MXFFileSysData *sys_data = http_file->sysData;
+
+        // the file size is used to avoid requesting ranges beyond the end of the file
+        sys_data->file_size = http_file_size(sys_data);
+        if (sys_data->file_size < 0)
+            BMX_EXCEPTION(("Failed to get the size of HTTP file '%s' required for parallel range requests", url_str.c_str()));
+
+        BMX_CHECK((sys_data->multi = curl_multi_init()) != 0);
+        sys_data->range_size = range_size;
+        sys_data->num_ranges = num_ranges;
+
+        return http_file;
+    }
+    catch (...)
+    {
+        mxf_file_close(&http_file);
+        throw;
+    }
+}
+
 
 #else // ifdef HAVE_LIBCURL
 
@@ -472,5 +734,13 @@ MXFFile* bmx::mxf_http_file_open_read(const string &url_str, uint32_t min_read_s
     BMX_EXCEPTION(("HTTP file access is not supported in this build"));
 }
 
+MXFFile* bmx::mxf_http_file_open_read_parallel(const string &url_str, uint32_t range_size, uint32_t num_ranges)
+{
+    (void)url_str;
+    (void)range_size;
+    (void)num_ranges;
+    BMX_EXCEPTION(("HTTP file access is not supported in this build"));
+}
+
 
 #endif
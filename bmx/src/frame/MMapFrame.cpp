@@ -0,0 +1,174 @@
+/*
+ * Copyright (C) 2017, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Author: Philip de Nier
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <cstring>
+
+#include <bmx/frame/MMapFrame.h>
+#include <bmx/BMXException.h>
+#include <bmx/Logging.h>
+
+#if !defined(_WIN32)
+#include <mxf/mxf_mmap_file.h>
+#endif
+
+using namespace std;
+using namespace bmx;
+
+
+
+MMapFrame::MMapFrame()
+: Frame()
+{
+    mRegion = 0;
+    mRegionBytes = 0;
+    mRegionSize = 0;
+}
+
+MMapFrame::MMapFrame(const MMapFrame &from)
+: Frame(from), mData(from.mData)
+{
+#if !defined(_WIN32)
+    mRegion = mxf_mmap_region_ref(from.mRegion);
+#else
+    mRegion = 0;
+#endif
+    mRegionBytes = from.mRegionBytes;
+    mRegionSize = from.mRegionSize;
+}
+
+MMapFrame::~MMapFrame()
+{
+#if !defined(_WIN32)
+    mxf_mmap_region_unref(&mRegion);
+#endif
+}
+
+uint32_t MMapFrame::GetSize() const
+{
+    if (mRegion)
+        return mRegionSize;
+
+    return mData.GetSize();
+}
+
+const unsigned char* MMapFrame::GetBytes() const
+{
+    if (mRegion)
+        return mRegionBytes;
+
+    return mData.GetBytes();
+}
+
+void MMapFrame::Grow(uint32_t min_size)
+{
+    CopyMapped();
+    mData.Grow(min_size);
+}
+
+uint32_t MMapFrame::GetSizeAvailable() const
+{
+    BMX_ASSERT(!mRegion);
+    return mData.GetSizeAvailable();
+}
+
+unsigned char* MMapFrame::GetBytesAvailable() const
+{
+    BMX_ASSERT(!mRegion);
+    return mData.GetBytesAvailable();
+}
+
+void MMapFrame::SetSize(uint32_t size)
+{
+    if (mRegion && size <= mRegionSize) {
+        mRegionSize = size;
+    } else {
+        CopyMapped();
+        mData.SetSize(size);
+    }
+}
+
+void MMapFrame::IncrementSize(uint32_t inc)
+{
+    CopyMapped();
+    mData.IncrementSize(inc);
+}
+
+Frame* MMapFrame::Clone()
+{
+    return new MMapFrame(*this);
+}
+
+bool MMapFrame::ReadMapped(MXFFile *mxf_file, uint32_t size)
+{
+#if !defined(_WIN32)
+    // the mapped data can only be referenced if it is the only data in the frame
+    if (mRegion || mData.GetSize() > 0 || !mxf_mmap_file_is_mmap_file(mxf_file))
+        return false;
+
+    const uint8_t *data;
+    if (!mxf_mmap_file_read_region(mxf_file, size, &mRegion, &data))
+        return false;
+
+    mRegionBytes = data;
+    mRegionSize = size;
+
+    return true;
+#else
+    (void)mxf_file;
+    (void)size;
+    return false;
+#endif
+}
+
+void MMapFrame::CopyMapped()
+{
+#if !defined(_WIN32)
+    if (!mRegion)
+        return;
+
+    mData.CopyBytes(mRegionBytes, mRegionSize);
+
+    mxf_mmap_region_unref(&mRegion);
+    mRegionBytes = 0;
+    mRegionSize = 0;
+#endif
+}
+
+
+Frame* MMapFrameFactory::CreateFrame()
+{
+    return new MMapFrame();
+}
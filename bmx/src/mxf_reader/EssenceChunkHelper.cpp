@@ -38,6 +38,7 @@
 #include <cstdio>
 
 #include <memory>
+#include <algorithm>
 
 #include <libMXF++/MXF.h>
 
@@ -111,15 +112,21 @@ void EssenceChunkHelper::CreateEssenceChunkIndex(int64_t first_edit_unit_size)
     bool delayed_decision = false;
     bool current_element_matches;
 
-    const vector<Partition*> &partitions = mFileReader->mFile->getPartitions();
+    // the RIP body SIDs in the partition directory avoid loading the partition packs of other streams.
+    // A zero RIP body SID is not trusted because some writers don't set it
+    size_t num_partitions = mFileReader->mFile->getNumPartitions();
     size_t i;
-    for (i = 0; i < partitions.size(); i++) {
-        if (partitions[i]->getBodySID() != mFileReader->mBodySID)
+    for (i = 0; i < num_partitions; i++) {
+        uint32_t dir_body_sid = mFileReader->mFile->getPartitionBodySID(i);
+        if (dir_body_sid != 0 && dir_body_sid != mFileReader->mBodySID)
+            continue;
+        const Partition *partition = &mFileReader->mFile->getPartition(i);
+        if (partition->getBodySID() != mFileReader->mBodySID)
             continue;
 
         int64_t partition_end;
-        if (i + 1 < partitions.size())
-            partition_end = partitions[i + 1]->getThisPartition();
+        if (i + 1 < num_partitions)
+            partition_end = mFileReader->mFile->getPartitionOffset(i + 1);
         else
             partition_end = mxf_file->size();
 
@@ -127,7 +134,7 @@ void EssenceChunkHelper::CreateEssenceChunkIndex(int64_t first_edit_unit_size)
         matched_element = false;
         first_element = false;
 
-        mxf_file->seek(partitions[i]->getThisPartition(), SEEK_SET);
+        mxf_file->seek(partition->getThisPartition(), SEEK_SET);
         mxf_file->readKL(&key, &llen, &len);
         mxf_file->skip(len);
         while (!mxf_file->eof())
@@ -137,13 +144,13 @@ void EssenceChunkHelper::CreateEssenceChunkIndex(int64_t first_edit_unit_size)
             if (mxf_is_partition_pack(&key)) {
                 break;
             } else if (mxf_is_header_metadata(&key)) {
-                if (partitions[i]->getHeaderByteCount() > mxfKey_extlen + llen + len)
-                    mxf_file->skip(partitions[i]->getHeaderByteCount() - (mxfKey_extlen + llen));
+                if (partition->getHeaderByteCount() > mxfKey_extlen + llen + len)
+                    mxf_file->skip(partition->getHeaderByteCount() - (mxfKey_extlen + llen));
                 else
                     mxf_file->skip(len);
             } else if (mxf_is_index_table_segment(&key)) {
-                if (partitions[i]->getIndexByteCount() > mxfKey_extlen + llen + len)
-                    mxf_file->skip(partitions[i]->getIndexByteCount() - (mxfKey_extlen + llen));
+                if (partition->getIndexByteCount() > mxfKey_extlen + llen + len)
+                    mxf_file->skip(partition->getIndexByteCount() - (mxfKey_extlen + llen));
                 else
                     mxf_file->skip(len);
             } else if (mxf_is_gc_essence_element(&key) || mxf_avid_is_essence_element(&key)) {
@@ -227,7 +234,7 @@ void EssenceChunkHelper::AppendChunk(size_t partition_id, int64_t file_position,
 {
     // Note: file_position is after the KL
 
-    Partition *partition = mFileReader->mFile->getPartitions()[partition_id];
+    Partition *partition = &mFileReader->mFile->getPartition(partition_id);
 
     // check the essence container data is contiguous
     uint64_t body_offset = partition->getBodyOffset();
@@ -270,6 +277,8 @@ void EssenceChunkHelper::AppendChunk(size_t partition_id, int64_t file_position,
         essence_chunk.is_complete = true;
     }
     mEssenceChunks.push_back(essence_chunk);
+    mChunkEssenceOffsets.push_back(essence_chunk.essence_offset);
+    mChunkFilePositions.push_back(essence_chunk.file_position);
 
     mNumIndexedPartitions = partition_id + 1;
 }
@@ -369,59 +378,52 @@ void EssenceChunkHelper::EssenceOffsetUpdate(int64_t essence_offset)
 {
     BMX_CHECK(!mEssenceChunks.empty());
 
-    // TODO: use binary search
-    if (mEssenceChunks[mLastEssenceChunk].essence_offset > essence_offset)
-    {
-        // edit unit is in chunk before mLastEssenceChunk
-        size_t i;
-        for (i = mLastEssenceChunk; i > 0; i--) {
-            if (mEssenceChunks[i - 1].essence_offset <= essence_offset) {
-                mLastEssenceChunk = i - 1;
-                break;
-            }
-        }
-    }
-    else if (mEssenceChunks[mLastEssenceChunk].essence_offset +
-                    mEssenceChunks[mLastEssenceChunk].size <= essence_offset)
-    {
-        // edit unit is in chunk after mLastEssenceChunk
-        size_t i;
-        for (i = mLastEssenceChunk + 1; i < mEssenceChunks.size(); i++) {
-            if (mEssenceChunks[i].essence_offset + mEssenceChunks[i].size > essence_offset) {
-                mLastEssenceChunk = i;
-                break;
-            }
+    // try the last chunk and the one following it before searching
+    const EssenceChunk *chunk = &mEssenceChunks[mLastEssenceChunk];
+    if (chunk->essence_offset <= essence_offset && chunk->essence_offset + chunk->size > essence_offset)
+        return;
+
+    if (mLastEssenceChunk + 1 < mEssenceChunks.size()) {
+        chunk = &mEssenceChunks[mLastEssenceChunk + 1];
+        if (chunk->essence_offset <= essence_offset && chunk->essence_offset + chunk->size > essence_offset) {
+            mLastEssenceChunk++;
+            return;
         }
     }
+
+    if (mChunkEssenceOffsets[0] <= essence_offset)
+        mLastEssenceChunk = FindChunk(mChunkEssenceOffsets, essence_offset);
 }
 
 void EssenceChunkHelper::FilePositionUpdate(int64_t file_position)
 {
     BMX_CHECK(!mEssenceChunks.empty());
 
-    // TODO: use binary search
-    if (mEssenceChunks[mLastEssenceChunk].file_position > file_position)
-    {
-        // edit unit is in chunk before mLastEssenceChunk
-        size_t i;
-        for (i = mLastEssenceChunk; i > 0; i--) {
-            if (mEssenceChunks[i - 1].file_position <= file_position) {
-                mLastEssenceChunk = i - 1;
-                break;
-            }
-        }
-    }
-    else if (mEssenceChunks[mLastEssenceChunk].file_position +
-                 mEssenceChunks[mLastEssenceChunk].size <= file_position)
-    {
-        // edit unit is in chunk after mLastEssenceChunk
-        size_t i;
-        for (i = mLastEssenceChunk + 1; i < mEssenceChunks.size(); i++) {
-            if (mEssenceChunks[i].file_position + mEssenceChunks[i].size > file_position) {
-                mLastEssenceChunk = i;
-                break;
-            }
+    // try the last chunk and the one following it before searching
+    const EssenceChunk *chunk = &mEssenceChunks[mLastEssenceChunk];
+    if (chunk->file_position <= file_position && chunk->file_position + chunk->size > file_position)
+        return;
+
+    if (mLastEssenceChunk + 1 < mEssenceChunks.size()) {
+        chunk = &mEssenceChunks[mLastEssenceChunk + 1];
+        if (chunk->file_position <= file_position && chunk->file_position + chunk->size > file_position) {
+            mLastEssenceChunk++;
+            return;
         }
     }
+
+    if (mChunkFilePositions[0] <= file_position)
+        mLastEssenceChunk = FindChunk(mChunkFilePositions, file_position);
+}
+
+size_t EssenceChunkHelper::FindChunk(const vector<int64_t> &chunk_starts, int64_t value) const
+{
+    // the last chunk that starts at or before value. The chunks are contiguous and so this is the chunk
+    // containing value if there is one
+    vector<int64_t>::const_iterator iter = upper_bound(chunk_starts.begin(), chunk_starts.end(), value);
+    if (iter == chunk_starts.begin())
+        return 0;
+    else
+        return (iter - chunk_starts.begin()) - 1;
 }
 
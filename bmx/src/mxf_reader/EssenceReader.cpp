@@ -43,8 +43,11 @@
 
 #include <bmx/mxf_reader/EssenceReader.h>
 #include <bmx/mxf_reader/MXFFileReader.h>
+#include <bmx/mxf_reader/MXFSidecarCache.h>
 #include <bmx/mxf_helper/PictureMXFDescriptorHelper.h>
 #include <bmx/mxf_helper/SoundMXFDescriptorHelper.h>
+#include <bmx/frame/MMapFrame.h>
+#include <bmx/ByteArray.h>
 #include <bmx/MXFUtils.h>
 #include <bmx/Utils.h>
 #include <bmx/BMXException.h>
@@ -57,6 +60,110 @@ using namespace bmx;
 using namespace mxfpp;
 
 
+#define INDEX_SCAN_BUFFER_SIZE  (1024 * 1024)
+
+
+
+static bool parse_kl(const unsigned char *data, uint32_t size, mxfKey *key, uint8_t *llen, uint64_t *len)
+{
+    if (size < mxfKey_extlen + 1)
+        return false;
+
+    mxf_get_ul(data, key);
+
+    if (data[mxfKey_extlen] < 0x80) {
+        *llen = 1;
+        *len  = data[mxfKey_extlen];
+        return true;
+    }
+
+    uint8_t num_bytes = data[mxfKey_extlen] & 0x7f;
+    BMX_CHECK_M(num_bytes > 0 && num_bytes <= 8, ("Invalid BER length in essence container"));
+    if (size < (uint32_t)(mxfKey_extlen + 1 + num_bytes))
+        return false;
+
+    *llen = num_bytes + 1;
+    *len  = 0;
+    uint8_t i;
+    for (i = 0; i < num_bytes; i++)
+        *len = ((*len) << 8) | data[mxfKey_extlen + 1 + i];
+
+    return true;
+}
+
+static bool is_intra_frame_essence(EssenceType essence_type)
+{
+    switch (essence_type)
+    {
+        case D10_30:
+        case D10_40:
+        case D10_50:
+        case IEC_DV25:
+        case DVBASED_DV25:
+        case DV50:
+        case DV100_1080I:
+        case DV100_720P:
+        case AVCI200_1080I:
+        case AVCI200_1080P:
+        case AVCI200_720P:
+        case AVCI100_1080I:
+        case AVCI100_1080P:
+        case AVCI100_720P:
+        case AVCI50_1080I:
+        case AVCI50_1080P:
+        case AVCI50_720P:
+        case AVC_HIGH_10_INTRA:
+        case AVC_HIGH_422_INTRA:
+        case AVC_HIGH_444_INTRA:
+        case AVC_CAVLC_444_INTRA:
+        case UNC_SD:
+        case UNC_HD_1080I:
+        case UNC_HD_1080P:
+        case UNC_HD_720P:
+        case UNC_UHD_3840:
+        case AVID_10BIT_UNC_SD:
+        case AVID_10BIT_UNC_HD_1080I:
+        case AVID_10BIT_UNC_HD_1080P:
+        case AVID_10BIT_UNC_HD_720P:
+        case AVID_ALPHA_SD:
+        case AVID_ALPHA_HD_1080I:
+        case AVID_ALPHA_HD_1080P:
+        case AVID_ALPHA_HD_720P:
+        case RDD36_422_PROXY:
+        case RDD36_422_LT:
+        case RDD36_422:
+        case RDD36_422_HQ:
+        case RDD36_4444:
+        case RDD36_4444_XQ:
+        case VC3_1080P_1235:
+        case VC3_1080P_1237:
+        case VC3_1080P_1238:
+        case VC3_1080I_1241:
+        case VC3_1080I_1242:
+        case VC3_1080I_1243:
+        case VC3_1080I_1244:
+        case VC3_720P_1250:
+        case VC3_720P_1251:
+        case VC3_720P_1252:
+        case VC3_1080P_1253:
+        case VC3_720P_1258:
+        case VC3_1080P_1259:
+        case VC3_1080I_1260:
+        case MJPEG_2_1:
+        case MJPEG_3_1:
+        case MJPEG_10_1:
+        case MJPEG_20_1:
+        case MJPEG_4_1M:
+        case MJPEG_10_1M:
+        case MJPEG_15_1S:
+            return true;
+        default:
+            return false;
+    }
+}
+
+
+
 EssenceReaderBuffer::EssenceReaderBuffer(MXFFileReader *file_reader)
 {
     mFileReader = file_reader;
@@ -238,6 +345,7 @@ EssenceReader::EssenceReader(MXFFileReader *file_reader, bool file_is_complete)
     mFileReader = file_reader;
     mFile = file_reader->mFile;
     mFileIsComplete = file_is_complete;
+    mBuiltIndexTable = false;
     mFrameMetadataReader = new FrameMetadataReader(file_reader);
     mReadStartPosition = 0;
     mReadDuration = 0;
@@ -283,7 +391,8 @@ EssenceReader::EssenceReader(MXFFileReader *file_reader, bool file_is_complete)
     // if file is complete then read the index table segments, essence container layout and
     // determine the essence wrapping type
     if (file_is_complete) {
-        if (mFileReader->mIndexSID)
+        // the sidecar cache may hold an index table that was built for a file without one
+        if (mFileReader->mIndexSID || (mFileReader->mSidecarCache && mFileReader->mSidecarCache->IsLoaded()))
             mIndexTableHelper.ExtractIndexTable();
 
         // first edit unit size is used to determine the essence wrapping type
@@ -332,6 +441,18 @@ EssenceReader::EssenceReader(MXFFileReader *file_reader, bool file_is_complete)
 
         if (mEssenceChunkHelper.IsComplete())
             mIndexTableHelper.SetEssenceDataSize(mEssenceChunkHelper.GetEssenceDataSize());
+
+        // scan the essence container to build an index table instead of indexing whilst reading
+        if (mFileReader->mBuildIndex &&
+            !mIndexTableHelper.IsComplete() &&
+            mIndexTableHelper.GetDuration() == 0 &&
+            mFileReader->IsFrameWrapped() &&
+            mEssenceChunkHelper.IsComplete() &&
+            mEssenceChunkHelper.GetEssenceDataSize() > 0 &&
+            mFile->isSeekable())
+        {
+            BuildIndexTable();
+        }
     }
 
     // if essence container layout and index table are complete then check
@@ -490,6 +611,77 @@ int64_t EssenceReader::LegitimisePosition(int64_t position)
         return position;
 }
 
+void EssenceReader::BuildIndexTable()
+{
+    BMX_ASSERT(!mIndexTableHelper.IsComplete() && mIndexTableHelper.GetDuration() == 0);
+
+    // the built index entries have no flags, temporal offsets or key frame offsets, which is only
+    // correct for essence where every frame is a key frame
+    size_t i;
+    for (i = 0; i < mFileReader->GetNumInternalTrackReaders(); i++) {
+        const MXFTrackInfo *track_info = mFileReader->GetInternalTrackReader(i)->GetTrackInfo();
+        if (track_info->data_def == MXF_PICTURE_DDEF && !is_intra_frame_essence(track_info->essence_type)) {
+            log_warn("Not building an index table for '%s' essence which may not be intra-frame coded\n",
+                     essence_type_to_string(track_info->essence_type));
+            return;
+        }
+    }
+
+    // the KLs are parsed from large reads and the values are skipped. This avoids a small read and a seek for
+    // each essence element, which is slow on high latency storage. A content package starts at each occurrence
+    // of the first element key and ends at the next one or the end of the essence chunk
+    ByteArray buffer(INDEX_SCAN_BUFFER_SIZE);
+    mxfKey start_key = mEssenceChunkHelper.GetChunk(0).element_key;
+    int64_t position = 0;
+    mxfKey key;
+    uint8_t llen;
+    uint64_t len;
+    for (i = 0; i < mEssenceChunkHelper.GetNumChunks(); i++) {
+        const EssenceChunk &chunk = mEssenceChunkHelper.GetChunk(i);
+
+        int64_t buffer_offset = 0;
+        uint32_t buffer_size = 0;
+        int64_t cp_offset = -1;
+        int64_t offset = 0;
+        while (offset < chunk.size) {
+            if (offset >= buffer_offset + buffer_size ||
+                !parse_kl(buffer.GetBytes() + (offset - buffer_offset), (uint32_t)(buffer_offset + buffer_size - offset),
+                          &key, &llen, &len))
+            {
+                uint32_t read_size = INDEX_SCAN_BUFFER_SIZE;
+                if (chunk.size - offset < read_size)
+                    read_size = (uint32_t)(chunk.size - offset);
+                mFile->seek(chunk.file_position + offset, SEEK_SET);
+                BMX_CHECK(mFile->read(buffer.GetBytes(), read_size) == read_size);
+                buffer_offset = offset;
+                buffer_size = read_size;
+                if (!parse_kl(buffer.GetBytes(), buffer_size, &key, &llen, &len))
+                    break; // truncated KL at the end of the chunk is included in the last content package
+            }
+
+            if (mxf_equals_key(&key, &start_key)) {
+                if (cp_offset >= 0) {
+                    mIndexTableHelper.UpdateIndex(position, cp_offset, chunk.essence_offset + offset - cp_offset);
+                    position++;
+                }
+                cp_offset = chunk.essence_offset + offset;
+            }
+
+            offset += mxfKey_extlen + llen + len;
+        }
+        if (cp_offset >= 0) {
+            mIndexTableHelper.UpdateIndex(position, cp_offset, chunk.essence_offset + chunk.size - cp_offset);
+            position++;
+        }
+    }
+
+    mIndexTableHelper.SetIsComplete();
+    mBuiltIndexTable = true;
+
+    log_debug("Built an index table with duration %" PRId64 " by scanning the essence container\n",
+              mIndexTableHelper.GetDuration());
+}
+
 bool EssenceReader::IsComplete() const
 {
     return mEssenceChunkHelper.IsComplete() && mIndexTableHelper.IsComplete();
@@ -634,10 +826,14 @@ uint32_t EssenceReader::ReadFrameWrappedSamples(uint32_t num_samples)
                 if (frame) {
                     BMX_CHECK(len <= UINT32_MAX);
 
-                    frame->Grow((uint32_t)len);
-                    uint32_t num_read = mFile->read(frame->GetBytesAvailable(), (uint32_t)len);
-                    BMX_CHECK(num_read == len);
-                    frame->IncrementSize((uint32_t)len);
+                    // reference the data in a memory-mapped file rather than copying it if possible
+                    MMapFrame *mmap_frame = dynamic_cast<MMapFrame*>(frame);
+                    if (!mmap_frame || !mmap_frame->ReadMapped(mFile->getCFile(), (uint32_t)len)) {
+                        frame->Grow((uint32_t)len);
+                        uint32_t num_read = mFile->read(frame->GetBytesAvailable(), (uint32_t)len);
+                        BMX_CHECK(num_read == len);
+                        frame->IncrementSize((uint32_t)len);
+                    }
                     frame->num_samples++;
                 } else {
                     mFile->skip(len);
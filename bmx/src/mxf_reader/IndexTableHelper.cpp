@@ -39,12 +39,15 @@
 #include <cstdio>
 #include <cstring>
 
+#include <algorithm>
+
 #include <libMXF++/MXF.h>
 
 #include <mxf/mxf_avid.h>
 
 #include <bmx/mxf_reader/IndexTableHelper.h>
 #include <bmx/mxf_reader/MXFFileReader.h>
+#include <bmx/mxf_reader/MXFSidecarCache.h>
 #include <bmx/Utils.h>
 #include <bmx/BMXException.h>
 #include <bmx/Logging.h>
@@ -54,36 +57,22 @@ using namespace bmx;
 using namespace mxfpp;
 
 
-// temporal offset (1) + key frame offset (1) + flags (1) + stream offset (8)
-#define INTERNAL_INDEX_ENTRY_SIZE   11
-
 #define RUNTIME_INDEX_SEGMENT_SIZE  1500
 
-#define GET_TEMPORAL_OFFSET(pos)    (*((int8_t*)&mIndexEntries[(pos) * INTERNAL_INDEX_ENTRY_SIZE]))
-#define GET_KEY_FRAME_OFFSET(pos)   (*((int8_t*)&mIndexEntries[(pos) * INTERNAL_INDEX_ENTRY_SIZE + 1]))
-#define GET_FLAGS(pos)              (*((uint8_t*)&mIndexEntries[(pos) * INTERNAL_INDEX_ENTRY_SIZE + 2]))
-#define GET_STREAM_OFFSET(pos)      (*((int64_t*)&mIndexEntries[(pos) * INTERNAL_INDEX_ENTRY_SIZE + 3]))
-
 #define SEG_END(seg)    (seg->getIndexStartPosition() + seg->getIndexDuration())
 #define SEG_START(seg)  (seg->getIndexStartPosition())
 #define SEG_DUR(seg)    (seg->getIndexDuration())
 
 
 
-static int add_frame_offset_index_entry(void *data, uint32_t num_entries, MXFIndexTableSegment *segment,
-                                        int8_t temporal_offset, int8_t key_frame_offset, uint8_t flags,
-                                        uint64_t stream_offset, uint32_t *slice_offset, mxfRational *pos_table)
+static int get_index_entry_arrays(void *data, uint32_t num_entries, MXFIndexTableSegment *segment,
+                                  MXFIndexEntryArrays *arrays)
 {
     IndexTableHelperSegment *helper = static_cast<IndexTableHelperSegment*>(data);
 
     (void)segment;
-    (void)slice_offset;
-    (void)pos_table;
 
-    // file offsets use int64_t whilst the index segment stream offset is uint64_t
-    BMX_CHECK(stream_offset <= INT64_MAX);
-
-    helper->AppendIndexEntry(num_entries, temporal_offset, key_frame_offset, flags, (int64_t)stream_offset);
+    helper->GetIndexEntryArrays(num_entries, arrays);
 
     return 1;
 }
@@ -93,7 +82,10 @@ static int add_frame_offset_index_entry(void *data, uint32_t num_entries, MXFInd
 IndexTableHelperSegment::IndexTableHelperSegment()
 : IndexTableSegment()
 {
-    mIndexEntries = 0;
+    mStreamOffsets = 0;
+    mTemporalOffsets = 0;
+    mKeyFrameOffsets = 0;
+    mFlags = 0;
     mAllocIndexEntries = 0;
     mNumIndexEntries = 0;
     mEntriesStart = 0;
@@ -106,7 +98,10 @@ IndexTableHelperSegment::IndexTableHelperSegment()
 
 IndexTableHelperSegment::~IndexTableHelperSegment()
 {
-    delete [] mIndexEntries;
+    delete [] mStreamOffsets;
+    delete [] mTemporalOffsets;
+    delete [] mKeyFrameOffsets;
+    delete [] mFlags;
 }
 
 void IndexTableHelperSegment::ReadIndexTableSegment(File *file, uint64_t segment_len)
@@ -117,10 +112,15 @@ void IndexTableHelperSegment::ReadIndexTableSegment(File *file, uint64_t segment
     mxf_free_index_table_segment(&_cSegment);
 
     // use Avid function to support non-standard Avid index table segments
-    BMX_CHECK(mxf_avid_read_index_table_segment_2(file->getCFile(), segment_len,
+    BMX_CHECK(mxf_avid_read_index_table_segment_3(file->getCFile(), segment_len,
                                                   mxf_default_add_delta_entry, 0,
-                                                  add_frame_offset_index_entry, this,
+                                                  get_index_entry_arrays, this,
                                                   &_cSegment));
+
+    // file offsets use int64_t whilst the index segment stream offset is uint64_t
+    uint32_t i;
+    for (i = 0; i < mNumIndexEntries; i++)
+        BMX_CHECK(mStreamOffsets[i] >= 0);
 }
 
 void IndexTableHelperSegment::ProcessIndexTableSegment(Rational expected_edit_rate)
@@ -158,7 +158,7 @@ void IndexTableHelperSegment::ProcessIndexTableSegment(Rational expected_edit_ra
 
     if (mNumIndexEntries > 1 && mNumIndexEntries > getIndexDuration()) {
         // Avid adds an extra entry which provides the end offset or size for the last frame
-        if (GET_STREAM_OFFSET(0) == GET_STREAM_OFFSET(1)) {
+        if (mStreamOffsets[0] == mStreamOffsets[1]) {
             // eg. Avid MPEG-2 Long GOP (eg. XDCAM) has 2 identical entries per frame
             mHavePairedIndexEntries = true;
             if (getIndexDuration() * 2 > mNumIndexEntries) {
@@ -179,11 +179,11 @@ void IndexTableHelperSegment::ProcessIndexTableSegment(Rational expected_edit_ra
             }
             if (mNumIndexEntries > getIndexDuration() * 2) {
                 mHaveExtraIndexEntries = true;
-                mIndexEndOffset = GET_STREAM_OFFSET(getIndexDuration() * 2);
+                mIndexEndOffset = mStreamOffsets[getIndexDuration() * 2];
             }
         } else {
             mHaveExtraIndexEntries = true;
-            mIndexEndOffset = GET_STREAM_OFFSET(getIndexDuration());
+            mIndexEndOffset = mStreamOffsets[getIndexDuration()];
         }
     }
 }
@@ -207,10 +207,10 @@ int IndexTableHelperSegment::GetEditUnit(int64_t position, int8_t *temporal_offs
         if (mHavePairedIndexEntries)
             rel_position *= 2;
 
-        *temporal_offset  = GET_TEMPORAL_OFFSET(rel_position);
-        *key_frame_offset = GET_KEY_FRAME_OFFSET(rel_position);
-        *flags            = GET_FLAGS(rel_position);
-        *stream_offset    = GET_STREAM_OFFSET(rel_position);
+        *temporal_offset  = mTemporalOffsets[rel_position];
+        *key_frame_offset = mKeyFrameOffsets[rel_position];
+        *flags            = mFlags[rel_position];
+        *stream_offset    = mStreamOffsets[rel_position];
 
         if (mHavePairedIndexEntries) {
             *temporal_offset  /= 2;
@@ -221,6 +221,60 @@ int IndexTableHelperSegment::GetEditUnit(int64_t position, int8_t *temporal_offs
     return 0;
 }
 
+void IndexTableHelperSegment::GetIndexEntryArrays(uint32_t num_entries, MXFIndexEntryArrays *arrays)
+{
+    BMX_CHECK(!mStreamOffsets);
+    BMX_CHECK(num_entries > 0);
+
+    AllocIndexEntries(num_entries);
+    mNumIndexEntries = num_entries;
+
+    // int64_t and uint64_t have the same representation; offsets > INT64_MAX are rejected after reading
+    arrays->temporalOffsets = mTemporalOffsets;
+    arrays->keyFrameOffsets = mKeyFrameOffsets;
+    arrays->flags           = mFlags;
+    arrays->streamOffsets   = reinterpret_cast<uint64_t*>(mStreamOffsets);
+}
+
+void IndexTableHelperSegment::WriteIndexTableSegment(File *file, uint32_t index_sid, uint32_t body_sid) const
+{
+    BMX_CHECK(getSliceCount() == 0 && getPosTableCount() == 0);
+    BMX_CHECK(getIndexDuration() >= 0 && getIndexDuration() <= (UINT16_MAX - 8) / 11);
+
+    MXFIndexTableSegment segment = *_cSegment;
+    mxf_generate_uuid(&segment.instanceUID);
+    segment.indexSID = index_sid;
+    segment.bodySID = body_sid;
+    segment.deltaEntryArray = 0;
+    segment.indexEntryArray = 0;
+
+    uint32_t num_entries = 0;
+    if (mNumIndexEntries > 0)
+        num_entries = (uint32_t)getIndexDuration();
+
+    BMX_CHECK(mxf_write_index_table_segment_header(file->getCFile(), &segment, 0, num_entries));
+    if (num_entries > 0) {
+        BMX_CHECK(mxf_write_index_entry_array_header(file->getCFile(), 0, 0, num_entries));
+
+        // entries are written in the same way as they are read in GetEditUnit
+        MXFIndexEntry entry;
+        memset(&entry, 0, sizeof(entry));
+        uint32_t i;
+        for (i = 0; i < num_entries; i++) {
+            uint32_t entry_pos = (mHavePairedIndexEntries ? i * 2 : i);
+            entry.temporalOffset = mTemporalOffsets[entry_pos];
+            entry.keyFrameOffset = mKeyFrameOffsets[entry_pos];
+            entry.flags          = mFlags[entry_pos];
+            entry.streamOffset   = (uint64_t)mStreamOffsets[entry_pos];
+            if (mHavePairedIndexEntries) {
+                entry.temporalOffset /= 2;
+                entry.keyFrameOffset /= 2;
+            }
+            BMX_CHECK(mxf_write_index_entry(file->getCFile(), 0, 0, &entry));
+        }
+    }
+}
+
 bool IndexTableHelperSegment::CanAppendIndexEntry() const
 {
     return mEntriesStart + mNumIndexEntries < mAllocIndexEntries;
@@ -229,19 +283,18 @@ bool IndexTableHelperSegment::CanAppendIndexEntry() const
 void IndexTableHelperSegment::AppendIndexEntry(uint32_t num_entries, int8_t temporal_offset, int8_t key_frame_offset,
                                                uint8_t flags, int64_t stream_offset)
 {
-    if (!mIndexEntries) {
+    if (!mStreamOffsets) {
         BMX_CHECK(num_entries > 0);
-        mIndexEntries = new unsigned char[INTERNAL_INDEX_ENTRY_SIZE * num_entries];
-        mAllocIndexEntries = num_entries;
+        AllocIndexEntries(num_entries);
     }
 
     BMX_CHECK(CanAppendIndexEntry());
 
-    int64_t entry_pos = mEntriesStart + mNumIndexEntries;
-    GET_TEMPORAL_OFFSET(entry_pos)  = temporal_offset;
-    GET_KEY_FRAME_OFFSET(entry_pos) = key_frame_offset;
-    GET_FLAGS(entry_pos)            = flags;
-    GET_STREAM_OFFSET(entry_pos)    = stream_offset;
+    uint32_t entry_pos = mEntriesStart + mNumIndexEntries;
+    mTemporalOffsets[entry_pos] = temporal_offset;
+    mKeyFrameOffsets[entry_pos] = key_frame_offset;
+    mFlags[entry_pos]           = flags;
+    mStreamOffsets[entry_pos]   = stream_offset;
 
     mNumIndexEntries++;
 }
@@ -300,20 +353,31 @@ void IndexTableHelperSegment::UpdateDuration(int64_t duration)
 
 void IndexTableHelperSegment::CopyIndexEntries(const IndexTableHelperSegment *from_segment, uint32_t duration)
 {
-    BMX_ASSERT(!mIndexEntries);
-    BMX_ASSERT(from_segment->mIndexEntries);
+    BMX_ASSERT(!mStreamOffsets);
+    BMX_ASSERT(from_segment->mStreamOffsets);
 
     uint32_t num_entries = duration;
     if (from_segment->mHavePairedIndexEntries)
         num_entries *= 2;
 
-    mIndexEntries = new unsigned char[INTERNAL_INDEX_ENTRY_SIZE * num_entries];
-    memcpy(mIndexEntries, from_segment->mIndexEntries, INTERNAL_INDEX_ENTRY_SIZE * num_entries);
-    mAllocIndexEntries = num_entries;
+    AllocIndexEntries(num_entries);
+    memcpy(mStreamOffsets,   from_segment->mStreamOffsets,   num_entries * sizeof(*mStreamOffsets));
+    memcpy(mTemporalOffsets, from_segment->mTemporalOffsets, num_entries * sizeof(*mTemporalOffsets));
+    memcpy(mKeyFrameOffsets, from_segment->mKeyFrameOffsets, num_entries * sizeof(*mKeyFrameOffsets));
+    memcpy(mFlags,           from_segment->mFlags,           num_entries * sizeof(*mFlags));
     mNumIndexEntries = num_entries;
     mHavePairedIndexEntries = from_segment->mHavePairedIndexEntries;
 }
 
+void IndexTableHelperSegment::AllocIndexEntries(uint32_t num_entries)
+{
+    mStreamOffsets   = new int64_t[num_entries];
+    mTemporalOffsets = new int8_t[num_entries];
+    mKeyFrameOffsets = new int8_t[num_entries];
+    mFlags           = new uint8_t[num_entries];
+    mAllocIndexEntries = num_entries;
+}
+
 
 
 
@@ -323,6 +387,7 @@ IndexTableHelper::IndexTableHelper(MXFFileReader *file_reader)
     mFile = file_reader->mFile;
     mIsComplete = false;
     mLastEditUnitSegment = 0;
+    mSegmentStartsValid = false;
     mEditUnitSize = 0;
     mEssenceDataSize = 0;
     mEditRate = ZERO_RATIONAL;
@@ -342,10 +407,28 @@ void IndexTableHelper::ExtractIndexTable()
     uint8_t llen;
     uint64_t len;
 
-    const vector<Partition*> &partitions = mFileReader->mFile->getPartitions();
+    // read the index table segments from the sidecar cache snapshot if available
+    MXFSidecarCache *sidecar_cache = mFileReader->mSidecarCache;
+    if (sidecar_cache && sidecar_cache->IsLoaded()) {
+        uint32_t count;
+        File *cache_file = sidecar_cache->SeekIndexTableSegments(&count);
+        uint32_t j;
+        for (j = 0; j < count; j++) {
+            cache_file->readKL(&key, &llen, &len);
+            ReadIndexTableSegment(cache_file, len);
+        }
+
+        mIsComplete = !mSegments.empty();
+        return;
+    }
+
+    // skip partitions that the partition directory shows are holding another stream's essence
     size_t i;
-    for (i = 0; i < partitions.size(); i++) {
-        const Partition *partition = partitions[i];
+    for (i = 0; i < mFile->getNumPartitions(); i++) {
+        uint32_t dir_body_sid = mFile->getPartitionBodySID(i);
+        if (dir_body_sid != 0 && dir_body_sid != mFileReader->mBodySID)
+            continue;
+        const Partition *partition = &mFile->getPartition(i);
 
         if (partition->getIndexSID() != mFileReader->mIndexSID)
             continue;
@@ -373,6 +456,10 @@ void IndexTableHelper::ExtractIndexTable()
             while (true)
             {
                 if (mxf_is_index_table_segment(&key)) {
+                    if (sidecar_cache) {
+                        sidecar_cache->AddIndexTableSegment(mFile->tell() - (mxfKey_extlen + llen),
+                                                            mxfKey_extlen + llen + len);
+                    }
                     ReadIndexTableSegment(len);
                 } else if (mxf_is_filler(&key)) {
                     mFile->skip(len);
@@ -384,7 +471,7 @@ void IndexTableHelper::ExtractIndexTable()
 
                 if (index_byte_count > 0 && num_read >= index_byte_count)
                     break;
-                if (index_byte_count == 0 && i == partitions.size() - 1 && mFile->tell() >= mFile->size())
+                if (index_byte_count == 0 && i == mFile->getNumPartitions() - 1 && mFile->tell() >= mFile->size())
                     break;
 
                 mFile->readKL(&key, &llen, &len);
@@ -424,6 +511,7 @@ void IndexTableHelper::SetConstantEditUnitSize(Rational edit_rate, uint32_t size
     BMX_ASSERT(size > 0);
 
     mSegments.push_back(new IndexTableHelperSegment());
+    mSegmentStartsValid = false;
     IndexTableHelperSegment *segment = mSegments.back();
     segment->setIndexEditRate(edit_rate);
     segment->setEditUnitByteCount(size);
@@ -433,9 +521,14 @@ void IndexTableHelper::SetConstantEditUnitSize(Rational edit_rate, uint32_t size
 }
 
 int64_t IndexTableHelper::ReadIndexTableSegment(uint64_t len)
+{
+    return ReadIndexTableSegment(mFileReader->mFile, len);
+}
+
+int64_t IndexTableHelper::ReadIndexTableSegment(File *file, uint64_t len)
 {
     auto_ptr<IndexTableHelperSegment> new_segment(new IndexTableHelperSegment());
-    new_segment->ReadIndexTableSegment(mFileReader->mFile, len);
+    new_segment->ReadIndexTableSegment(file, len);
     try
     {
         new_segment->ProcessIndexTableSegment(mEditRate);
@@ -497,6 +590,7 @@ void IndexTableHelper::UpdateIndex(int64_t position, int64_t essence_offset, int
             mSegments.back()->AppendIndexEntry(0, 0, 0, 0, essence_offset);
 
         mSegments.push_back(segment.release());
+        mSegmentStartsValid = false;
     }
 
     mDuration++;
@@ -521,37 +615,23 @@ void IndexTableHelper::GetEditUnit(int64_t position, int8_t *temporal_offset, in
     BMX_ASSERT(!mSegments.empty());
     BMX_CHECK(mDuration == 0 || position < mDuration);
 
+    if (mLastEditUnitSegment >= mSegments.size())
+        mLastEditUnitSegment = 0;
+
+    // sequential reads stay in the last segment or move to the next one
     int result = mSegments[mLastEditUnitSegment]->GetEditUnit(position, temporal_offset, key_frame_offset, flags,
                                                               offset);
+    if (result == -1 && mLastEditUnitSegment + 1 < mSegments.size()) {
+        result = mSegments[mLastEditUnitSegment + 1]->GetEditUnit(position, temporal_offset, key_frame_offset, flags,
+                                                                  offset);
+        if (result == 0)
+            mLastEditUnitSegment++;
+    }
     if (result < 0) {
-        // TODO: binary search
-        if (result == -2) {
-            // segment is before mLastEditUnitSegment
-            size_t i;
-            for (i = mLastEditUnitSegment; i > 0; i--) {
-                result = mSegments[i - 1]->GetEditUnit(position, temporal_offset, key_frame_offset, flags,
-                                                       offset);
-                if (result >= 0) {
-                    mLastEditUnitSegment = i - 1;
-                    break;
-                } else if (result == -1) {
-                    break;
-                }
-            }
-        } else {
-            // segment is after mLastEditUnitSegment
-            size_t i;
-            for (i = mLastEditUnitSegment + 1; i < mSegments.size(); i++) {
-                result = mSegments[i]->GetEditUnit(position, temporal_offset, key_frame_offset, flags,
-                                                   offset);
-                if (result >= 0) {
-                    mLastEditUnitSegment = i;
-                    break;
-                } else if (result == -2) {
-                    break;
-                }
-            }
-        }
+        size_t segment_index = FindSegment(position);
+        result = mSegments[segment_index]->GetEditUnit(position, temporal_offset, key_frame_offset, flags, offset);
+        if (result == 0)
+            mLastEditUnitSegment = segment_index;
     }
     BMX_CHECK_M(result == 0,
                ("Failed to find edit unit index information for position 0x%" PRIx64, position));
@@ -657,6 +737,7 @@ void IndexTableHelper::InsertCBEIndexSegment(auto_ptr<IndexTableHelperSegment> &
             // replace runtime generated index segment
             delete mSegments.front();
             mSegments.clear();
+            mSegmentStartsValid = false;
         } else {
             // existing CBE segments
 
@@ -679,6 +760,7 @@ void IndexTableHelper::InsertCBEIndexSegment(auto_ptr<IndexTableHelperSegment> &
     }
 
     mSegments.push_back(new_segment);
+    mSegmentStartsValid = false;
     new_segment_ap.release();
 
     if (mSegments.size() == 1) {
@@ -698,6 +780,8 @@ void IndexTableHelper::InsertVBEIndexSegment(auto_ptr<IndexTableHelperSegment> &
     if (mEditUnitSize > 0)
         BMX_EXCEPTION(("Can't mix VBE and CBE index table segments"));
 
+    mSegmentStartsValid = false;
+
     // update or remove existing segments
     int64_t new_duration = 0;
     vector<IndexTableHelperSegment*>::iterator iter = mSegments.begin();
@@ -768,3 +852,28 @@ IndexTableHelperSegment* IndexTableHelper::CreateStartSegment(IndexTableHelperSe
     return new_segment.release();
 }
 
+void IndexTableHelper::WriteIndexTableSegments(File *file, uint32_t index_sid, uint32_t body_sid) const
+{
+    size_t i;
+    for (i = 0; i < mSegments.size(); i++)
+        mSegments[i]->WriteIndexTableSegment(file, index_sid, body_sid);
+}
+
+size_t IndexTableHelper::FindSegment(int64_t position)
+{
+    if (!mSegmentStartsValid) {
+        mSegmentStarts.resize(mSegments.size());
+        size_t i;
+        for (i = 0; i < mSegments.size(); i++)
+            mSegmentStarts[i] = mSegments[i]->getIndexStartPosition();
+        mSegmentStartsValid = true;
+    }
+
+    // the last segment that starts at or before position
+    vector<int64_t>::const_iterator iter = upper_bound(mSegmentStarts.begin(), mSegmentStarts.end(), position);
+    if (iter == mSegmentStarts.begin())
+        return 0;
+    else
+        return (iter - mSegmentStarts.begin()) - 1;
+}
+
@@ -43,6 +43,7 @@
 #include <set>
 
 #include <bmx/mxf_reader/MXFFileReader.h>
+#include <bmx/mxf_reader/MXFSidecarCache.h>
 #include <bmx/mxf_helper/PictureMXFDescriptorHelper.h>
 #include <bmx/essence_parser/AVCEssenceParser.h>
 #include <bmx/st436/ST436Element.h>
@@ -162,6 +163,9 @@ MXFFileReader::MXFFileReader()
     mEssenceReader = 0;
     mRequireFrameInfoCount = 0;
     mST436ManifestCount = 2;
+    mUseSidecarCache = false;
+    mSidecarCache = 0;
+    mBuildIndex = false;
 
     mDataModel = new DataModel();
     mHeaderMetadata = new AvidHeaderMetadata(mDataModel);
@@ -180,6 +184,7 @@ MXFFileReader::~MXFFileReader()
     if (mOwnFilefactory)
         delete mFileFactory;
     delete mEssenceReader;
+    delete mSidecarCache;
     delete mFile;
     delete mHeaderMetadata;
     delete mDataModel;
@@ -226,6 +231,22 @@ void MXFFileReader::SetST436ManifestFrameCount(uint32_t count)
     mST436ManifestCount = count;
 }
 
+void MXFFileReader::SetLazyHeaderMetadata(bool enable)
+{
+    mHeaderMetadata->setLazyRead(enable);
+}
+
+void MXFFileReader::SetSidecarCache(bool enable, string cache_dir)
+{
+    mUseSidecarCache = enable;
+    mSidecarCacheDir = cache_dir;
+}
+
+void MXFFileReader::SetBuildIndex(bool enable)
+{
+    mBuildIndex = enable;
+}
+
 void MXFFileReader::SetFileIndex(MXFFileIndex *file_index, bool take_ownership)
 {
     if (mFileId != (size_t)(-1))
@@ -340,25 +361,47 @@ MXFFileReader::OpenResult MXFFileReader::Open(File *file, const URI &abs_uri, co
         }
 
 
+        // load the partitions, header metadata and index from the sidecar cache if it is valid for this file
+
+        if (mUseSidecarCache && mFile->isSeekable() && abs_uri.IsAbsFile()) {
+            string mxf_filename = abs_uri.ToFilename();
+            mSidecarCache = new MXFSidecarCache(MXFSidecarCache::GetDefaultFilename(mxf_filename, mSidecarCacheDir));
+            mSidecarCache->Load(mFile, mxf_filename);
+        }
+
+
         // try read all partitions find and get last partition with header metadata
 
         bool file_is_complete;
-        if (mFile->isSeekable()) {
-            file_is_complete = mFile->readPartitions();
+        if (mSidecarCache && mSidecarCache->IsLoaded()) {
+            file_is_complete = true;
+        } else if (mFile->isSeekable()) {
+            file_is_complete = mFile->readPartitions(true);
             if (!file_is_complete) {
-                BMX_ASSERT(mFile->getPartitions().size() == 1);
+                BMX_ASSERT(mFile->getNumPartitions() == 1);
                 if (mFile->getPartition(0).isClosed() || mFile->getPartition(0).getFooterPartition() != 0)
                     log_warn("Failed to read all partitions. File may be incomplete or invalid\n");
             }
         } else {
             file_is_complete = false;
         }
-        const vector<Partition*> &partitions = mFile->getPartitions();
+        // use the header metadata in the last partition if present. Otherwise use the header partition's
+        // closed and complete header metadata rather than the last body partition with header metadata, because
+        // any header metadata repeated in a body partition will be the same. This avoids loading the body
+        // partition packs listed in the RIP, which are loaded on demand
         Partition *metadata_partition = 0;
-        for (i = partitions.size(); i > 0 ; i--) {
-            if (partitions[i - 1]->getHeaderByteCount() > 0) {
-                metadata_partition = partitions[i - 1];
-                break;
+        Partition &last_partition = mFile->getPartition(mFile->getNumPartitions() - 1);
+        Partition &first_partition = mFile->getPartition(0);
+        if (last_partition.getHeaderByteCount() > 0) {
+            metadata_partition = &last_partition;
+        } else if (first_partition.isClosedAndComplete() && first_partition.getHeaderByteCount() > 0) {
+            metadata_partition = &first_partition;
+        } else {
+            for (i = mFile->getNumPartitions(); i > 0 ; i--) {
+                if (mFile->getPartition(i - 1).getHeaderByteCount() > 0) {
+                    metadata_partition = &mFile->getPartition(i - 1);
+                    break;
+                }
             }
         }
         if (!metadata_partition)
@@ -370,15 +413,18 @@ MXFFileReader::OpenResult MXFFileReader::Open(File *file, const URI &abs_uri, co
         mxfKey key;
         uint8_t llen;
         uint64_t len;
-        if (mFile->isSeekable()) {
+        File *metadata_file = mFile;
+        if (mSidecarCache && mSidecarCache->IsLoaded()) {
+            metadata_file = mSidecarCache->SeekHeaderMetadata();
+        } else if (mFile->isSeekable()) {
             mFile->seek(metadata_partition->getThisPartition(), SEEK_SET);
             mFile->readKL(&key, &llen, &len);
             mFile->skip(len);
         }
-        mFile->readNextNonFillerKL(&key, &llen, &len);
+        metadata_file->readNextNonFillerKL(&key, &llen, &len);
         BMX_CHECK(mxf_is_header_metadata(&key));
 
-        mHeaderMetadata->read(mFile, metadata_partition, &key, llen, len);
+        mHeaderMetadata->read(metadata_file, metadata_partition, &key, llen, len);
 
         ProcessMetadata(metadata_partition);
 
@@ -420,6 +466,24 @@ MXFFileReader::OpenResult MXFFileReader::Open(File *file, const URI &abs_uri, co
         }
 
 
+        // write a new sidecar cache snapshot if the cache was out of date or missing
+
+        if (mSidecarCache) {
+            if (!mSidecarCache->IsLoaded() && file_is_complete) {
+                if (mEssenceReader && mEssenceReader->HaveBuiltIndexTable()) {
+                    mSidecarCache->SetBuiltIndexTable(mEssenceReader->GetIndexTableHelper(),
+                                                      mIndexSID, mBodySID);
+                }
+                mSidecarCache->Save(mFile, metadata_partition);
+            }
+            delete mSidecarCache;
+            mSidecarCache = 0;
+        }
+
+        log_debug("Read %" PRIszt " of %" PRIszt " partition packs when opening the file\n",
+                  mFile->getPartitionPackReadCount(), mFile->getNumPartitions());
+
+
         result = MXF_RESULT_SUCCESS;
     }
     catch (const OpenResult &ex)
@@ -439,6 +503,8 @@ MXFFileReader::OpenResult MXFFileReader::Open(File *file, const URI &abs_uri, co
     // clean up
     if (result != MXF_RESULT_SUCCESS) {
         mFile = 0;
+        delete mSidecarCache;
+        mSidecarCache = 0;
         delete mEssenceReader;
         mEssenceReader = 0;
         delete mHeaderMetadata;
@@ -0,0 +1,420 @@
+/*
+ * Copyright (C) 2017, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Author: Philip de Nier
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <cstdio>
+#include <cstring>
+#include <cerrno>
+
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <fcntl.h>
+#if defined(_WIN32)
+#include <io.h>
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+#include <bmx/mxf_reader/MXFSidecarCache.h>
+#include <bmx/mxf_reader/IndexTableHelper.h>
+#include <bmx/ByteArray.h>
+#include <bmx/MD5.h>
+#include <bmx/Utils.h>
+#include <bmx/BMXException.h>
+#include <bmx/Logging.h>
+
+using namespace std;
+using namespace bmx;
+using namespace mxfpp;
+
+
+#define CACHE_VERSION           2
+#define CACHE_SUFFIX            ".bmxcache"
+
+#define DIGEST_REGION_SIZE      (64 * 1024)
+#define COPY_BUFFER_SIZE        (64 * 1024)
+
+
+static const unsigned char CACHE_MAGIC[8] = {'b', 'm', 'x', 'c', 'a', 'c', 'h', 'e'};
+
+
+
+// the modification time is in nanoseconds, with the sub-second part set to 0 if the platform doesn't provide it
+static bool get_file_mod_time(const string &filename, int64_t *mod_time)
+{
+#if defined(_WIN32)
+    struct _stati64 buf;
+    if (_stati64(filename.c_str(), &buf) != 0)
+        return false;
+#else
+    struct stat buf;
+    if (stat(filename.c_str(), &buf) != 0)
+        return false;
+#endif
+
+    *mod_time = (int64_t)buf.st_mtime * 1000000000;
+#if defined(HAVE_STRUCT_STAT_ST_MTIM_TV_NSEC)
+    *mod_time += buf.st_mtim.tv_nsec;
+#elif defined(HAVE_STRUCT_STAT_ST_MTIMESPEC_TV_NSEC)
+    *mod_time += buf.st_mtimespec.tv_nsec;
+#endif
+    return true;
+}
+
+// creates an empty temporary file next to the cache file with a name that no other writer is using, so that
+// readers that open the same MXF file at the same time don't write into the same temporary file
+static bool create_temp_file(const string &filename, string *temp_filename)
+{
+    char suffix[64];
+    int attempt;
+    for (attempt = 0; attempt < 100; attempt++) {
+#if defined(_WIN32)
+        bmx_snprintf(suffix, sizeof(suffix), ".tmp%d_%d", _getpid(), attempt);
+        string name = filename + suffix;
+        int fd = _open(name.c_str(), _O_WRONLY | _O_CREAT | _O_EXCL | _O_BINARY, _S_IREAD | _S_IWRITE);
+        if (fd >= 0) {
+            _close(fd);
+#else
+        bmx_snprintf(suffix, sizeof(suffix), ".tmp%d_%d", (int)getpid(), attempt);
+        string name = filename + suffix;
+        int fd = open(name.c_str(), O_WRONLY | O_CREAT | O_EXCL, 0666);
+        if (fd >= 0) {
+            close(fd);
+#endif
+            *temp_filename = name;
+            return true;
+        }
+        if (errno != EEXIST)
+            break;
+    }
+
+    return false;
+}
+
+static bool update_digest(MD5Context *md5_context, File *mxf_file, int64_t position, uint32_t size)
+{
+    bmx::ByteArray buffer(size);
+    mxf_file->seek(position, SEEK_SET);
+    if (mxf_file->read(buffer.GetBytes(), size) != size)
+        return false;
+
+    md5_update(md5_context, buffer.GetBytes(), size);
+    return true;
+}
+
+
+
+string MXFSidecarCache::GetDefaultFilename(const string &mxf_filename, const string &cache_dir)
+{
+    if (cache_dir.empty())
+        return mxf_filename + CACHE_SUFFIX;
+    else if (check_ends_with_dir_separator(cache_dir))
+        return cache_dir + strip_path(mxf_filename) + CACHE_SUFFIX;
+    else
+        return cache_dir + "/" + strip_path(mxf_filename) + CACHE_SUFFIX;
+}
+
+MXFSidecarCache::MXFSidecarCache(const string &filename)
+{
+    mFilename = filename;
+    mCacheFile = 0;
+    mHaveIdentity = false;
+    mFileSize = 0;
+    mFileModTime = 0;
+    memset(mFileDigest, 0, sizeof(mFileDigest));
+    mHeaderMetadataOffset = 0;
+    mIndexTableOffset = 0;
+    mIndexTableSegmentCount = 0;
+    mBuiltIndexTable = 0;
+    mBuiltIndexSID = 0;
+    mBuiltBodySID = 0;
+}
+
+MXFSidecarCache::~MXFSidecarCache()
+{
+    delete mCacheFile;
+}
+
+bool MXFSidecarCache::Load(File *mxf_file, const string &mxf_filename)
+{
+    BMX_ASSERT(!mCacheFile && !mHaveIdentity);
+
+    try
+    {
+        if (!ReadIdentity(mxf_file, mxf_filename) || !check_file_exists(mFilename))
+            return false;
+
+        mCacheFile = File::openRead(mFilename);
+        if (!ReadSnapshot(mxf_file)) {
+            delete mCacheFile;
+            mCacheFile = 0;
+        }
+    }
+    catch (...)
+    {
+        log_warn("Failed to read sidecar cache file '%s'\n", mFilename.c_str());
+        delete mCacheFile;
+        mCacheFile = 0;
+    }
+
+    return mCacheFile != 0;
+}
+
+File* MXFSidecarCache::SeekHeaderMetadata()
+{
+    BMX_ASSERT(mCacheFile);
+
+    mCacheFile->seek(mHeaderMetadataOffset, SEEK_SET);
+
+    return mCacheFile;
+}
+
+File* MXFSidecarCache::SeekIndexTableSegments(uint32_t *count)
+{
+    BMX_ASSERT(mCacheFile);
+
+    mCacheFile->seek(mIndexTableOffset, SEEK_SET);
+    *count = mIndexTableSegmentCount;
+
+    return mCacheFile;
+}
+
+void MXFSidecarCache::AddIndexTableSegment(int64_t position, uint64_t size)
+{
+    mIndexTableSegments.push_back(make_pair(position, size));
+}
+
+void MXFSidecarCache::SetBuiltIndexTable(const IndexTableHelper *index_table, uint32_t index_sid, uint32_t body_sid)
+{
+    mBuiltIndexTable = index_table;
+    mBuiltIndexSID = index_sid;
+    mBuiltBodySID = body_sid;
+}
+
+void MXFSidecarCache::Save(File *mxf_file, const Partition *metadata_partition)
+{
+    BMX_ASSERT(!mCacheFile);
+
+    if (!mHaveIdentity)
+        return;
+
+    // write to a temporary file first so that readers never see an incomplete cache file
+    string temp_filename;
+    if (!create_temp_file(mFilename, &temp_filename)) {
+        log_warn("Failed to create temporary sidecar cache file for '%s': %s\n",
+                 mFilename.c_str(), bmx_strerror(errno).c_str());
+        return;
+    }
+    File *cache_file = 0;
+    try
+    {
+        cache_file = File::openNew(temp_filename);
+        WriteSnapshot(cache_file, mxf_file, metadata_partition);
+        delete cache_file;
+    }
+    catch (...)
+    {
+        log_warn("Failed to write sidecar cache file '%s'\n", temp_filename.c_str());
+        delete cache_file;
+        remove(temp_filename.c_str());
+        return;
+    }
+
+#if defined(_WIN32)
+    remove(mFilename.c_str());
+#endif
+    if (rename(temp_filename.c_str(), mFilename.c_str()) != 0) {
+        log_warn("Failed to rename sidecar cache file '%s' to '%s': %s\n",
+                 temp_filename.c_str(), mFilename.c_str(), bmx_strerror(errno).c_str());
+        remove(temp_filename.c_str());
+    }
+}
+
+bool MXFSidecarCache::ReadIdentity(File *mxf_file, const string &mxf_filename)
+{
+    if (!get_file_mod_time(mxf_filename, &mFileModTime))
+        return false;
+
+    mFileSize = mxf_file->size();
+    if (mFileSize < 0)
+        return false;
+
+    // the digest covers the start of the file, which includes the header partition pack, and the end of the file,
+    // which includes the footer partition pack and the RIP
+    uint32_t digest_size = DIGEST_REGION_SIZE;
+    if (mFileSize < digest_size)
+        digest_size = (uint32_t)mFileSize;
+
+    MD5Context md5_context;
+    md5_init(&md5_context);
+    if (!update_digest(&md5_context, mxf_file, 0, digest_size) ||
+        !update_digest(&md5_context, mxf_file, mFileSize - digest_size, digest_size))
+    {
+        return false;
+    }
+    md5_final(mFileDigest, &md5_context);
+
+    mHaveIdentity = true;
+    return true;
+}
+
+bool MXFSidecarCache::ReadSnapshot(File *mxf_file)
+{
+    unsigned char magic[sizeof(CACHE_MAGIC)];
+    if (mCacheFile->read(magic, sizeof(magic)) != sizeof(magic) ||
+        memcmp(magic, CACHE_MAGIC, sizeof(magic)) != 0 ||
+        mCacheFile->readUInt32() != CACHE_VERSION)
+    {
+        log_warn("Sidecar cache file '%s' has an unknown format\n", mFilename.c_str());
+        return false;
+    }
+
+    unsigned char file_digest[sizeof(mFileDigest)];
+    int64_t file_size = mCacheFile->readInt64();
+    int64_t file_mod_time = mCacheFile->readInt64();
+    if (mCacheFile->read(file_digest, sizeof(file_digest)) != sizeof(file_digest) ||
+        file_size != mFileSize ||
+        file_mod_time != mFileModTime ||
+        memcmp(file_digest, mFileDigest, sizeof(mFileDigest)) != 0)
+    {
+        log_debug("Sidecar cache file '%s' is out of date\n", mFilename.c_str());
+        return false;
+    }
+
+    mxfKey key;
+    uint8_t llen;
+    uint64_t len;
+    vector<Partition*> partitions;
+    try
+    {
+        uint32_t partition_count = mCacheFile->readUInt32();
+        uint32_t i;
+        for (i = 0; i < partition_count; i++) {
+            mCacheFile->readKL(&key, &llen, &len);
+            BMX_CHECK(mxf_is_partition_pack(&key));
+            partitions.push_back(Partition::read(mCacheFile, &key, len));
+        }
+
+        uint64_t header_byte_count = mCacheFile->readUInt64();
+        mHeaderMetadataOffset = mCacheFile->tell();
+        mCacheFile->skip(header_byte_count);
+
+        // check the index table segments are all present before accepting the snapshot
+        mIndexTableSegmentCount = mCacheFile->readUInt32();
+        mIndexTableOffset = mCacheFile->tell();
+        for (i = 0; i < mIndexTableSegmentCount; i++) {
+            mCacheFile->readKL(&key, &llen, &len);
+            BMX_CHECK(mxf_is_index_table_segment(&key));
+            mCacheFile->skip(len);
+        }
+        BMX_CHECK(mCacheFile->tell() == mCacheFile->size());
+    }
+    catch (...)
+    {
+        size_t i;
+        for (i = 0; i < partitions.size(); i++)
+            delete partitions[i];
+        throw;
+    }
+
+    // the header partition was read from the MXF file
+    BMX_ASSERT(mxf_file->getNumPartitions() == 1);
+    size_t i;
+    for (i = 0; i < partitions.size(); i++)
+        mxf_file->appendPartition(partitions[i]);
+
+    log_debug("Using sidecar cache file '%s'\n", mFilename.c_str());
+
+    return true;
+}
+
+void MXFSidecarCache::WriteSnapshot(File *cache_file, File *mxf_file, const Partition *metadata_partition)
+{
+    mxfKey key;
+    uint8_t llen;
+    uint64_t len;
+    int64_t runin_len = mxf_get_runin_len(mxf_file->getCFile());
+
+    BMX_CHECK(cache_file->write(CACHE_MAGIC, sizeof(CACHE_MAGIC)) == sizeof(CACHE_MAGIC));
+    cache_file->writeUInt32(CACHE_VERSION);
+    cache_file->writeInt64(mFileSize);
+    cache_file->writeInt64(mFileModTime);
+    BMX_CHECK(cache_file->write(mFileDigest, sizeof(mFileDigest)) == sizeof(mFileDigest));
+
+    // the partition packs following the header partition pack. The packs are copied using the offsets in the
+    // partition directory so that partitions that haven't been loaded aren't loaded here
+    size_t num_partitions = mxf_file->getNumPartitions();
+    BMX_ASSERT(num_partitions > 0);
+    cache_file->writeUInt32((uint32_t)(num_partitions - 1));
+    size_t i;
+    for (i = 1; i < num_partitions; i++) {
+        int64_t position = runin_len + mxf_file->getPartitionOffset(i);
+        mxf_file->seek(position, SEEK_SET);
+        mxf_file->readKL(&key, &llen, &len);
+        CopyBytes(cache_file, mxf_file, position, mxfKey_extlen + llen + len);
+    }
+
+    // the header metadata following the metadata partition pack
+    mxf_file->seek(runin_len + metadata_partition->getThisPartition(), SEEK_SET);
+    mxf_file->readKL(&key, &llen, &len);
+    cache_file->writeUInt64(metadata_partition->getHeaderByteCount());
+    CopyBytes(cache_file, mxf_file, mxf_file->tell() + len, metadata_partition->getHeaderByteCount());
+
+    // the index table segments in the order they were read, or the segments of the built index table
+    if (mBuiltIndexTable) {
+        cache_file->writeUInt32(mBuiltIndexTable->GetNumSegments());
+        mBuiltIndexTable->WriteIndexTableSegments(cache_file, mBuiltIndexSID, mBuiltBodySID);
+    } else {
+        cache_file->writeUInt32((uint32_t)mIndexTableSegments.size());
+        for (i = 0; i < mIndexTableSegments.size(); i++)
+            CopyBytes(cache_file, mxf_file, mIndexTableSegments[i].first, mIndexTableSegments[i].second);
+    }
+}
+
+void MXFSidecarCache::CopyBytes(File *cache_file, File *mxf_file, int64_t position, uint64_t size)
+{
+    ByteArray buffer(COPY_BUFFER_SIZE);
+
+    mxf_file->seek(position, SEEK_SET);
+    uint64_t remaining = size;
+    while (remaining > 0) {
+        uint32_t count = COPY_BUFFER_SIZE;
+        if (remaining < count)
+            count = (uint32_t)remaining;
+        BMX_CHECK(mxf_file->read(buffer.GetBytes(), count) == count);
+        BMX_CHECK(cache_file->write(buffer.GetBytes(), count) == count);
+        remaining -= count;
+    }
+}
@@ -209,25 +209,28 @@ void MXFTextObject::ReadGenericStream(FILE *text_file_out, unsigned char **data_
         mxfKey key;
         uint8_t llen;
         uint64_t len;
-        const vector<Partition*> &partitions = mFileReader->mFile->getPartitions();
         size_t i;
-        for (i = 0; i < partitions.size(); i++) {
-            if (partitions[i]->getBodySID() != gs_text->getGenericStreamSID())
+        for (i = 0; i < mxf_file->getNumPartitions(); i++) {
+            uint32_t dir_body_sid = mxf_file->getPartitionBodySID(i);
+            if (dir_body_sid != 0 && dir_body_sid != gs_text->getGenericStreamSID())
+                continue;
+            const Partition *partition = &mxf_file->getPartition(i);
+            if (partition->getBodySID() != gs_text->getGenericStreamSID())
                 continue;
 
-            if (partitions[i]->getBodyOffset() > body_size) {
+            if (partition->getBodyOffset() > body_size) {
                 log_warn("Ignoring potential missing text object generic stream data; "
                          "partition pack's BodyOffset 0x%" PRIx64 " > expected offset 0x" PRIx64 "\n",
-                         partitions[i]->getBodyOffset(), body_size);
+                         partition->getBodyOffset(), body_size);
                 continue;
-            } else if (partitions[i]->getBodyOffset() < body_size) {
+            } else if (partition->getBodyOffset() < body_size) {
                 log_warn("Ignoring overlapping or repeated text object generic stream data; "
                          "partition pack's BodyOffset 0x%" PRIx64 " < expected offset 0x" PRIx64 "\n",
-                         partitions[i]->getBodyOffset(), body_size);
+                         partition->getBodyOffset(), body_size);
                 continue;
             }
 
-            mxf_file->seek(partitions[i]->getThisPartition(), SEEK_SET);
+            mxf_file->seek(partition->getThisPartition(), SEEK_SET);
             mxf_file->readKL(&key, &llen, &len);
             mxf_file->skip(len);
 
@@ -239,13 +242,13 @@ void MXFTextObject::ReadGenericStream(FILE *text_file_out, unsigned char **data_
                 if (mxf_is_partition_pack(&key)) {
                     break;
                 } else if (mxf_is_header_metadata(&key)) {
-                    if (partitions[i]->getHeaderByteCount() > mxfKey_extlen + llen + len)
-                        mxf_file->skip(partitions[i]->getHeaderByteCount() - (mxfKey_extlen + llen));
+                    if (partition->getHeaderByteCount() > mxfKey_extlen + llen + len)
+                        mxf_file->skip(partition->getHeaderByteCount() - (mxfKey_extlen + llen));
                     else
                         mxf_file->skip(len);
                 } else if (mxf_is_index_table_segment(&key)) {
-                    if (partitions[i]->getIndexByteCount() > mxfKey_extlen + llen + len)
-                        mxf_file->skip(partitions[i]->getIndexByteCount() - (mxfKey_extlen + llen));
+                    if (partition->getIndexByteCount() > mxfKey_extlen + llen + len)
+                        mxf_file->skip(partition->getIndexByteCount() - (mxfKey_extlen + llen));
                     else
                         mxf_file->skip(len);
                 } else if (mxf_is_gs_data_element(&key)) {
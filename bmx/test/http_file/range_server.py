@@ -0,0 +1,80 @@
+#!/usr/bin/env python3
+#
+# Minimal HTTP server supporting single byte range requests, used by test_http_file.sh.
+# Serves files from <dir> and writes the listening port to <port file>.
+#
+
+import os
+import re
+import sys
+from http.server import HTTPServer, SimpleHTTPRequestHandler
+
+
+class RangeRequestHandler(SimpleHTTPRequestHandler):
+    def send_head(self):
+        path = self.translate_path(self.path)
+        if not os.path.isfile(path):
+            self.send_error(404)
+            return None
+
+        size = os.path.getsize(path)
+        first = 0
+        last = size - 1
+        status = 200
+        range_header = self.headers.get('Range')
+        if range_header:
+            match = re.match(r'bytes=(\d+)-(\d*)$', range_header)
+            if not match or int(match.group(1)) >= size:
+                self.send_error(416)
+                return None
+            first = int(match.group(1))
+            if match.group(2):
+                last = min(int(match.group(2)), size - 1)
+            status = 206
+
+        f = open(path, 'rb')
+        f.seek(first)
+        self.send_response(status)
+        self.send_header('Accept-Ranges', 'bytes')
+        self.send_header('Content-Length', str(last - first + 1))
+        if status == 206:
+            self.send_header('Content-Range', 'bytes %d-%d/%d' % (first, last, size))
+        self.end_headers()
+        self.remaining = last - first + 1
+        return f
+
+    def copyfile(self, source, outputfile):
+        while self.remaining > 0:
+            data = source.read(min(self.remaining, 65536))
+            if not data:
+                break
+            outputfile.write(data)
+            self.remaining -= len(data)
+
+    def log_message(self, format, *args):
+        pass
+
+
+class ThreadingHTTPServer(HTTPServer):
+    def process_request(self, request, client_address):
+        import threading
+        thread = threading.Thread(target=self.process_request_thread, args=(request, client_address))
+        thread.daemon = True
+        thread.start()
+
+    def process_request_thread(self, request, client_address):
+        try:
+            self.finish_request(request, client_address)
+        except Exception:
+            # clients close the connection when cancelling outstanding range requests
+            pass
+        finally:
+            self.shutdown_request(request)
+
+
+if __name__ == '__main__':
+    os.chdir(sys.argv[1])
+    server = ThreadingHTTPServer(('127.0.0.1', 0), RangeRequestHandler)
+    with open(sys.argv[2], 'w') as port_file:
+        port_file.write('%d\n' % server.server_address[1])
+    server.serve_forever()
@@ -0,0 +1,76 @@
+#!/bin/sh
+
+# Checks that reading an MXF file over HTTP using parallel range requests produces the same result as reading
+# the file from disk. A local HTTP server is started using range_server.py
+
+base=$(dirname $0)
+
+testdir=..
+appsdir=../../apps
+tmpdir=/tmp/http_file_temp$$
+
+
+if ! $appsdir/mxf2raw/mxf2raw -h 2>&1 | grep -q "http-parallel" ; then
+    # HTTP file access is not supported in this build
+    exit 77
+fi
+if ! which python3 >/dev/null 2>&1 ; then
+    exit 77
+fi
+
+
+mkdir -p $tmpdir
+
+$testdir/create_test_essence -t 11 -d 25 $tmpdir/video &&
+    $testdir/create_test_essence -t 1 -d 25 $tmpdir/audio &&
+    $appsdir/raw2bmx/raw2bmx \
+        --regtest \
+        -t op1a \
+        -f 25 \
+        -o $tmpdir/input.mxf \
+        --d10_50 $tmpdir/video \
+        -q 16 --pcm $tmpdir/audio \
+        >/dev/null
+res=$?
+
+if test $res -eq 0 ; then
+    python3 $base/range_server.py $tmpdir $tmpdir/port &
+    server_pid=$!
+    count=0
+    while test ! -s $tmpdir/port -a $count -lt 50 ; do
+        sleep 0.1
+        count=$((count + 1))
+    done
+    url=http://127.0.0.1:$(cat $tmpdir/port)/input.mxf
+
+    $appsdir/bmxtranswrap/bmxtranswrap \
+        --regtest \
+        -t op1a \
+        -o $tmpdir/disk.mxf \
+        $tmpdir/input.mxf \
+        >/dev/null &&
+    $appsdir/bmxtranswrap/bmxtranswrap \
+        --regtest \
+        -t op1a \
+        -o $tmpdir/http.mxf \
+        --http-min-read 8192 \
+        --http-parallel 4 \
+        $url \
+        >/dev/null &&
+    cmp -s $tmpdir/disk.mxf $tmpdir/http.mxf &&
+    $appsdir/mxf2raw/mxf2raw \
+        --http-min-read 8192 \
+        --http-parallel 4 \
+        --info \
+        --file-chksum md5 \
+        --check-end --check-complete \
+        $url \
+        2>/dev/null | grep -q "$($testdir/file_md5 < $tmpdir/input.mxf | cut -d ' ' -f 1)"
+    res=$?
+
+    kill $server_pid
+fi
+
+rm -Rf $tmpdir
+
+exit $res
@@ -0,0 +1,53 @@
+#!/usr/bin/env python3
+#
+# Adds a delta to the BodyOffset of a body partition pack in an MXF file, used by test_body_offset.sh to
+# create a file whose essence container offsets leave a gap or overlap. The file layout is unchanged.
+#
+# Usage: set_body_offset.py <input> <output> <body partition index> <delta> [<body partition index> <delta> ...]
+#
+
+import sys
+
+
+PARTITION_PACK_PREFIX = bytes.fromhex('060e2b34020501010d01020101')
+BODY_OFFSET_VALUE_OFFSET = 52
+
+
+def read_len(data, pos):
+    first = data[pos]
+    if first < 0x80:
+        return 1, first
+    num_bytes = first & 0x7f
+    return 1 + num_bytes, int.from_bytes(data[pos + 1:pos + 1 + num_bytes], 'big')
+
+
+def main():
+    with open(sys.argv[1], 'rb') as f:
+        data = bytearray(f.read())
+
+    deltas = {}
+    for i in range(3, len(sys.argv), 2):
+        deltas[int(sys.argv[i])] = int(sys.argv[i + 1])
+
+    count = 0
+    body_index = 0
+    pos = 0
+    while pos + 17 <= len(data):
+        llen, length = read_len(data, pos + 16)
+        if data[pos:pos + 13] == PARTITION_PACK_PREFIX and data[pos + 13] == 0x03:
+            if body_index in deltas:
+                field = pos + 16 + llen + BODY_OFFSET_VALUE_OFFSET
+                body_offset = int.from_bytes(data[field:field + 8], 'big') + deltas[body_index]
+                data[field:field + 8] = body_offset.to_bytes(8, 'big')
+                count += 1
+            body_index += 1
+        pos += 16 + llen + length
+
+    with open(sys.argv[2], 'wb') as f:
+        f.write(data)
+
+    return 0 if count == len(deltas) else 1
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,44 @@
+#!/usr/bin/env python3
+#
+# Replaces the keys of all index table segments in an MXF file with the KLV fill key, used by
+# test_build_index.sh to create a file without an index table. The file layout is unchanged.
+#
+# Usage: strip_index.py <input> <output>
+#
+
+import sys
+
+
+INDEX_SEGMENT_KEY = bytes.fromhex('060e2b34025301010d01020101100100')
+FILL_KEY = bytes.fromhex('060e2b34010101020301021001000000')
+
+
+def read_len(data, pos):
+    first = data[pos]
+    if first < 0x80:
+        return 1, first
+    num_bytes = first & 0x7f
+    return 1 + num_bytes, int.from_bytes(data[pos + 1:pos + 1 + num_bytes], 'big')
+
+
+def main():
+    with open(sys.argv[1], 'rb') as f:
+        data = bytearray(f.read())
+
+    count = 0
+    pos = 0
+    while pos + 17 <= len(data):
+        llen, length = read_len(data, pos + 16)
+        if data[pos:pos + 16] == INDEX_SEGMENT_KEY:
+            data[pos:pos + 16] = FILL_KEY
+            count += 1
+        pos += 16 + llen + length
+
+    with open(sys.argv[2], 'wb') as f:
+        f.write(data)
+
+    return 0 if count > 0 else 1
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,66 @@
+#!/bin/sh
+
+# Checks that the essence container offsets of a file with multiple body partitions are corrected when a partition
+# pack's BodyOffset leaves a gap or overlaps the previous essence data. The frames read from the modified file must
+# equal the frames read from the original file
+
+base=$(dirname $0)
+
+testdir=..
+appsdir=../../apps
+tmpdir=/tmp/body_offset_temp$$
+
+
+if ! which python3 >/dev/null 2>&1 ; then
+    exit 77
+fi
+
+
+read_frames()
+{
+    $appsdir/mxf2raw/mxf2raw \
+        --regtest \
+        --info \
+        --check-end --check-complete \
+        --start $2 --dur $3 \
+        --track-chksum md5 \
+        $1 \
+        >$tmpdir/output.txt 2>&1 &&
+        grep -E "md5|checksum" $tmpdir/output.txt
+}
+
+check_frames()
+{
+    read_frames $tmpdir/input.mxf $1 $2 > $tmpdir/original.txt &&
+        read_frames $tmpdir/modified.mxf $1 $2 > $tmpdir/modified.txt &&
+        test -s $tmpdir/original.txt &&
+        diff $tmpdir/original.txt $tmpdir/modified.txt >/dev/null
+}
+
+
+mkdir -p $tmpdir
+
+# the second body partition's BodyOffset leaves a gap and the fourth's overlaps the previous essence data
+$testdir/create_test_essence -t 11 -d 50 $tmpdir/video &&
+    $testdir/create_test_essence -t 1 -d 50 $tmpdir/audio &&
+    $appsdir/raw2bmx/raw2bmx \
+        --regtest \
+        -t op1a \
+        -f 25 \
+        --part 12 \
+        -o $tmpdir/input.mxf \
+        --d10_50 $tmpdir/video \
+        -q 16 --pcm $tmpdir/audio \
+        >/dev/null &&
+    python3 $base/set_body_offset.py $tmpdir/input.mxf $tmpdir/modified.mxf 1 1000 3 -1000 &&
+    check_frames 0 50 &&
+    grep -q "Ignoring potential missing essence container data" $tmpdir/output.txt &&
+    grep -q "Ignoring potential overlapping essence container data" $tmpdir/output.txt &&
+    check_frames 11 2 &&
+    check_frames 36 1 &&
+    check_frames 49 1
+res=$?
+
+rm -Rf $tmpdir
+
+exit $res
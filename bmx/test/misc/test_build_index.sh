@@ -0,0 +1,73 @@
+#!/bin/sh
+
+# Checks that mxf2raw --build-index rebuilds the index table of a file whose index table segments have been
+# replaced with fill. The frames read using the built index must equal the frames read using the original index,
+# and no index table is built for long GOP essence
+
+base=$(dirname $0)
+
+testdir=..
+appsdir=../../apps
+tmpdir=/tmp/build_index_temp$$
+
+
+if ! which python3 >/dev/null 2>&1 ; then
+    exit 77
+fi
+
+
+read_frames()
+{
+    $appsdir/mxf2raw/mxf2raw \
+        --check-end --check-complete \
+        --start $2 --dur $3 \
+        --track-chksum md5 \
+        $4 $1 \
+        2>&1 | grep -E "md5|checksum"
+}
+
+check_frames()
+{
+    read_frames $tmpdir/input.mxf $1 $2 > $tmpdir/index.txt &&
+        read_frames $tmpdir/noindex.mxf $1 $2 --build-index > $tmpdir/built.txt &&
+        test -s $tmpdir/index.txt &&
+        diff $tmpdir/index.txt $tmpdir/built.txt >/dev/null
+}
+
+
+mkdir -p $tmpdir
+
+# D-10 content packages contain a system, picture and sound element
+$testdir/create_test_essence -t 11 -d 25 $tmpdir/video &&
+    $testdir/create_test_essence -t 1 -d 25 $tmpdir/audio &&
+    $appsdir/raw2bmx/raw2bmx \
+        --regtest \
+        -t d10 \
+        -f 25 \
+        -o $tmpdir/input.mxf \
+        --d10_50 $tmpdir/video \
+        -q 16 --pcm $tmpdir/audio \
+        -q 16 --pcm $tmpdir/audio \
+        >/dev/null &&
+    python3 $base/strip_index.py $tmpdir/input.mxf $tmpdir/noindex.mxf &&
+    check_frames 0 25 &&
+    check_frames 0 1 &&
+    check_frames 12 1 &&
+    check_frames 24 1 &&
+    $testdir/create_test_essence -t 14 -d 24 $tmpdir/mpeg2lg &&
+    $appsdir/raw2bmx/raw2bmx \
+        --regtest \
+        -t op1a \
+        -f 25 \
+        -o $tmpdir/lg_input.mxf \
+        --mpeg2lg_422p_hl_1080i $tmpdir/mpeg2lg \
+        -q 16 --pcm $tmpdir/audio \
+        >/dev/null &&
+    python3 $base/strip_index.py $tmpdir/lg_input.mxf $tmpdir/lg_noindex.mxf &&
+    $appsdir/mxf2raw/mxf2raw --build-index --info $tmpdir/lg_noindex.mxf 2>&1 | \
+        grep -q "Not building an index table"
+res=$?
+
+rm -Rf $tmpdir
+
+exit $res
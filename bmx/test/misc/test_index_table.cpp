@@ -0,0 +1,246 @@
+/*
+ * Copyright (C) 2026, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <cstdio>
+#include <cstring>
+
+#include <memory>
+#include <vector>
+
+#include <bmx/mxf_reader/MXFFileReader.h>
+#include <bmx/BMXException.h>
+#include <bmx/Logging.h>
+
+using namespace std;
+using namespace bmx;
+using namespace mxfpp;
+
+
+
+typedef struct
+{
+    int64_t start_position;
+    int64_t duration;
+    vector<MXFIndexEntry> entries;
+} ReferenceSegment;
+
+
+
+// reads the VBE index table segments in file order using the libMXF++ parser
+static bool read_reference_segments(const char *filename, vector<ReferenceSegment> *segments)
+{
+    auto_ptr<File> file(File::openRead(filename));
+    if (!file->readPartitions()) {
+        fprintf(stderr, "Failed to read partitions\n");
+        return false;
+    }
+
+    mxfKey key;
+    uint8_t llen;
+    uint64_t len;
+    const vector<Partition*> &partitions = file->getPartitions();
+    size_t i;
+    for (i = 0; i < partitions.size(); i++) {
+        if (partitions[i]->getIndexByteCount() == 0)
+            continue;
+
+        file->seek(partitions[i]->getThisPartition(), SEEK_SET);
+        file->readKL(&key, &llen, &len);
+        file->skip(len);
+        file->readNextNonFillerKL(&key, &llen, &len);
+        if (partitions[i]->getHeaderByteCount() > 0) {
+            file->skip(partitions[i]->getHeaderByteCount() - mxfKey_extlen - llen);
+            file->readNextNonFillerKL(&key, &llen, &len);
+        }
+
+        while (IndexTableSegment::isIndexTableSegment(&key)) {
+            auto_ptr<IndexTableSegment> segment(IndexTableSegment::read(file.get(), len));
+            if (segment->getEditUnitByteCount() != 0) {
+                fprintf(stderr, "Unexpected CBE index table segment\n");
+                return false;
+            }
+
+            ReferenceSegment ref_segment;
+            ref_segment.start_position = segment->getIndexStartPosition();
+            ref_segment.duration = segment->getIndexDuration();
+            const MXFIndexEntry *entry = segment->getCIndexTableSegment()->indexEntryArray;
+            while (entry) {
+                ref_segment.entries.push_back(*entry);
+                entry = entry->next;
+            }
+            if ((int64_t)ref_segment.entries.size() < ref_segment.duration) {
+                fprintf(stderr, "Index table segment has too few entries\n");
+                return false;
+            }
+            segments->push_back(ref_segment);
+
+            if (file->tell() >= (int64_t)file->size())
+                break;
+            file->readNextNonFillerKL(&key, &llen, &len);
+        }
+    }
+
+    return true;
+}
+
+// the first segment that covers position
+static const MXFIndexEntry* find_reference_entry(const vector<ReferenceSegment> &segments, int64_t position)
+{
+    size_t i;
+    for (i = 0; i < segments.size(); i++) {
+        if (position >= segments[i].start_position &&
+            position < segments[i].start_position + segments[i].duration)
+        {
+            return &segments[i].entries[(size_t)(position - segments[i].start_position)];
+        }
+    }
+
+    return 0;
+}
+
+static bool check_index_entry(MXFTrackReader *track_reader, const vector<ReferenceSegment> &segments,
+                              int64_t duration, int64_t position)
+{
+    MXFIndexEntryExt entry;
+    if (!track_reader->GetIndexEntry(&entry, position)) {
+        fprintf(stderr, "Failed to get index entry at position %" PRId64 "\n", position);
+        return false;
+    }
+
+    const MXFIndexEntry *ref_entry = find_reference_entry(segments, position);
+    if (!ref_entry ||
+        entry.container_offset != (int64_t)ref_entry->streamOffset ||
+        entry.temporal_offset != ref_entry->temporalOffset ||
+        entry.key_frame_offset != ref_entry->keyFrameOffset ||
+        entry.flags != ref_entry->flags)
+    {
+        fprintf(stderr, "Index entry at position %" PRId64 " differs from the linear search\n", position);
+        return false;
+    }
+
+    if (position + 1 < duration) {
+        const MXFIndexEntry *next_ref_entry = find_reference_entry(segments, position + 1);
+        if (!next_ref_entry ||
+            entry.edit_unit_size != (int64_t)(next_ref_entry->streamOffset - ref_entry->streamOffset))
+        {
+            fprintf(stderr, "Edit unit size at position %" PRId64 " differs from the linear search\n", position);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static void print_usage(const char* cmd)
+{
+    fprintf(stderr, "Usage: %s <mxf filename>\n", cmd);
+    fprintf(stderr, "Checks the index entries found by the reader's segment search against a linear search\n");
+    fprintf(stderr, "The file must have more than 1 VBE index table segment\n");
+}
+
+int main(int argc, const char **argv)
+{
+    if (argc != 2) {
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    const char *filename = argv[1];
+
+    try
+    {
+        vector<ReferenceSegment> segments;
+        if (!read_reference_segments(filename, &segments))
+            return 1;
+        if (segments.size() < 2) {
+            fprintf(stderr, "File has less than 2 index table segments\n");
+            return 1;
+        }
+
+        MXFFileReader file_reader;
+        if (file_reader.Open(filename) != MXFFileReader::MXF_RESULT_SUCCESS) {
+            fprintf(stderr, "Failed to open file '%s'\n", filename);
+            return 1;
+        }
+        MXFTrackReader *track_reader = file_reader.GetTrackReader(0);
+        int64_t duration = track_reader->GetDuration();
+        if (duration <= 0) {
+            fprintf(stderr, "File has no duration\n");
+            return 1;
+        }
+
+        // the positions are visited in an order that uses the last segment, the next segment and the
+        // segment search: the first and last edit unit, each segment boundary, forwards, backwards and
+        // pseudo-random positions
+        vector<int64_t> positions;
+        positions.push_back(duration - 1);
+        positions.push_back(0);
+        size_t i;
+        for (i = 0; i < segments.size(); i++) {
+            int64_t end = segments[i].start_position + segments[i].duration;
+            if (segments[i].start_position > 0)
+                positions.push_back(segments[i].start_position - 1);
+            positions.push_back(segments[i].start_position);
+            positions.push_back(end - 1);
+            if (end < duration)
+                positions.push_back(end);
+        }
+        int64_t position;
+        for (position = 0; position < duration; position++)
+            positions.push_back(position);
+        for (position = duration - 1; position >= 0; position--)
+            positions.push_back(position);
+        uint32_t random = 12345;
+        for (i = 0; i < (size_t)duration; i++) {
+            random = random * 1103515245 + 12345;
+            positions.push_back((random >> 8) % duration);
+        }
+
+        for (i = 0; i < positions.size(); i++) {
+            if (!check_index_entry(track_reader, segments, duration, positions[i]))
+                return 1;
+        }
+    }
+    catch (const MXFException &ex)
+    {
+        fprintf(stderr, "MXF exception: %s\n", ex.getMessage().c_str());
+        return 1;
+    }
+    catch (const BMXException &ex)
+    {
+        fprintf(stderr, "BMX exception: %s\n", ex.what());
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,29 @@
+#!/bin/sh
+
+# Checks the index entries found for a file with multiple VBE index table segments against a linear search
+# through the segments. The last segment is shorter than the others
+
+testdir=..
+appsdir=../../apps
+tmpdir=/tmp/index_table_temp$$
+
+
+mkdir -p $tmpdir
+
+$testdir/create_test_essence -t 14 -d 50 $tmpdir/video &&
+    $testdir/create_test_essence -t 1 -d 50 $tmpdir/audio &&
+    $appsdir/raw2bmx/raw2bmx \
+        --regtest \
+        -t op1a \
+        -f 25 \
+        --part 12 \
+        -o $tmpdir/input.mxf \
+        --mpeg2lg_422p_hl_1080i $tmpdir/video \
+        -q 16 --pcm $tmpdir/audio \
+        >/dev/null &&
+    ./test_index_table $tmpdir/input.mxf
+res=$?
+
+rm -Rf $tmpdir
+
+exit $res
@@ -0,0 +1,191 @@
+/*
+ * Copyright (C) 2026, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <cstdio>
+#include <cstring>
+
+#include <vector>
+
+#include <bmx/mxf_reader/MXFFileReader.h>
+#include <bmx/frame/MMapFrame.h>
+#include <bmx/BMXException.h>
+#include <bmx/Logging.h>
+
+#include <mxf/mxf_mmap_file.h>
+
+using namespace std;
+using namespace bmx;
+using namespace mxfpp;
+
+
+// larger than a picture frame in the test file, so that picture frames fit inside a window or cross its end
+#define LARGE_WINDOW_SIZE   (1024 * 1024)
+
+
+
+static void delete_frames(vector<Frame*> *frames)
+{
+    size_t i;
+    for (i = 0; i < frames->size(); i++)
+        delete (*frames)[i];
+    frames->clear();
+}
+
+// reads all frames, using mapped frames if window_size is not 0. The frames are kept until all have been read so
+// that frames referencing windows that have since been unmapped are checked as well
+static bool read_frames(const char *filename, uint32_t window_size, vector<Frame*> *frames)
+{
+    MXFFileReader file_reader;
+    MXFFileReader::OpenResult result;
+    if (window_size > 0) {
+        MXFFile *mxf_file;
+        if (!mxf_mmap_file_open_read(filename, MXF_MMAP_FLAG_DEFAULT, window_size, &mxf_file)) {
+            fprintf(stderr, "Failed to open memory-mapped file '%s'\n", filename);
+            return false;
+        }
+        File *file = new File(mxf_file);
+        result = file_reader.Open(file, filename);
+        if (result != MXFFileReader::MXF_RESULT_SUCCESS)
+            delete file;
+    } else {
+        result = file_reader.Open(filename);
+    }
+    if (result != MXFFileReader::MXF_RESULT_SUCCESS) {
+        fprintf(stderr, "Failed to open file '%s'\n", filename);
+        return false;
+    }
+
+    size_t i;
+    if (window_size > 0) {
+        for (i = 0; i < file_reader.GetNumTrackReaders(); i++)
+            file_reader.GetTrackReader(i)->GetFrameBuffer()->SetFrameFactory(new MMapFrameFactory(), true);
+    }
+
+    while (file_reader.Read(1) == 1) {
+        for (i = 0; i < file_reader.GetNumTrackReaders(); i++) {
+            Frame *frame = file_reader.GetTrackReader(i)->GetFrameBuffer()->GetLastFrame(true);
+            if (!frame) {
+                fprintf(stderr, "Missing frame for track %" PRIszt "\n", i);
+                return false;
+            }
+            frames->push_back(frame);
+
+            MMapFrame *mmap_frame = dynamic_cast<MMapFrame*>(frame);
+            if (window_size > 0 && (!mmap_frame || !mmap_frame->IsMapped())) {
+                fprintf(stderr, "Frame %" PRIszt " was not read into a mapped frame\n", frames->size() - 1);
+                return false;
+            }
+        }
+    }
+    if (frames->empty() || frames->size() != file_reader.GetNumTrackReaders() * (size_t)file_reader.GetDuration()) {
+        fprintf(stderr, "Failed to read all frames\n");
+        return false;
+    }
+
+    return true;
+}
+
+static bool compare_frames(const vector<Frame*> &frames, const vector<Frame*> &mapped_frames, uint32_t window_size)
+{
+    if (mapped_frames.size() != frames.size()) {
+        fprintf(stderr, "Read %" PRIszt " mapped frames instead of %" PRIszt "\n",
+                mapped_frames.size(), frames.size());
+        return false;
+    }
+
+    size_t i;
+    for (i = 0; i < frames.size(); i++) {
+        if (mapped_frames[i]->GetSize() != frames[i]->GetSize() ||
+            memcmp(mapped_frames[i]->GetBytes(), frames[i]->GetBytes(), frames[i]->GetSize()) != 0)
+        {
+            fprintf(stderr, "Mapped frame %" PRIszt " differs from the read frame (window size %u)\n",
+                    i, window_size);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static void print_usage(const char* cmd)
+{
+    fprintf(stderr, "Usage: %s <mxf filename>\n", cmd);
+    fprintf(stderr, "Checks that the frames read through memory-mapped frames equal the frames read normally\n");
+    fprintf(stderr, "The file must have picture frames that are larger than a system page and less than 1MB\n");
+}
+
+int main(int argc, const char **argv)
+{
+    if (argc != 2) {
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    const char *filename = argv[1];
+
+    // a window of 1 page is smaller than each picture frame and so every picture frame extends beyond the
+    // window. The larger window has picture frames that fit inside it and picture frames that cross its end
+    uint32_t window_sizes[2];
+    window_sizes[0] = mxf_get_system_page_size();
+    window_sizes[1] = LARGE_WINDOW_SIZE;
+
+    bool result = true;
+    vector<Frame*> frames;
+    vector<Frame*> mapped_frames;
+    try
+    {
+        result = read_frames(filename, 0, &frames);
+
+        size_t i;
+        for (i = 0; result && i < sizeof(window_sizes) / sizeof(window_sizes[0]); i++) {
+            result = read_frames(filename, window_sizes[i], &mapped_frames) &&
+                     compare_frames(frames, mapped_frames, window_sizes[i]);
+            delete_frames(&mapped_frames);
+        }
+    }
+    catch (const MXFException &ex)
+    {
+        fprintf(stderr, "MXF exception: %s\n", ex.getMessage().c_str());
+        result = false;
+    }
+    catch (const BMXException &ex)
+    {
+        fprintf(stderr, "BMX exception: %s\n", ex.what());
+        result = false;
+    }
+
+    delete_frames(&frames);
+    delete_frames(&mapped_frames);
+
+    return result ? 0 : 1;
+}
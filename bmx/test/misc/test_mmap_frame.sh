@@ -0,0 +1,28 @@
+#!/bin/sh
+
+# Checks that the frames read through memory-mapped frames equal the frames read normally, including frames that
+# extend beyond the end of the current memory-mapped window
+
+testdir=..
+appsdir=../../apps
+tmpdir=/tmp/mmap_frame_temp$$
+
+
+mkdir -p $tmpdir
+
+$testdir/create_test_essence -t 11 -d 50 $tmpdir/video &&
+    $testdir/create_test_essence -t 1 -d 50 $tmpdir/audio &&
+    $appsdir/raw2bmx/raw2bmx \
+        --regtest \
+        -t op1a \
+        -f 25 \
+        -o $tmpdir/input.mxf \
+        --d10_50 $tmpdir/video \
+        -q 16 --pcm $tmpdir/audio \
+        >/dev/null &&
+    ./test_mmap_frame $tmpdir/input.mxf
+res=$?
+
+rm -Rf $tmpdir
+
+exit $res
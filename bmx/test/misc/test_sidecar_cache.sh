@@ -0,0 +1,118 @@
+#!/bin/sh
+
+# Checks that mxf2raw --sidecar-cache uses a valid sidecar cache file, rejects the cache file of an MXF file that
+# was modified since the cache was written and ignores a truncated or corrupt cache file. The output must always
+# equal the output without a cache. Writing the cache file must not load partition packs that reading the file
+# skipped and concurrent readers must be able to write the cache file at the same time
+
+testdir=..
+appsdir=../../apps
+tmpdir=/tmp/sidecar_cache_temp$$
+
+
+if ! which python3 >/dev/null 2>&1 ; then
+    exit 77
+fi
+
+
+read_file()
+{
+    $appsdir/mxf2raw/mxf2raw \
+        --regtest \
+        --log-level 0 \
+        --info \
+        --track-chksum md5 \
+        $1 $tmpdir/input.mxf \
+        >$tmpdir/output.txt &&
+        sed '/^LogMessages:/,$d' $tmpdir/output.txt >$tmpdir/$2
+}
+
+check_cached()
+{
+    read_file --sidecar-cache cached.txt &&
+        diff $tmpdir/uncached.txt $tmpdir/cached.txt >/dev/null &&
+        test -s $tmpdir/input.mxf.bmxcache &&
+        { test -z "$1" || grep -q "$1" $tmpdir/output.txt; }
+}
+
+check_partitions_skipped()
+{
+    sed -n 's/.*Read \([0-9]*\) of \([0-9]*\) partition packs.*/\1 \2/p' $tmpdir/output.txt |
+        { read num_read num_total && test $num_read -lt $num_total; }
+}
+
+read_concurrently()
+{
+    for n in 1 2 3 4; do
+        { $appsdir/mxf2raw/mxf2raw \
+            --regtest \
+            --info \
+            --track-chksum md5 \
+            --sidecar-cache $tmpdir/input.mxf \
+            >$tmpdir/concurrent$n.txt
+          echo $? >$tmpdir/concurrent$n.res; } &
+    done
+    wait
+    for n in 1 2 3 4; do
+        test "`cat $tmpdir/concurrent$n.res`" = 0 &&
+            sed '/^LogMessages:/,$d' $tmpdir/concurrent$n.txt | diff $tmpdir/uncached.txt - >/dev/null ||
+            return 1
+    done
+}
+
+modify_file()
+{
+    python3 -c "
+import sys
+with open(sys.argv[1], 'r+b') as f:
+    f.seek(int(sys.argv[2]))
+    byte = f.read(1)
+    f.seek(int(sys.argv[2]))
+    f.write(bytes([byte[0] ^ 0xff]))
+" $1 $2
+}
+
+
+mkdir -p $tmpdir
+
+# the essence is large enough for a modification in the middle of the file to be outside the
+# start and end of the file that are included in the cache's digest. The XML is embedded in a generic
+# stream partition that reading the file doesn't need
+$testdir/create_test_essence -t 4 -d 100 $tmpdir/video &&
+    $testdir/create_test_essence -t 1 -d 100 $tmpdir/audio &&
+    python3 -c "print('<test>' + 'x' * 70000 + '</test>')" >$tmpdir/test.xml &&
+    $appsdir/raw2bmx/raw2bmx \
+        --regtest \
+        -t op1a \
+        -f 25 \
+        -o $tmpdir/input.mxf \
+        --embed-xml $tmpdir/test.xml \
+        --dv50 $tmpdir/video \
+        -q 16 --pcm $tmpdir/audio \
+        >/dev/null &&
+    read_file "" uncached.txt &&
+    test -s $tmpdir/uncached.txt &&
+    check_partitions_skipped &&
+    check_cached "" &&
+    check_partitions_skipped &&
+    check_cached "Using sidecar cache file" &&
+    modify_file $tmpdir/input.mxf 2000000 &&
+    read_file "" uncached.txt &&
+    check_cached "is out of date" &&
+    check_cached "Using sidecar cache file" &&
+    python3 -c "import os, sys; os.truncate(sys.argv[1], os.path.getsize(sys.argv[1]) // 2)" \
+        $tmpdir/input.mxf.bmxcache &&
+    check_cached "Failed to read sidecar cache file" &&
+    check_cached "Using sidecar cache file" &&
+    modify_file $tmpdir/input.mxf.bmxcache 0 &&
+    check_cached "has an unknown format" &&
+    check_cached "Using sidecar cache file" &&
+    rm $tmpdir/input.mxf.bmxcache &&
+    read_concurrently &&
+    check_cached "Using sidecar cache file" &&
+    test -z "`ls $tmpdir | grep bmxcache.tmp`"
+res=$?
+
+rm -Rf $tmpdir
+
+exit $res
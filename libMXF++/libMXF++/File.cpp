@@ -118,6 +118,8 @@ File::File(::MXFFile *cFile)
     _cMemoryFile = 0;
     _firstMemoryPartitionIndex = (size_t)(-1);
     _lastMemoryPartitionIndex = (size_t)(-1);
+    _numUnloadedPartitions = 0;
+    _partitionPackReadCount = 0;
 }
 
 File::~File()
@@ -145,6 +147,8 @@ Partition& File::createPartition()
     Partition *previousPartition = 0;
     Partition *partition = 0;
 
+    loadPartitions();
+
     if (_partitions.size() > 0)
     {
         previousPartition = _partitions.back();
@@ -163,6 +167,8 @@ Partition& File::createPartition()
 
 void File::writeRIP()
 {
+    loadPartitions();
+
     PartitionList partitionList(_partitions);
 
     MXFPP_CHECK(mxf_write_rip(_cFile, partitionList.getList()));
@@ -184,6 +190,9 @@ void File::updatePartitions()
 void File::updateBodyPartitions(const mxfKey *pp_key)
 {
     size_t firstIndex, lastIndex;
+
+    loadPartitions();
+
     if (_cMemoryFile) {
         firstIndex = _firstMemoryPartitionIndex;
         if (_lastMemoryPartitionIndex == (size_t)(-1) || _lastMemoryPartitionIndex >= _partitions.size())
@@ -225,6 +234,9 @@ void File::updateBodyPartitions(const mxfKey *pp_key)
 void File::updateGenericStreamPartitions()
 {
     size_t firstIndex, lastIndex;
+
+    loadPartitions();
+
     if (_cMemoryFile) {
         firstIndex = _firstMemoryPartitionIndex;
         if (_lastMemoryPartitionIndex == (size_t)(-1) || _lastMemoryPartitionIndex >= _partitions.size())
@@ -259,6 +271,8 @@ void File::updateGenericStreamPartitions()
 
 void File::updatePartitions(size_t rewriteFirstIndex, size_t rewriteLastIndex)
 {
+    loadPartitions();
+
     PartitionList completePartitionList(_partitions);
     mxf_update_partitions_in_memory(completePartitionList.getList());
 
@@ -269,19 +283,58 @@ void File::updatePartitions(size_t rewriteFirstIndex, size_t rewriteLastIndex)
 Partition& File::getPartition(size_t index)
 {
     MXFPP_ASSERT(index < _partitions.size());
+    if (!_partitions[index])
+        loadPartition(index);
+
     return *_partitions[index];
 }
 
+const vector<Partition*>& File::getPartitions()
+{
+    loadPartitions();
+
+    return _partitions;
+}
+
+const vector<Partition*>& File::getPartitions() const
+{
+    // loading the partition packs listed in the RIP doesn't change the logical state of the file
+    const_cast<File*>(this)->loadPartitions();
+
+    return _partitions;
+}
+
+uint64_t File::getPartitionOffset(size_t index) const
+{
+    MXFPP_ASSERT(index < _partitions.size());
+    if (_partitions[index])
+        return _partitions[index]->getThisPartition();
+    else
+        return _partitionDirectory[index].thisPartition;
+}
+
+uint32_t File::getPartitionBodySID(size_t index) const
+{
+    MXFPP_ASSERT(index < _partitions.size());
+    if (_partitions[index])
+        return _partitions[index]->getBodySID();
+    else
+        return _partitionDirectory[index].bodySID;
+}
+
+bool File::isPartitionLoaded(size_t index) const
+{
+    MXFPP_ASSERT(index < _partitions.size());
+    return _partitions[index] != 0;
+}
+
 bool File::readHeaderPartition()
 {
     mxfKey key;
     uint8_t llen;
     uint64_t len;
 
-    size_t i;
-    for (i = 0; i < _partitions.size(); i++)
-        delete _partitions[i];
-    _partitions.clear();
+    clearPartitions(0);
 
     try
     {
@@ -290,20 +343,19 @@ bool File::readHeaderPartition()
             return false;
 
         _partitions.push_back(Partition::read(this, &key, len));
+        _partitionPackReadCount++;
         // file is positioned after the partition pack
 
         return true;
     }
     catch (...)
     {
-        for (i = 0; i < _partitions.size(); i++)
-            delete _partitions[i];
-        _partitions.clear();
+        clearPartitions(0);
         return false;
     }
 }
 
-bool File::readPartitions()
+bool File::readPartitions(bool lazy)
 {
     mxfKey key;
     uint8_t llen;
@@ -316,18 +368,13 @@ bool File::readPartitions()
 
     // read the header partition if not already done so and clear the partition list
 
-    if ((!_partitions.empty() && _partitions[0]->isHeader()) ||
+    if ((!_partitions.empty() && _partitions[0] && _partitions[0]->isHeader()) ||
         readHeaderPartition())
     {
         header_partition = _partitions[0];
     }
 
-    size_t i;
-    for (i = 0; i < _partitions.size(); i++) {
-        if (_partitions[i] != header_partition)
-            delete _partitions[i];
-    }
-    _partitions.clear();
+    clearPartitions(header_partition);
 
     if (!header_partition)
         return false;
@@ -341,15 +388,31 @@ bool File::readPartitions()
             {
                 _partitions.push_back(header_partition);
 
-                mxf_initialise_list_iter(&iter, &rip.entries);
-                while (mxf_next_list_iter_element(&iter)) {
-                    rip_entry = (MXFRIPEntry*)mxf_get_iter_element(&iter);
-                    if (rip_entry->thisPartition <= header_partition->getThisPartition())
-                        continue;
-
-                    seek(mxf_get_runin_len(_cFile) + rip_entry->thisPartition, SEEK_SET);
-                    readKL(&key, &llen, &len);
-                    _partitions.push_back(Partition::read(this, &key, len));
+                if (lazy) {
+                    try
+                    {
+                        readPartitionDirectory(&rip, header_partition);
+                    }
+                    catch (...)
+                    {
+                        mxf_log_warn("Invalid partition offsets in RIP; reading all partition packs\n");
+                        clearPartitions(header_partition);
+                        _partitions.push_back(header_partition);
+                        lazy = false;
+                    }
+                }
+                if (!lazy) {
+                    mxf_initialise_list_iter(&iter, &rip.entries);
+                    while (mxf_next_list_iter_element(&iter)) {
+                        rip_entry = (MXFRIPEntry*)mxf_get_iter_element(&iter);
+                        if (rip_entry->thisPartition <= header_partition->getThisPartition())
+                            continue;
+
+                        seek(mxf_get_runin_len(_cFile) + rip_entry->thisPartition, SEEK_SET);
+                        readKL(&key, &llen, &len);
+                        _partitions.push_back(Partition::read(this, &key, len));
+                        _partitionPackReadCount++;
+                    }
                 }
 
                 mxf_clear_rip(&rip);
@@ -381,6 +444,7 @@ bool File::readPartitions()
                 seek(mxf_get_runin_len(_cFile) + this_partition, SEEK_SET);
                 readKL(&key, &llen, &len);
                 _partitions.push_back(Partition::read(this, &key, len));
+                _partitionPackReadCount++;
 
                 this_partition = _partitions.back()->getPreviousPartition();
             }
@@ -397,11 +461,7 @@ bool File::readPartitions()
     }
     catch (...)
     {
-        for (i = 0; i < _partitions.size(); i++) {
-            if (_partitions[i] != header_partition)
-                delete _partitions[i];
-        }
-        _partitions.clear();
+        clearPartitions(header_partition);
 
         // restore the header partition to the list
         _partitions.push_back(header_partition);
@@ -412,7 +472,19 @@ bool File::readPartitions()
 
 void File::readNextPartition(const mxfKey *key, uint64_t len)
 {
-    _partitions.push_back(Partition::read(this, key, len));
+    appendPartition(Partition::read(this, key, len));
+    _partitionPackReadCount++;
+}
+
+void File::appendPartition(Partition *partition)
+{
+    _partitions.push_back(partition);
+    if (!_partitionDirectory.empty()) {
+        MXFRIPEntry entry;
+        entry.bodySID       = partition->getBodySID();
+        entry.thisPartition = partition->getThisPartition();
+        _partitionDirectory.push_back(entry);
+    }
 }
 
 uint8_t File::readUInt8()
@@ -675,3 +747,80 @@ void File::closeMemoryFile()
     return ret;
 }
 
+void File::readPartitionDirectory(const MXFRIP *rip, Partition *header_partition)
+{
+    MXFRIPEntry *rip_entry;
+    MXFListIterator iter;
+
+    // only record the RIP entries in the partition directory. The partition packs are read when first
+    // accessed through getPartition or getPartitions
+    MXFRIPEntry header_entry;
+    header_entry.bodySID       = header_partition->getBodySID();
+    header_entry.thisPartition = header_partition->getThisPartition();
+    _partitionDirectory.push_back(header_entry);
+
+    // cheap checks that the RIP is consistent with the file in place of reading every partition pack
+    int64_t file_size = size() - mxf_get_runin_len(_cFile);
+    mxf_initialise_list_iter(&iter, &rip->entries);
+    while (mxf_next_list_iter_element(&iter)) {
+        rip_entry = (MXFRIPEntry*)mxf_get_iter_element(&iter);
+        if (rip_entry->thisPartition <= header_partition->getThisPartition())
+            continue;
+
+        MXFPP_CHECK(rip_entry->thisPartition > _partitionDirectory.back().thisPartition);
+        MXFPP_CHECK(file_size < 0 || rip_entry->thisPartition < (uint64_t)file_size);
+        _partitions.push_back(0);
+        _partitionDirectory.push_back(*rip_entry);
+        _numUnloadedPartitions++;
+    }
+
+    // check the last partition, usually the footer, can be read and links back to the previous RIP entry
+    if (_partitions.size() > 1) {
+        loadPartition(_partitions.size() - 1);
+        MXFPP_CHECK(_partitions.back()->getPreviousPartition() ==
+                        _partitionDirectory[_partitionDirectory.size() - 2].thisPartition);
+    }
+}
+
+void File::loadPartition(size_t index)
+{
+    mxfKey key;
+    uint8_t llen;
+    uint64_t len;
+
+    MXFPP_ASSERT(index < _partitionDirectory.size() && !_partitions[index]);
+
+    // restore the file position afterwards because the partition can be loaded in the middle of other reads
+    int64_t original_pos = tell();
+
+    seek(mxf_get_runin_len(_cFile) + _partitionDirectory[index].thisPartition, SEEK_SET);
+    readKL(&key, &llen, &len);
+    MXFPP_CHECK(mxf_is_partition_pack(&key));
+    _partitions[index] = Partition::read(this, &key, len);
+    _partitionPackReadCount++;
+    _numUnloadedPartitions--;
+
+    seek(original_pos, SEEK_SET);
+}
+
+void File::loadPartitions()
+{
+    size_t i;
+    for (i = 0; i < _partitions.size() && _numUnloadedPartitions > 0; i++) {
+        if (!_partitions[i])
+            loadPartition(i);
+    }
+}
+
+void File::clearPartitions(Partition *keepPartition)
+{
+    size_t i;
+    for (i = 0; i < _partitions.size(); i++) {
+        if (_partitions[i] != keepPartition)
+            delete _partitions[i];
+    }
+    _partitions.clear();
+    _partitionDirectory.clear();
+    _numUnloadedPartitions = 0;
+}
+
@@ -68,11 +68,19 @@ public:
     void updatePartitions(size_t rewriteFirstIndex, size_t rewriteLastIndex);
 
     Partition& getPartition(size_t index);
-    const std::vector<Partition*>& getPartitions() const { return _partitions; }
+    const std::vector<Partition*>& getPartitions();
+    const std::vector<Partition*>& getPartitions() const;
+
+    size_t getNumPartitions() const { return _partitions.size(); }
+    uint64_t getPartitionOffset(size_t index) const;
+    uint32_t getPartitionBodySID(size_t index) const;
+    bool isPartitionLoaded(size_t index) const;
+    size_t getPartitionPackReadCount() const { return _partitionPackReadCount; }
 
     bool readHeaderPartition();
-    bool readPartitions();
+    bool readPartitions(bool lazy = false);
     void readNextPartition(const mxfKey *key, uint64_t len);
+    void appendPartition(Partition *partition);
 
     uint8_t readUInt8();
     uint16_t readUInt16();
@@ -134,8 +142,17 @@ public:
 
     ::MXFFile* getCFile() const { return _cFile; }
 
+private:
+    void readPartitionDirectory(const MXFRIP *rip, Partition *header_partition);
+    void loadPartition(size_t index);
+    void loadPartitions();
+    void clearPartitions(Partition *keepPartition);
+
 private:
     std::vector<Partition*> _partitions;
+    std::vector<MXFRIPEntry> _partitionDirectory;  // RIP entries for lazily loaded partitions
+    size_t _numUnloadedPartitions;
+    size_t _partitionPackReadCount;
 
     ::MXFFile *_cFile;
     ::MXFFile *_cOriginalFile;
@@ -62,23 +62,26 @@ HeaderMetadata::HeaderMetadata(::MXFHeaderMetadata *c_header_metadata, bool take
     initialiseObjectFactory();
     _cHeaderMetadata = c_header_metadata;
     _ownCHeaderMetadata = take_ownership;
+    _objectDirectory.reserve(mxf_get_list_length(&_cHeaderMetadata->sets));
 
     _dataModel = new DataModel(_cHeaderMetadata->dataModel, false);
 }
 
 HeaderMetadata::~HeaderMetadata()
 {
-    map<mxfKey, AbsMetadataSetFactory*>::iterator iter1;
-    for (iter1 = _objectFactory.begin(); iter1 != _objectFactory.end(); iter1++)
+    size_t i;
+
+    vector<AbsMetadataSetFactory*> factories = _objectFactory.getValues();
+    for (i = 0; i < factories.size(); i++)
     {
-        delete (*iter1).second;
+        delete factories[i];
     }
 
-    map<mxfUUID, MetadataSet*>::iterator iter2;
-    for (iter2 = _objectDirectory.begin(); iter2 != _objectDirectory.end(); iter2++)
+    vector<MetadataSet*> sets = _objectDirectory.getValues();
+    for (i = 0; i < sets.size(); i++)
     {
-        (*iter2).second->_headerMetadata = 0; // break containment link
-        delete (*iter2).second;
+        sets[i]->_headerMetadata = 0; // break containment link
+        delete sets[i];
     }
 
     if (_ownCHeaderMetadata)
@@ -111,16 +114,15 @@ void HeaderMetadata::disableGenerationUIDInit()
     _initGenerationUID = false;
 }
 
+void HeaderMetadata::setLazyRead(bool enable)
+{
+    mxf_set_lazy_header_metadata_read(_cHeaderMetadata, enable);
+}
+
 void HeaderMetadata::registerObjectFactory(const mxfKey *key, AbsMetadataSetFactory *factory)
 {
-    pair<map<mxfKey, AbsMetadataSetFactory*>::iterator, bool> result =
-        _objectFactory.insert(pair<mxfKey, AbsMetadataSetFactory*>(*key, factory));
-    if (result.second == false)
-    {
-        // replace existing factory with new one
-        _objectFactory.erase(result.first);
-        _objectFactory.insert(pair<mxfKey, AbsMetadataSetFactory*>(*key, factory));
-    }
+    // replaces an existing factory
+    _objectFactory.replace(*key, factory);
 }
 
 void HeaderMetadata::registerPrimerEntry(const mxfUID *itemKey, mxfLocalTag newTag, mxfLocalTag *assignedTag)
@@ -132,6 +134,9 @@ void HeaderMetadata::read(File *file, Partition *partition, const mxfKey *key, u
 {
     MXFPP_CHECK(mxf_read_header_metadata(file->getCFile(), _cHeaderMetadata,
                                          partition->getCPartition()->headerByteCount, key, llen, len));
+
+    // avoid rehashing as the sets are wrapped
+    _objectDirectory.reserve(mxf_get_list_length(&_cHeaderMetadata->sets));
 }
 
 void HeaderMetadata::write(File *file, Partition *partition, FillerWriter *filler)
@@ -164,7 +169,7 @@ Preface* HeaderMetadata::getPreface()
 
 void HeaderMetadata::add(MetadataSet *set)
 {
-    _objectDirectory.insert(pair<mxfUUID, MetadataSet*>(set->getCMetadataSet()->instanceUID, set));
+    _objectDirectory.insert(set->getCMetadataSet()->instanceUID, set);
     if (_initGenerationUID)
     {
         InterchangeObjectBase *interchangeObject = dynamic_cast<InterchangeObjectBase*>(set);
@@ -182,7 +187,7 @@ void HeaderMetadata::moveToEnd(MetadataSet *set)
         MXFPP_CHECK(mxf_remove_set(_cHeaderMetadata, set->getCMetadataSet()));
     }
     MXFPP_CHECK(mxf_add_set(_cHeaderMetadata, set->getCMetadataSet()));
-    _objectDirectory.insert(pair<mxfUUID, MetadataSet*>(set->getCMetadataSet()->instanceUID, set));
+    _objectDirectory.insert(set->getCMetadataSet()->instanceUID, set);
 }
 
 MetadataSet* HeaderMetadata::wrap(::MXFMetadataSet *cMetadataSet)
@@ -192,32 +197,32 @@ MetadataSet* HeaderMetadata::wrap(::MXFMetadataSet *cMetadataSet)
 
     MetadataSet *set = 0;
 
-    map<mxfUUID, MetadataSet*>::const_iterator objIter;
-    objIter = _objectDirectory.find(cMetadataSet->instanceUID);
-    if (objIter != _objectDirectory.end())
+    MetadataSet **existingSet = _objectDirectory.find(cMetadataSet->instanceUID);
+    if (existingSet)
     {
-        set = (*objIter).second;
+        set = *existingSet;
 
         if (cMetadataSet != set->getCMetadataSet())
         {
             mxf_log(MXF_WLOG, "Metadata set with same instance UUID found when creating "
                 "C++ object. Changing wrapped C metadata set.");
             set->_cMetadataSet = cMetadataSet;
+            set->_slotItems.clear();
         }
     }
     else
     {
-        map<mxfKey, AbsMetadataSetFactory*>::iterator iter;
+        AbsMetadataSetFactory **factory;
 
         ::MXFSetDef *setDef = 0;
         MXFPP_CHECK(mxf_find_set_def(_cHeaderMetadata->dataModel, &cMetadataSet->key, &setDef));
 
         while (setDef != 0)
         {
-            iter = _objectFactory.find(setDef->key);
-            if (iter != _objectFactory.end())
+            factory = _objectFactory.find(setDef->key);
+            if (factory)
             {
-                set = (*iter).second->create(this, cMetadataSet);
+                set = (*factory)->create(this, cMetadataSet);
                 break;
             }
             else
@@ -256,8 +261,7 @@ MetadataSet* HeaderMetadata::createAndWrap(const mxfKey *key)
 void HeaderMetadata::initialiseObjectFactory()
 {
 #define REGISTER_CLASS(className) \
-    _objectFactory.insert(pair<mxfKey, AbsMetadataSetFactory*>( \
-        className::setKey, new MetadataSetFactory<className>()));
+    _objectFactory.insert(className::setKey, new MetadataSetFactory<className>());
 
 
     REGISTER_CLASS(InterchangeObject);
@@ -315,12 +319,7 @@ void HeaderMetadata::initialiseObjectFactory()
 
 void HeaderMetadata::remove(MetadataSet *set)
 {
-    map<mxfUUID, MetadataSet*>::iterator objIter;
-    objIter = _objectDirectory.find(set->getCMetadataSet()->instanceUID);
-    if (objIter != _objectDirectory.end())
-    {
-        _objectDirectory.erase(objIter);
-    }
+    _objectDirectory.erase(set->getCMetadataSet()->instanceUID);
     // TODO: throw exception or log warning if set not in there?
 }
 
@@ -34,6 +34,7 @@
 
 #include <map>
 
+#include <libMXF++/KeyHashMap.h>
 #include <libMXF++/File.h>
 #include <libMXF++/DataModel.h>
 
@@ -66,6 +67,9 @@ public:
     void enableGenerationUIDInit(mxfUUID generationUID);
     void disableGenerationUIDInit();
 
+    // sets are read with only the key and InstanceUID decoded and the items are decoded on first access
+    void setLazyRead(bool enable);
+
 
     void registerObjectFactory(const mxfKey *key, AbsMetadataSetFactory *factory);
 
@@ -97,11 +101,11 @@ private:
 
     DataModel *_dataModel;
 
-    std::map<mxfKey, AbsMetadataSetFactory*> _objectFactory;
+    KeyHashMap<mxfKey, AbsMetadataSetFactory*> _objectFactory;
 
     ::MXFHeaderMetadata* _cHeaderMetadata;
     bool _ownCHeaderMetadata;
-    std::map<mxfUUID, MetadataSet*> _objectDirectory;
+    KeyHashMap<mxfUUID, MetadataSet*> _objectDirectory;
     bool _busyDestructing;
 
     bool _initGenerationUID;
@@ -0,0 +1,248 @@
+/*
+ * Copyright (C) 2017, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Author: Philip de Nier
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef MXFPP_KEY_HASH_MAP_H_
+#define MXFPP_KEY_HASH_MAP_H_
+
+#include <cstring>
+#include <vector>
+
+#include <mxf/mxf_types.h>
+
+
+
+namespace mxfpp
+{
+
+
+// Open addressing hash map for fixed size byte array keys, e.g. mxfKey and mxfUUID
+template <class KeyType, class ValueType>
+class KeyHashMap
+{
+public:
+    KeyHashMap()
+    : _used(0)
+    {}
+
+    void reserve(size_t count)
+    {
+        resize(count + count / 3 + 1);
+    }
+
+    // returns false and leaves the existing value if the key is already present
+    bool insert(const KeyType &key, ValueType value)
+    {
+        if (find(key))
+        {
+            return false;
+        }
+
+        resize(_used + 1 + (_used + 1) / 3 + 1);
+        insertEntry(key, value);
+        _used++;
+
+        return true;
+    }
+
+    void replace(const KeyType &key, ValueType value)
+    {
+        ValueType *existing = find(key);
+        if (existing)
+        {
+            *existing = value;
+        }
+        else
+        {
+            insert(key, value);
+        }
+    }
+
+    ValueType* find(const KeyType &key)
+    {
+        size_t index;
+        if (!findIndex(key, &index))
+        {
+            return 0;
+        }
+
+        return &_entries[index].value;
+    }
+
+    bool erase(const KeyType &key)
+    {
+        size_t i;
+        if (!findIndex(key, &i))
+        {
+            return false;
+        }
+
+        // move following entries back into the gap if the gap is on their probe path
+        size_t mask = _entries.size() - 1;
+        size_t j = i;
+        while (true)
+        {
+            j = (j + 1) & mask;
+            if (!_entries[j].used)
+            {
+                break;
+            }
+
+            size_t k = hash(_entries[j].key) & mask;
+            if (i <= j ? (i < k && k <= j) : (i < k || k <= j))
+            {
+                continue;
+            }
+
+            _entries[i] = _entries[j];
+            i = j;
+        }
+        _entries[i].used = false;
+        _used--;
+
+        return true;
+    }
+
+    size_t size() const { return _used; }
+
+    std::vector<ValueType> getValues() const
+    {
+        std::vector<ValueType> values;
+        size_t i;
+
+        values.reserve(_used);
+        for (i = 0; i < _entries.size(); i++)
+        {
+            if (_entries[i].used)
+            {
+                values.push_back(_entries[i].value);
+            }
+        }
+
+        return values;
+    }
+
+private:
+    struct Entry
+    {
+        KeyType key;
+        ValueType value;
+        bool used;
+    };
+
+private:
+    static size_t hash(const KeyType &key)
+    {
+        // FNV-1a
+        const uint8_t *bytes = (const uint8_t*)&key;
+        uint32_t value = 2166136261U;
+        size_t i;
+        for (i = 0; i < sizeof(KeyType); i++)
+        {
+            value ^= bytes[i];
+            value *= 16777619U;
+        }
+
+        return value;
+    }
+
+    bool findIndex(const KeyType &key, size_t *index) const
+    {
+        if (_used == 0)
+        {
+            return false;
+        }
+
+        size_t mask = _entries.size() - 1;
+        size_t i = hash(key) & mask;
+        while (_entries[i].used)
+        {
+            if (memcmp(&_entries[i].key, &key, sizeof(KeyType)) == 0)
+            {
+                *index = i;
+                return true;
+            }
+            i = (i + 1) & mask;
+        }
+
+        return false;
+    }
+
+    void resize(size_t minSize)
+    {
+        size_t newSize = (_entries.empty() ? 16 : _entries.size());
+        while (newSize < minSize)
+        {
+            newSize *= 2;
+        }
+        if (newSize == _entries.size())
+        {
+            return;
+        }
+
+        std::vector<Entry> oldEntries(newSize);
+        size_t i;
+
+        oldEntries.swap(_entries);
+        for (i = 0; i < oldEntries.size(); i++)
+        {
+            if (oldEntries[i].used)
+            {
+                insertEntry(oldEntries[i].key, oldEntries[i].value);
+            }
+        }
+    }
+
+    void insertEntry(const KeyType &key, ValueType value)
+    {
+        size_t mask = _entries.size() - 1;
+        size_t i = hash(key) & mask;
+        while (_entries[i].used)
+        {
+            i = (i + 1) & mask;
+        }
+
+        _entries[i].key = key;
+        _entries[i].value = value;
+        _entries[i].used = true;
+    }
+
+private:
+    std::vector<Entry> _entries;
+    size_t _used;
+};
+
+
+};
+
+
+
+#endif
+
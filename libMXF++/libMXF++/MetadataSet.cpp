@@ -43,6 +43,10 @@ using namespace std;
 using namespace mxfpp;
 
 
+// marks a slot for an item that is not present in the set
+static MXFMetadataItem ABSENT_SLOT_ITEM;
+
+
 
 class ReferencedObjectIterator : public ObjectIterator
 {
@@ -114,11 +118,11 @@ private:
 
 
 MetadataSet::MetadataSet(const MetadataSet &set)
-: _headerMetadata(set._headerMetadata), _cMetadataSet(set._cMetadataSet)
+: _headerMetadata(set._headerMetadata), _cMetadataSet(set._cMetadataSet), _slotItemsRevision(0)
 {}
 
 MetadataSet::MetadataSet(HeaderMetadata *headerMetadata, ::MXFMetadataSet *metadataSet)
-: _headerMetadata(headerMetadata), _cMetadataSet(metadataSet)
+: _headerMetadata(headerMetadata), _cMetadataSet(metadataSet), _slotItemsRevision(0)
 {}
 
 MetadataSet::~MetadataSet()
@@ -138,6 +142,7 @@ vector<MXFMetadataItem*> MetadataSet::getItems() const
 {
     vector<MXFMetadataItem*> items;
     MXFListIterator item_iter;
+    MXFPP_CHECK(mxf_decode_set_items(_cMetadataSet));
     mxf_initialise_list_iter(&item_iter, &_cMetadataSet->items);
     while (mxf_next_list_iter_element(&item_iter))
         items.push_back((MXFMetadataItem*)mxf_get_iter_element(&item_iter));
@@ -1392,3 +1397,219 @@ void MetadataSet::setAvidProductVersion(const mxfKey *itemKey, mxfProductVersion
     MXFPP_CHECK(mxf_avid_set_product_version_item(_cMetadataSet, itemKey, &value));
 }
 
+
+MXFMetadataItem* MetadataSet::getSlotItem(unsigned int slot, const mxfKey *itemKey) const
+{
+    if (_slotItemsRevision != _cMetadataSet->itemsRevision)
+    {
+        _slotItems.assign(_slotItems.size(), 0);
+    }
+    if (slot >= _slotItems.size())
+    {
+        _slotItems.resize(slot + 1, 0);
+    }
+
+    MXFMetadataItem *item = _slotItems[slot];
+    if (!item)
+    {
+        // the lookup decodes the items of a lazily read set and so must happen before the revision is taken
+        if (!mxf_get_item(_cMetadataSet, itemKey, &item))
+        {
+            item = &ABSENT_SLOT_ITEM;
+        }
+        _slotItems[slot] = item;
+        _slotItemsRevision = _cMetadataSet->itemsRevision;
+    }
+
+    return (item != &ABSENT_SLOT_ITEM ? item : 0);
+}
+
+const uint8_t* MetadataSet::getSlotItemValue(unsigned int slot, const mxfKey *itemKey, uint16_t length) const
+{
+    MXFMetadataItem *item = getSlotItem(slot, itemKey);
+    MXFPP_CHECK(item != 0);
+    MXFPP_CHECK(item->length == length);
+    return item->value;
+}
+
+bool MetadataSet::haveItem(unsigned int slot, const mxfKey *itemKey) const
+{
+    return getSlotItem(slot, itemKey) != 0;
+}
+
+uint8_t MetadataSet::getUInt8Item(unsigned int slot, const mxfKey *itemKey) const
+{
+    uint8_t result;
+    mxf_get_uint8(getSlotItemValue(slot, itemKey, 1), &result);
+    return result;
+}
+
+uint16_t MetadataSet::getUInt16Item(unsigned int slot, const mxfKey *itemKey) const
+{
+    uint16_t result;
+    mxf_get_uint16(getSlotItemValue(slot, itemKey, 2), &result);
+    return result;
+}
+
+uint32_t MetadataSet::getUInt32Item(unsigned int slot, const mxfKey *itemKey) const
+{
+    uint32_t result;
+    mxf_get_uint32(getSlotItemValue(slot, itemKey, 4), &result);
+    return result;
+}
+
+uint64_t MetadataSet::getUInt64Item(unsigned int slot, const mxfKey *itemKey) const
+{
+    uint64_t result;
+    mxf_get_uint64(getSlotItemValue(slot, itemKey, 8), &result);
+    return result;
+}
+
+int8_t MetadataSet::getInt8Item(unsigned int slot, const mxfKey *itemKey) const
+{
+    int8_t result;
+    mxf_get_int8(getSlotItemValue(slot, itemKey, 1), &result);
+    return result;
+}
+
+int16_t MetadataSet::getInt16Item(unsigned int slot, const mxfKey *itemKey) const
+{
+    int16_t result;
+    mxf_get_int16(getSlotItemValue(slot, itemKey, 2), &result);
+    return result;
+}
+
+int32_t MetadataSet::getInt32Item(unsigned int slot, const mxfKey *itemKey) const
+{
+    int32_t result;
+    mxf_get_int32(getSlotItemValue(slot, itemKey, 4), &result);
+    return result;
+}
+
+int64_t MetadataSet::getInt64Item(unsigned int slot, const mxfKey *itemKey) const
+{
+    int64_t result;
+    mxf_get_int64(getSlotItemValue(slot, itemKey, 8), &result);
+    return result;
+}
+
+mxfVersionType MetadataSet::getVersionTypeItem(unsigned int slot, const mxfKey *itemKey) const
+{
+    mxfVersionType result;
+    mxf_get_version_type(getSlotItemValue(slot, itemKey, mxfVersionType_extlen), &result);
+    return result;
+}
+
+mxfUUID MetadataSet::getUUIDItem(unsigned int slot, const mxfKey *itemKey) const
+{
+    mxfUUID result;
+    mxf_get_uuid(getSlotItemValue(slot, itemKey, mxfUUID_extlen), &result);
+    return result;
+}
+
+mxfUL MetadataSet::getULItem(unsigned int slot, const mxfKey *itemKey) const
+{
+    mxfUL result;
+    mxf_get_ul(getSlotItemValue(slot, itemKey, mxfUL_extlen), &result);
+    return result;
+}
+
+mxfAUID MetadataSet::getAUIDItem(unsigned int slot, const mxfKey *itemKey) const
+{
+    mxfAUID result;
+    mxf_get_auid(getSlotItemValue(slot, itemKey, mxfAUID_extlen), &result);
+    return result;
+}
+
+mxfUMID MetadataSet::getUMIDItem(unsigned int slot, const mxfKey *itemKey) const
+{
+    mxfUMID result;
+    mxf_get_umid(getSlotItemValue(slot, itemKey, mxfUMID_extlen), &result);
+    return result;
+}
+
+mxfTimestamp MetadataSet::getTimestampItem(unsigned int slot, const mxfKey *itemKey) const
+{
+    mxfTimestamp result;
+    mxf_get_timestamp(getSlotItemValue(slot, itemKey, mxfTimestamp_extlen), &result);
+    return result;
+}
+
+int64_t MetadataSet::getLengthItem(unsigned int slot, const mxfKey *itemKey) const
+{
+    int64_t result;
+    mxf_get_length(getSlotItemValue(slot, itemKey, mxfLength_extlen), &result);
+    return result;
+}
+
+mxfRational MetadataSet::getRationalItem(unsigned int slot, const mxfKey *itemKey) const
+{
+    mxfRational result;
+    mxf_get_rational(getSlotItemValue(slot, itemKey, mxfRational_extlen), &result);
+    return result;
+}
+
+int64_t MetadataSet::getPositionItem(unsigned int slot, const mxfKey *itemKey) const
+{
+    int64_t result;
+    mxf_get_position(getSlotItemValue(slot, itemKey, mxfPosition_extlen), &result);
+    return result;
+}
+
+bool MetadataSet::getBooleanItem(unsigned int slot, const mxfKey *itemKey) const
+{
+    mxfBoolean result;
+    mxf_get_boolean(getSlotItemValue(slot, itemKey, mxfBoolean_extlen), &result);
+    return result != 0;
+}
+
+mxfProductVersion MetadataSet::getProductVersionItem(unsigned int slot, const mxfKey *itemKey) const
+{
+    mxfProductVersion result;
+    MXFMetadataItem *item = getSlotItem(slot, itemKey);
+    MXFPP_CHECK(item != 0);
+    if (item->length == mxfProductVersion_extlen - 1)
+    {
+        mxf_avid_get_product_version(item->value, &result);
+    }
+    else
+    {
+        MXFPP_CHECK(item->length == mxfProductVersion_extlen);
+        mxf_get_product_version(item->value, &result);
+    }
+    return result;
+}
+
+MetadataSet* MetadataSet::getStrongRefItem(unsigned int slot, const mxfKey *itemKey) const
+{
+    MXFMetadataItem *item = getSlotItem(slot, itemKey);
+    ::MXFMetadataSet *cSet;
+    mxfUUID uuidValue;
+    if (!item || item->length != mxfUUID_extlen || _cMetadataSet->headerMetadata == 0)
+    {
+        return getStrongRefItem(itemKey);
+    }
+    mxf_get_uuid(item->value, &uuidValue);
+    if (!mxf_dereference(_cMetadataSet->headerMetadata, &uuidValue, &cSet))
+    {
+        return getStrongRefItem(itemKey);
+    }
+    return _headerMetadata->wrap(cSet);
+}
+
+MetadataSet* MetadataSet::getWeakRefItem(unsigned int slot, const mxfKey *itemKey) const
+{
+    MXFMetadataItem *item = getSlotItem(slot, itemKey);
+    ::MXFMetadataSet *cSet;
+    mxfUUID uuidValue;
+    if (!item || item->length != mxfUUID_extlen || _cMetadataSet->headerMetadata == 0)
+    {
+        return getWeakRefItem(itemKey);
+    }
+    mxf_get_uuid(item->value, &uuidValue);
+    if (!mxf_dereference(_cMetadataSet->headerMetadata, &uuidValue, &cSet))
+    {
+        return getWeakRefItem(itemKey);
+    }
+    return _headerMetadata->wrap(cSet);
+}
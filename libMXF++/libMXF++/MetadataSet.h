@@ -276,8 +276,46 @@ public:
 protected:
     MetadataSet(HeaderMetadata *headerMetadata, ::MXFMetadataSet *metadataSet);
 
+    // The generated classes number the items they get in an enum, continuing from the parent class's
+    // ITEM_SLOT_END. The item found for a slot is cached until an item is added to or removed from the set
+    enum
+    {
+        ITEM_SLOT_END = 0
+    };
+
+    MXFMetadataItem* getSlotItem(unsigned int slot, const mxfKey *itemKey) const;
+    const uint8_t* getSlotItemValue(unsigned int slot, const mxfKey *itemKey, uint16_t length) const;
+
+    bool haveItem(unsigned int slot, const mxfKey *itemKey) const;
+
+    uint8_t getUInt8Item(unsigned int slot, const mxfKey *itemKey) const;
+    uint16_t getUInt16Item(unsigned int slot, const mxfKey *itemKey) const;
+    uint32_t getUInt32Item(unsigned int slot, const mxfKey *itemKey) const;
+    uint64_t getUInt64Item(unsigned int slot, const mxfKey *itemKey) const;
+    int8_t getInt8Item(unsigned int slot, const mxfKey *itemKey) const;
+    int16_t getInt16Item(unsigned int slot, const mxfKey *itemKey) const;
+    int32_t getInt32Item(unsigned int slot, const mxfKey *itemKey) const;
+    int64_t getInt64Item(unsigned int slot, const mxfKey *itemKey) const;
+    mxfVersionType getVersionTypeItem(unsigned int slot, const mxfKey *itemKey) const;
+    mxfUUID getUUIDItem(unsigned int slot, const mxfKey *itemKey) const;
+    mxfUL getULItem(unsigned int slot, const mxfKey *itemKey) const;
+    mxfAUID getAUIDItem(unsigned int slot, const mxfKey *itemKey) const;
+    mxfUMID getUMIDItem(unsigned int slot, const mxfKey *itemKey) const;
+    mxfTimestamp getTimestampItem(unsigned int slot, const mxfKey *itemKey) const;
+    int64_t getLengthItem(unsigned int slot, const mxfKey *itemKey) const;
+    mxfRational getRationalItem(unsigned int slot, const mxfKey *itemKey) const;
+    int64_t getPositionItem(unsigned int slot, const mxfKey *itemKey) const;
+    bool getBooleanItem(unsigned int slot, const mxfKey *itemKey) const;
+    mxfProductVersion getProductVersionItem(unsigned int slot, const mxfKey *itemKey) const;
+    MetadataSet* getStrongRefItem(unsigned int slot, const mxfKey *itemKey) const;
+    MetadataSet* getWeakRefItem(unsigned int slot, const mxfKey *itemKey) const;
+
     HeaderMetadata* _headerMetadata;
     ::MXFMetadataSet* _cMetadataSet;
+
+private:
+    mutable std::vector<MXFMetadataItem*> _slotItems;
+    mutable uint32_t _slotItemsRevision;
 };
 
 
@@ -59,37 +59,37 @@ AES3AudioDescriptorBase::~AES3AudioDescriptorBase()
 
 bool AES3AudioDescriptorBase::haveEmphasis() const
 {
-    return haveItem(&MXF_ITEM_K(AES3AudioDescriptor, Emphasis));
+    return haveItem(EMPHASIS_SLOT, &MXF_ITEM_K(AES3AudioDescriptor, Emphasis));
 }
 
 uint8_t AES3AudioDescriptorBase::getEmphasis() const
 {
-    return getUInt8Item(&MXF_ITEM_K(AES3AudioDescriptor, Emphasis));
+    return getUInt8Item(EMPHASIS_SLOT, &MXF_ITEM_K(AES3AudioDescriptor, Emphasis));
 }
 
 bool AES3AudioDescriptorBase::haveBlockStartOffset() const
 {
-    return haveItem(&MXF_ITEM_K(AES3AudioDescriptor, BlockStartOffset));
+    return haveItem(BLOCKSTARTOFFSET_SLOT, &MXF_ITEM_K(AES3AudioDescriptor, BlockStartOffset));
 }
 
 uint16_t AES3AudioDescriptorBase::getBlockStartOffset() const
 {
-    return getUInt16Item(&MXF_ITEM_K(AES3AudioDescriptor, BlockStartOffset));
+    return getUInt16Item(BLOCKSTARTOFFSET_SLOT, &MXF_ITEM_K(AES3AudioDescriptor, BlockStartOffset));
 }
 
 bool AES3AudioDescriptorBase::haveAuxiliaryBitsMode() const
 {
-    return haveItem(&MXF_ITEM_K(AES3AudioDescriptor, AuxiliaryBitsMode));
+    return haveItem(AUXILIARYBITSMODE_SLOT, &MXF_ITEM_K(AES3AudioDescriptor, AuxiliaryBitsMode));
 }
 
 uint8_t AES3AudioDescriptorBase::getAuxiliaryBitsMode() const
 {
-    return getUInt8Item(&MXF_ITEM_K(AES3AudioDescriptor, AuxiliaryBitsMode));
+    return getUInt8Item(AUXILIARYBITSMODE_SLOT, &MXF_ITEM_K(AES3AudioDescriptor, AuxiliaryBitsMode));
 }
 
 bool AES3AudioDescriptorBase::haveChannelStatusMode() const
 {
-    return haveItem(&MXF_ITEM_K(AES3AudioDescriptor, ChannelStatusMode));
+    return haveItem(CHANNELSTATUSMODE_SLOT, &MXF_ITEM_K(AES3AudioDescriptor, ChannelStatusMode));
 }
 
 vector<uint8_t> AES3AudioDescriptorBase::getChannelStatusMode() const
@@ -99,7 +99,7 @@ vector<uint8_t> AES3AudioDescriptorBase::getChannelStatusMode() const
 
 bool AES3AudioDescriptorBase::haveFixedChannelStatusData() const
 {
-    return haveItem(&MXF_ITEM_K(AES3AudioDescriptor, FixedChannelStatusData));
+    return haveItem(FIXEDCHANNELSTATUSDATA_SLOT, &MXF_ITEM_K(AES3AudioDescriptor, FixedChannelStatusData));
 }
 
 vector<mxfAES3FixedData> AES3AudioDescriptorBase::getFixedChannelStatusData() const
@@ -109,7 +109,7 @@ vector<mxfAES3FixedData> AES3AudioDescriptorBase::getFixedChannelStatusData() co
 
 bool AES3AudioDescriptorBase::haveUserDataMode() const
 {
-    return haveItem(&MXF_ITEM_K(AES3AudioDescriptor, UserDataMode));
+    return haveItem(USERDATAMODE_SLOT, &MXF_ITEM_K(AES3AudioDescriptor, UserDataMode));
 }
 
 vector<uint8_t> AES3AudioDescriptorBase::getUserDataMode() const
@@ -119,7 +119,7 @@ vector<uint8_t> AES3AudioDescriptorBase::getUserDataMode() const
 
 bool AES3AudioDescriptorBase::haveFixedUserData() const
 {
-    return haveItem(&MXF_ITEM_K(AES3AudioDescriptor, FixedUserData));
+    return haveItem(FIXEDUSERDATA_SLOT, &MXF_ITEM_K(AES3AudioDescriptor, FixedUserData));
 }
 
 vector<mxfAES3FixedData> AES3AudioDescriptorBase::getFixedUserData() const
@@ -129,22 +129,22 @@ vector<mxfAES3FixedData> AES3AudioDescriptorBase::getFixedUserData() const
 
 bool AES3AudioDescriptorBase::haveLinkedTimecodeTrackID() const
 {
-    return haveItem(&MXF_ITEM_K(AES3AudioDescriptor, LinkedTimecodeTrackID));
+    return haveItem(LINKEDTIMECODETRACKID_SLOT, &MXF_ITEM_K(AES3AudioDescriptor, LinkedTimecodeTrackID));
 }
 
 uint32_t AES3AudioDescriptorBase::getLinkedTimecodeTrackID() const
 {
-    return getUInt32Item(&MXF_ITEM_K(AES3AudioDescriptor, LinkedTimecodeTrackID));
+    return getUInt32Item(LINKEDTIMECODETRACKID_SLOT, &MXF_ITEM_K(AES3AudioDescriptor, LinkedTimecodeTrackID));
 }
 
 bool AES3AudioDescriptorBase::haveSMPTE377MDataStreamNumber() const
 {
-    return haveItem(&MXF_ITEM_K(AES3AudioDescriptor, SMPTE377MDataStreamNumber));
+    return haveItem(SMPTE377MDATASTREAMNUMBER_SLOT, &MXF_ITEM_K(AES3AudioDescriptor, SMPTE377MDataStreamNumber));
 }
 
 uint8_t AES3AudioDescriptorBase::getSMPTE377MDataStreamNumber() const
 {
-    return getUInt8Item(&MXF_ITEM_K(AES3AudioDescriptor, SMPTE377MDataStreamNumber));
+    return getUInt8Item(SMPTE377MDATASTREAMNUMBER_SLOT, &MXF_ITEM_K(AES3AudioDescriptor, SMPTE377MDataStreamNumber));
 }
 
 void AES3AudioDescriptorBase::setEmphasis(uint8_t value)
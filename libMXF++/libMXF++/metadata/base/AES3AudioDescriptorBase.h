@@ -92,6 +92,20 @@ public:
 
 
 protected:
+    enum
+    {
+        EMPHASIS_SLOT = WaveAudioDescriptor::ITEM_SLOT_END,
+        BLOCKSTARTOFFSET_SLOT,
+        AUXILIARYBITSMODE_SLOT,
+        CHANNELSTATUSMODE_SLOT,
+        FIXEDCHANNELSTATUSDATA_SLOT,
+        USERDATAMODE_SLOT,
+        FIXEDUSERDATA_SLOT,
+        LINKEDTIMECODETRACKID_SLOT,
+        SMPTE377MDATASTREAMNUMBER_SLOT,
+        ITEM_SLOT_END
+    };
+
     AES3AudioDescriptorBase(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet);
 
 private:
@@ -61,147 +61,147 @@ AVCSubDescriptorBase::~AVCSubDescriptorBase()
 
 uint8_t AVCSubDescriptorBase::getAVCDecodingDelay() const
 {
-    return getUInt8Item(&MXF_ITEM_K(AVCSubDescriptor, AVCDecodingDelay));
+    return getUInt8Item(AVCDECODINGDELAY_SLOT, &MXF_ITEM_K(AVCSubDescriptor, AVCDecodingDelay));
 }
 
 bool AVCSubDescriptorBase::haveAVCConstantBPictureFlag() const
 {
-    return haveItem(&MXF_ITEM_K(AVCSubDescriptor, AVCConstantBPictureFlag));
+    return haveItem(AVCCONSTANTBPICTUREFLAG_SLOT, &MXF_ITEM_K(AVCSubDescriptor, AVCConstantBPictureFlag));
 }
 
 bool AVCSubDescriptorBase::getAVCConstantBPictureFlag() const
 {
-    return getBooleanItem(&MXF_ITEM_K(AVCSubDescriptor, AVCConstantBPictureFlag));
+    return getBooleanItem(AVCCONSTANTBPICTUREFLAG_SLOT, &MXF_ITEM_K(AVCSubDescriptor, AVCConstantBPictureFlag));
 }
 
 bool AVCSubDescriptorBase::haveAVCCodedContentKind() const
 {
-    return haveItem(&MXF_ITEM_K(AVCSubDescriptor, AVCCodedContentKind));
+    return haveItem(AVCCODEDCONTENTKIND_SLOT, &MXF_ITEM_K(AVCSubDescriptor, AVCCodedContentKind));
 }
 
 uint8_t AVCSubDescriptorBase::getAVCCodedContentKind() const
 {
-    return getUInt8Item(&MXF_ITEM_K(AVCSubDescriptor, AVCCodedContentKind));
+    return getUInt8Item(AVCCODEDCONTENTKIND_SLOT, &MXF_ITEM_K(AVCSubDescriptor, AVCCodedContentKind));
 }
 
 bool AVCSubDescriptorBase::haveAVCClosedGOPIndicator() const
 {
-    return haveItem(&MXF_ITEM_K(AVCSubDescriptor, AVCClosedGOPIndicator));
+    return haveItem(AVCCLOSEDGOPINDICATOR_SLOT, &MXF_ITEM_K(AVCSubDescriptor, AVCClosedGOPIndicator));
 }
 
 bool AVCSubDescriptorBase::getAVCClosedGOPIndicator() const
 {
-    return getBooleanItem(&MXF_ITEM_K(AVCSubDescriptor, AVCClosedGOPIndicator));
+    return getBooleanItem(AVCCLOSEDGOPINDICATOR_SLOT, &MXF_ITEM_K(AVCSubDescriptor, AVCClosedGOPIndicator));
 }
 
 bool AVCSubDescriptorBase::haveAVCIdenticalGOPIndicator() const
 {
-    return haveItem(&MXF_ITEM_K(AVCSubDescriptor, AVCIdenticalGOPIndicator));
+    return haveItem(AVCIDENTICALGOPINDICATOR_SLOT, &MXF_ITEM_K(AVCSubDescriptor, AVCIdenticalGOPIndicator));
 }
 
 bool AVCSubDescriptorBase::getAVCIdenticalGOPIndicator() const
 {
-    return getBooleanItem(&MXF_ITEM_K(AVCSubDescriptor, AVCIdenticalGOPIndicator));
+    return getBooleanItem(AVCIDENTICALGOPINDICATOR_SLOT, &MXF_ITEM_K(AVCSubDescriptor, AVCIdenticalGOPIndicator));
 }
 
 bool AVCSubDescriptorBase::haveAVCMaximumGOPSize() const
 {
-    return haveItem(&MXF_ITEM_K(AVCSubDescriptor, AVCMaximumGOPSize));
+    return haveItem(AVCMAXIMUMGOPSIZE_SLOT, &MXF_ITEM_K(AVCSubDescriptor, AVCMaximumGOPSize));
 }
 
 uint16_t AVCSubDescriptorBase::getAVCMaximumGOPSize() const
 {
-    return getUInt16Item(&MXF_ITEM_K(AVCSubDescriptor, AVCMaximumGOPSize));
+    return getUInt16Item(AVCMAXIMUMGOPSIZE_SLOT, &MXF_ITEM_K(AVCSubDescriptor, AVCMaximumGOPSize));
 }
 
 bool AVCSubDescriptorBase::haveAVCMaximumBPictureCount() const
 {
-    return haveItem(&MXF_ITEM_K(AVCSubDescriptor, AVCMaximumBPictureCount));
+    return haveItem(AVCMAXIMUMBPICTURECOUNT_SLOT, &MXF_ITEM_K(AVCSubDescriptor, AVCMaximumBPictureCount));
 }
 
 uint16_t AVCSubDescriptorBase::getAVCMaximumBPictureCount() const
 {
-    return getUInt16Item(&MXF_ITEM_K(AVCSubDescriptor, AVCMaximumBPictureCount));
+    return getUInt16Item(AVCMAXIMUMBPICTURECOUNT_SLOT, &MXF_ITEM_K(AVCSubDescriptor, AVCMaximumBPictureCount));
 }
 
 bool AVCSubDescriptorBase::haveAVCMaximumBitrate() const
 {
-    return haveItem(&MXF_ITEM_K(AVCSubDescriptor, AVCMaximumBitrate));
+    return haveItem(AVCMAXIMUMBITRATE_SLOT, &MXF_ITEM_K(AVCSubDescriptor, AVCMaximumBitrate));
 }
 
 uint32_t AVCSubDescriptorBase::getAVCMaximumBitrate() const
 {
-    return getUInt32Item(&MXF_ITEM_K(AVCSubDescriptor, AVCMaximumBitrate));
+    return getUInt32Item(AVCMAXIMUMBITRATE_SLOT, &MXF_ITEM_K(AVCSubDescriptor, AVCMaximumBitrate));
 }
 
 bool AVCSubDescriptorBase::haveAVCAverageBitrate() const
 {
-    return haveItem(&MXF_ITEM_K(AVCSubDescriptor, AVCAverageBitrate));
+    return haveItem(AVCAVERAGEBITRATE_SLOT, &MXF_ITEM_K(AVCSubDescriptor, AVCAverageBitrate));
 }
 
 uint32_t AVCSubDescriptorBase::getAVCAverageBitrate() const
 {
-    return getUInt32Item(&MXF_ITEM_K(AVCSubDescriptor, AVCAverageBitrate));
+    return getUInt32Item(AVCAVERAGEBITRATE_SLOT, &MXF_ITEM_K(AVCSubDescriptor, AVCAverageBitrate));
 }
 
 bool AVCSubDescriptorBase::haveAVCProfile() const
 {
-    return haveItem(&MXF_ITEM_K(AVCSubDescriptor, AVCProfile));
+    return haveItem(AVCPROFILE_SLOT, &MXF_ITEM_K(AVCSubDescriptor, AVCProfile));
 }
 
 uint8_t AVCSubDescriptorBase::getAVCProfile() const
 {
-    return getUInt8Item(&MXF_ITEM_K(AVCSubDescriptor, AVCProfile));
+    return getUInt8Item(AVCPROFILE_SLOT, &MXF_ITEM_K(AVCSubDescriptor, AVCProfile));
 }
 
 bool AVCSubDescriptorBase::haveAVCProfileConstraint() const
 {
-    return haveItem(&MXF_ITEM_K(AVCSubDescriptor, AVCProfileConstraint));
+    return haveItem(AVCPROFILECONSTRAINT_SLOT, &MXF_ITEM_K(AVCSubDescriptor, AVCProfileConstraint));
 }
 
 uint8_t AVCSubDescriptorBase::getAVCProfileConstraint() const
 {
-    return getUInt8Item(&MXF_ITEM_K(AVCSubDescriptor, AVCProfileConstraint));
+    return getUInt8Item(AVCPROFILECONSTRAINT_SLOT, &MXF_ITEM_K(AVCSubDescriptor, AVCProfileConstraint));
 }
 
 bool AVCSubDescriptorBase::haveAVCLevel() const
 {
-    return haveItem(&MXF_ITEM_K(AVCSubDescriptor, AVCLevel));
+    return haveItem(AVCLEVEL_SLOT, &MXF_ITEM_K(AVCSubDescriptor, AVCLevel));
 }
 
 uint8_t AVCSubDescriptorBase::getAVCLevel() const
 {
-    return getUInt8Item(&MXF_ITEM_K(AVCSubDescriptor, AVCLevel));
+    return getUInt8Item(AVCLEVEL_SLOT, &MXF_ITEM_K(AVCSubDescriptor, AVCLevel));
 }
 
 bool AVCSubDescriptorBase::haveAVCMaximumRefFrames() const
 {
-    return haveItem(&MXF_ITEM_K(AVCSubDescriptor, AVCMaximumRefFrames));
+    return haveItem(AVCMAXIMUMREFFRAMES_SLOT, &MXF_ITEM_K(AVCSubDescriptor, AVCMaximumRefFrames));
 }
 
 uint8_t AVCSubDescriptorBase::getAVCMaximumRefFrames() const
 {
-    return getUInt8Item(&MXF_ITEM_K(AVCSubDescriptor, AVCMaximumRefFrames));
+    return getUInt8Item(AVCMAXIMUMREFFRAMES_SLOT, &MXF_ITEM_K(AVCSubDescriptor, AVCMaximumRefFrames));
 }
 
 bool AVCSubDescriptorBase::haveAVCSequenceParameterSetFlag() const
 {
-    return haveItem(&MXF_ITEM_K(AVCSubDescriptor, AVCSequenceParameterSetFlag));
+    return haveItem(AVCSEQUENCEPARAMETERSETFLAG_SLOT, &MXF_ITEM_K(AVCSubDescriptor, AVCSequenceParameterSetFlag));
 }
 
 uint8_t AVCSubDescriptorBase::getAVCSequenceParameterSetFlag() const
 {
-    return getUInt8Item(&MXF_ITEM_K(AVCSubDescriptor, AVCSequenceParameterSetFlag));
+    return getUInt8Item(AVCSEQUENCEPARAMETERSETFLAG_SLOT, &MXF_ITEM_K(AVCSubDescriptor, AVCSequenceParameterSetFlag));
 }
 
 bool AVCSubDescriptorBase::haveAVCPictureParameterSetFlag() const
 {
-    return haveItem(&MXF_ITEM_K(AVCSubDescriptor, AVCPictureParameterSetFlag));
+    return haveItem(AVCPICTUREPARAMETERSETFLAG_SLOT, &MXF_ITEM_K(AVCSubDescriptor, AVCPictureParameterSetFlag));
 }
 
 uint8_t AVCSubDescriptorBase::getAVCPictureParameterSetFlag() const
 {
-    return getUInt8Item(&MXF_ITEM_K(AVCSubDescriptor, AVCPictureParameterSetFlag));
+    return getUInt8Item(AVCPICTUREPARAMETERSETFLAG_SLOT, &MXF_ITEM_K(AVCSubDescriptor, AVCPictureParameterSetFlag));
 }
 
 void AVCSubDescriptorBase::setAVCDecodingDelay(uint8_t value)
@@ -105,6 +105,26 @@ public:
 
 
 protected:
+    enum
+    {
+        AVCDECODINGDELAY_SLOT = SubDescriptor::ITEM_SLOT_END,
+        AVCCONSTANTBPICTUREFLAG_SLOT,
+        AVCCODEDCONTENTKIND_SLOT,
+        AVCCLOSEDGOPINDICATOR_SLOT,
+        AVCIDENTICALGOPINDICATOR_SLOT,
+        AVCMAXIMUMGOPSIZE_SLOT,
+        AVCMAXIMUMBPICTURECOUNT_SLOT,
+        AVCMAXIMUMBITRATE_SLOT,
+        AVCAVERAGEBITRATE_SLOT,
+        AVCPROFILE_SLOT,
+        AVCPROFILECONSTRAINT_SLOT,
+        AVCLEVEL_SLOT,
+        AVCMAXIMUMREFFRAMES_SLOT,
+        AVCSEQUENCEPARAMETERSETFLAG_SLOT,
+        AVCPICTUREPARAMETERSETFLAG_SLOT,
+        ITEM_SLOT_END
+    };
+
     AVCSubDescriptorBase(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet);
 };
 
@@ -59,12 +59,12 @@ AudioChannelLabelSubDescriptorBase::~AudioChannelLabelSubDescriptorBase()
 
 bool AudioChannelLabelSubDescriptorBase::haveSoundfieldGroupLinkID() const
 {
-    return haveItem(&MXF_ITEM_K(AudioChannelLabelSubDescriptor, SoundfieldGroupLinkID));
+    return haveItem(SOUNDFIELDGROUPLINKID_SLOT, &MXF_ITEM_K(AudioChannelLabelSubDescriptor, SoundfieldGroupLinkID));
 }
 
 mxfUUID AudioChannelLabelSubDescriptorBase::getSoundfieldGroupLinkID() const
 {
-    return getUUIDItem(&MXF_ITEM_K(AudioChannelLabelSubDescriptor, SoundfieldGroupLinkID));
+    return getUUIDItem(SOUNDFIELDGROUPLINKID_SLOT, &MXF_ITEM_K(AudioChannelLabelSubDescriptor, SoundfieldGroupLinkID));
 }
 
 void AudioChannelLabelSubDescriptorBase::setSoundfieldGroupLinkID(mxfUUID value)
@@ -64,6 +64,12 @@ public:
 
 
 protected:
+    enum
+    {
+        SOUNDFIELDGROUPLINKID_SLOT = MCALabelSubDescriptor::ITEM_SLOT_END,
+        ITEM_SLOT_END
+    };
+
     AudioChannelLabelSubDescriptorBase(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet);
 };
 
@@ -59,102 +59,102 @@ CDCIEssenceDescriptorBase::~CDCIEssenceDescriptorBase()
 
 bool CDCIEssenceDescriptorBase::haveComponentDepth() const
 {
-    return haveItem(&MXF_ITEM_K(CDCIEssenceDescriptor, ComponentDepth));
+    return haveItem(COMPONENTDEPTH_SLOT, &MXF_ITEM_K(CDCIEssenceDescriptor, ComponentDepth));
 }
 
 uint32_t CDCIEssenceDescriptorBase::getComponentDepth() const
 {
-    return getUInt32Item(&MXF_ITEM_K(CDCIEssenceDescriptor, ComponentDepth));
+    return getUInt32Item(COMPONENTDEPTH_SLOT, &MXF_ITEM_K(CDCIEssenceDescriptor, ComponentDepth));
 }
 
 bool CDCIEssenceDescriptorBase::haveHorizontalSubsampling() const
 {
-    return haveItem(&MXF_ITEM_K(CDCIEssenceDescriptor, HorizontalSubsampling));
+    return haveItem(HORIZONTALSUBSAMPLING_SLOT, &MXF_ITEM_K(CDCIEssenceDescriptor, HorizontalSubsampling));
 }
 
 uint32_t CDCIEssenceDescriptorBase::getHorizontalSubsampling() const
 {
-    return getUInt32Item(&MXF_ITEM_K(CDCIEssenceDescriptor, HorizontalSubsampling));
+    return getUInt32Item(HORIZONTALSUBSAMPLING_SLOT, &MXF_ITEM_K(CDCIEssenceDescriptor, HorizontalSubsampling));
 }
 
 bool CDCIEssenceDescriptorBase::haveVerticalSubsampling() const
 {
-    return haveItem(&MXF_ITEM_K(CDCIEssenceDescriptor, VerticalSubsampling));
+    return haveItem(VERTICALSUBSAMPLING_SLOT, &MXF_ITEM_K(CDCIEssenceDescriptor, VerticalSubsampling));
 }
 
 uint32_t CDCIEssenceDescriptorBase::getVerticalSubsampling() const
 {
-    return getUInt32Item(&MXF_ITEM_K(CDCIEssenceDescriptor, VerticalSubsampling));
+    return getUInt32Item(VERTICALSUBSAMPLING_SLOT, &MXF_ITEM_K(CDCIEssenceDescriptor, VerticalSubsampling));
 }
 
 bool CDCIEssenceDescriptorBase::haveColorSiting() const
 {
-    return haveItem(&MXF_ITEM_K(CDCIEssenceDescriptor, ColorSiting));
+    return haveItem(COLORSITING_SLOT, &MXF_ITEM_K(CDCIEssenceDescriptor, ColorSiting));
 }
 
 uint8_t CDCIEssenceDescriptorBase::getColorSiting() const
 {
-    return getUInt8Item(&MXF_ITEM_K(CDCIEssenceDescriptor, ColorSiting));
+    return getUInt8Item(COLORSITING_SLOT, &MXF_ITEM_K(CDCIEssenceDescriptor, ColorSiting));
 }
 
 bool CDCIEssenceDescriptorBase::haveReversedByteOrder() const
 {
-    return haveItem(&MXF_ITEM_K(CDCIEssenceDescriptor, ReversedByteOrder));
+    return haveItem(REVERSEDBYTEORDER_SLOT, &MXF_ITEM_K(CDCIEssenceDescriptor, ReversedByteOrder));
 }
 
 bool CDCIEssenceDescriptorBase::getReversedByteOrder() const
 {
-    return getBooleanItem(&MXF_ITEM_K(CDCIEssenceDescriptor, ReversedByteOrder));
+    return getBooleanItem(REVERSEDBYTEORDER_SLOT, &MXF_ITEM_K(CDCIEssenceDescriptor, ReversedByteOrder));
 }
 
 bool CDCIEssenceDescriptorBase::havePaddingBits() const
 {
-    return haveItem(&MXF_ITEM_K(CDCIEssenceDescriptor, PaddingBits));
+    return haveItem(PADDINGBITS_SLOT, &MXF_ITEM_K(CDCIEssenceDescriptor, PaddingBits));
 }
 
 int16_t CDCIEssenceDescriptorBase::getPaddingBits() const
 {
-    return getInt16Item(&MXF_ITEM_K(CDCIEssenceDescriptor, PaddingBits));
+    return getInt16Item(PADDINGBITS_SLOT, &MXF_ITEM_K(CDCIEssenceDescriptor, PaddingBits));
 }
 
 bool CDCIEssenceDescriptorBase::haveAlphaSampleDepth() const
 {
-    return haveItem(&MXF_ITEM_K(CDCIEssenceDescriptor, AlphaSampleDepth));
+    return haveItem(ALPHASAMPLEDEPTH_SLOT, &MXF_ITEM_K(CDCIEssenceDescriptor, AlphaSampleDepth));
 }
 
 uint32_t CDCIEssenceDescriptorBase::getAlphaSampleDepth() const
 {
-    return getUInt32Item(&MXF_ITEM_K(CDCIEssenceDescriptor, AlphaSampleDepth));
+    return getUInt32Item(ALPHASAMPLEDEPTH_SLOT, &MXF_ITEM_K(CDCIEssenceDescriptor, AlphaSampleDepth));
 }
 
 bool CDCIEssenceDescriptorBase::haveBlackRefLevel() const
 {
-    return haveItem(&MXF_ITEM_K(CDCIEssenceDescriptor, BlackRefLevel));
+    return haveItem(BLACKREFLEVEL_SLOT, &MXF_ITEM_K(CDCIEssenceDescriptor, BlackRefLevel));
 }
 
 uint32_t CDCIEssenceDescriptorBase::getBlackRefLevel() const
 {
-    return getUInt32Item(&MXF_ITEM_K(CDCIEssenceDescriptor, BlackRefLevel));
+    return getUInt32Item(BLACKREFLEVEL_SLOT, &MXF_ITEM_K(CDCIEssenceDescriptor, BlackRefLevel));
 }
 
 bool CDCIEssenceDescriptorBase::haveWhiteReflevel() const
 {
-    return haveItem(&MXF_ITEM_K(CDCIEssenceDescriptor, WhiteReflevel));
+    return haveItem(WHITEREFLEVEL_SLOT, &MXF_ITEM_K(CDCIEssenceDescriptor, WhiteReflevel));
 }
 
 uint32_t CDCIEssenceDescriptorBase::getWhiteReflevel() const
 {
-    return getUInt32Item(&MXF_ITEM_K(CDCIEssenceDescriptor, WhiteReflevel));
+    return getUInt32Item(WHITEREFLEVEL_SLOT, &MXF_ITEM_K(CDCIEssenceDescriptor, WhiteReflevel));
 }
 
 bool CDCIEssenceDescriptorBase::haveColorRange() const
 {
-    return haveItem(&MXF_ITEM_K(CDCIEssenceDescriptor, ColorRange));
+    return haveItem(COLORRANGE_SLOT, &MXF_ITEM_K(CDCIEssenceDescriptor, ColorRange));
 }
 
 uint32_t CDCIEssenceDescriptorBase::getColorRange() const
 {
-    return getUInt32Item(&MXF_ITEM_K(CDCIEssenceDescriptor, ColorRange));
+    return getUInt32Item(COLORRANGE_SLOT, &MXF_ITEM_K(CDCIEssenceDescriptor, ColorRange));
 }
 
 void CDCIEssenceDescriptorBase::setComponentDepth(uint32_t value)
@@ -91,6 +91,21 @@ public:
 
 
 protected:
+    enum
+    {
+        COMPONENTDEPTH_SLOT = GenericPictureEssenceDescriptor::ITEM_SLOT_END,
+        HORIZONTALSUBSAMPLING_SLOT,
+        VERTICALSUBSAMPLING_SLOT,
+        COLORSITING_SLOT,
+        REVERSEDBYTEORDER_SLOT,
+        PADDINGBITS_SLOT,
+        ALPHASAMPLEDEPTH_SLOT,
+        BLACKREFLEVEL_SLOT,
+        WHITEREFLEVEL_SLOT,
+        COLORRANGE_SLOT,
+        ITEM_SLOT_END
+    };
+
     CDCIEssenceDescriptorBase(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet);
 };
 
@@ -73,7 +73,7 @@ std::vector<GenericPackage*> ContentStorageBase::getPackages() const
 
 bool ContentStorageBase::haveEssenceContainerData() const
 {
-    return haveItem(&MXF_ITEM_K(ContentStorage, EssenceContainerData));
+    return haveItem(ESSENCECONTAINERDATA_SLOT, &MXF_ITEM_K(ContentStorage, EssenceContainerData));
 }
 
 std::vector<EssenceContainerData*> ContentStorageBase::getEssenceContainerData() const
@@ -68,6 +68,12 @@ public:
 
 
 protected:
+    enum
+    {
+        ESSENCECONTAINERDATA_SLOT = InterchangeObject::ITEM_SLOT_END,
+        ITEM_SLOT_END
+    };
+
     ContentStorageBase(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet);
 };
 
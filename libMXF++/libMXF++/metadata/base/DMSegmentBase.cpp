@@ -61,12 +61,12 @@ DMSegmentBase::~DMSegmentBase()
 
 int64_t DMSegmentBase::getEventStartPosition() const
 {
-    return getPositionItem(&MXF_ITEM_K(DMSegment, EventStartPosition));
+    return getPositionItem(EVENTSTARTPOSITION_SLOT, &MXF_ITEM_K(DMSegment, EventStartPosition));
 }
 
 bool DMSegmentBase::haveEventComment() const
 {
-    return haveItem(&MXF_ITEM_K(DMSegment, EventComment));
+    return haveItem(EVENTCOMMENT_SLOT, &MXF_ITEM_K(DMSegment, EventComment));
 }
 
 std::string DMSegmentBase::getEventComment() const
@@ -76,7 +76,7 @@ std::string DMSegmentBase::getEventComment() const
 
 bool DMSegmentBase::haveTrackIDs() const
 {
-    return haveItem(&MXF_ITEM_K(DMSegment, TrackIDs));
+    return haveItem(TRACKIDS_SLOT, &MXF_ITEM_K(DMSegment, TrackIDs));
 }
 
 std::vector<uint32_t> DMSegmentBase::getTrackIDs() const
@@ -86,12 +86,12 @@ std::vector<uint32_t> DMSegmentBase::getTrackIDs() const
 
 bool DMSegmentBase::haveDMFramework() const
 {
-    return haveItem(&MXF_ITEM_K(DMSegment, DMFramework));
+    return haveItem(DMFRAMEWORK_SLOT, &MXF_ITEM_K(DMSegment, DMFramework));
 }
 
 DMFramework* DMSegmentBase::getDMFramework() const
 {
-    auto_ptr<MetadataSet> obj(getStrongRefItem(&MXF_ITEM_K(DMSegment, DMFramework)));
+    auto_ptr<MetadataSet> obj(getStrongRefItem(DMFRAMEWORK_SLOT, &MXF_ITEM_K(DMSegment, DMFramework)));
     MXFPP_CHECK(dynamic_cast<DMFramework*>(obj.get()) != 0);
     return dynamic_cast<DMFramework*>(obj.release());
 }
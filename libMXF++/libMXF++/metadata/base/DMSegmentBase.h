@@ -73,6 +73,15 @@ public:
 
 
 protected:
+    enum
+    {
+        EVENTSTARTPOSITION_SLOT = StructuralComponent::ITEM_SLOT_END,
+        EVENTCOMMENT_SLOT,
+        TRACKIDS_SLOT,
+        DMFRAMEWORK_SLOT,
+        ITEM_SLOT_END
+    };
+
     DMSegmentBase(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet);
 };
 
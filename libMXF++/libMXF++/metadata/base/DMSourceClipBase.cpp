@@ -59,7 +59,7 @@ DMSourceClipBase::~DMSourceClipBase()
 
 bool DMSourceClipBase::haveDMSourceClipTrackIDs() const
 {
-    return haveItem(&MXF_ITEM_K(DMSourceClip, DMSourceClipTrackIDs));
+    return haveItem(DMSOURCECLIPTRACKIDS_SLOT, &MXF_ITEM_K(DMSourceClip, DMSourceClipTrackIDs));
 }
 
 std::vector<uint32_t> DMSourceClipBase::getDMSourceClipTrackIDs() const
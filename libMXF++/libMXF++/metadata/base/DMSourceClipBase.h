@@ -65,6 +65,12 @@ public:
 
 
 protected:
+    enum
+    {
+        DMSOURCECLIPTRACKIDS_SLOT = SourceClip::ITEM_SLOT_END,
+        ITEM_SLOT_END
+    };
+
     DMSourceClipBase(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet);
 };
 
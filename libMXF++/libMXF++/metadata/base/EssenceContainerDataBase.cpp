@@ -59,22 +59,22 @@ EssenceContainerDataBase::~EssenceContainerDataBase()
 
 mxfUMID EssenceContainerDataBase::getLinkedPackageUID() const
 {
-    return getUMIDItem(&MXF_ITEM_K(EssenceContainerData, LinkedPackageUID));
+    return getUMIDItem(LINKEDPACKAGEUID_SLOT, &MXF_ITEM_K(EssenceContainerData, LinkedPackageUID));
 }
 
 bool EssenceContainerDataBase::haveIndexSID() const
 {
-    return haveItem(&MXF_ITEM_K(EssenceContainerData, IndexSID));
+    return haveItem(INDEXSID_SLOT, &MXF_ITEM_K(EssenceContainerData, IndexSID));
 }
 
 uint32_t EssenceContainerDataBase::getIndexSID() const
 {
-    return getUInt32Item(&MXF_ITEM_K(EssenceContainerData, IndexSID));
+    return getUInt32Item(INDEXSID_SLOT, &MXF_ITEM_K(EssenceContainerData, IndexSID));
 }
 
 uint32_t EssenceContainerDataBase::getBodySID() const
 {
-    return getUInt32Item(&MXF_ITEM_K(EssenceContainerData, BodySID));
+    return getUInt32Item(BODYSID_SLOT, &MXF_ITEM_K(EssenceContainerData, BodySID));
 }
 
 void EssenceContainerDataBase::setLinkedPackageUID(mxfUMID value)
@@ -68,6 +68,14 @@ public:
 
 
 protected:
+    enum
+    {
+        LINKEDPACKAGEUID_SLOT = InterchangeObject::ITEM_SLOT_END,
+        INDEXSID_SLOT,
+        BODYSID_SLOT,
+        ITEM_SLOT_END
+    };
+
     EssenceContainerDataBase(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet);
 };
 
@@ -59,17 +59,17 @@ EventTrackBase::~EventTrackBase()
 
 mxfRational EventTrackBase::getEventEditRate() const
 {
-    return getRationalItem(&MXF_ITEM_K(EventTrack, EventEditRate));
+    return getRationalItem(EVENTEDITRATE_SLOT, &MXF_ITEM_K(EventTrack, EventEditRate));
 }
 
 bool EventTrackBase::haveEventOrigin() const
 {
-    return haveItem(&MXF_ITEM_K(EventTrack, EventOrigin));
+    return haveItem(EVENTORIGIN_SLOT, &MXF_ITEM_K(EventTrack, EventOrigin));
 }
 
 int64_t EventTrackBase::getEventOrigin() const
 {
-    return getPositionItem(&MXF_ITEM_K(EventTrack, EventOrigin));
+    return getPositionItem(EVENTORIGIN_SLOT, &MXF_ITEM_K(EventTrack, EventOrigin));
 }
 
 void EventTrackBase::setEventEditRate(mxfRational value)
@@ -66,6 +66,13 @@ public:
 
 
 protected:
+    enum
+    {
+        EVENTEDITRATE_SLOT = GenericTrack::ITEM_SLOT_END,
+        EVENTORIGIN_SLOT,
+        ITEM_SLOT_END
+    };
+
     EventTrackBase(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet);
 };
 
@@ -59,42 +59,42 @@ FileDescriptorBase::~FileDescriptorBase()
 
 bool FileDescriptorBase::haveLinkedTrackID() const
 {
-    return haveItem(&MXF_ITEM_K(FileDescriptor, LinkedTrackID));
+    return haveItem(LINKEDTRACKID_SLOT, &MXF_ITEM_K(FileDescriptor, LinkedTrackID));
 }
 
 uint32_t FileDescriptorBase::getLinkedTrackID() const
 {
-    return getUInt32Item(&MXF_ITEM_K(FileDescriptor, LinkedTrackID));
+    return getUInt32Item(LINKEDTRACKID_SLOT, &MXF_ITEM_K(FileDescriptor, LinkedTrackID));
 }
 
 mxfRational FileDescriptorBase::getSampleRate() const
 {
-    return getRationalItem(&MXF_ITEM_K(FileDescriptor, SampleRate));
+    return getRationalItem(SAMPLERATE_SLOT, &MXF_ITEM_K(FileDescriptor, SampleRate));
 }
 
 bool FileDescriptorBase::haveContainerDuration() const
 {
-    return haveItem(&MXF_ITEM_K(FileDescriptor, ContainerDuration));
+    return haveItem(CONTAINERDURATION_SLOT, &MXF_ITEM_K(FileDescriptor, ContainerDuration));
 }
 
 int64_t FileDescriptorBase::getContainerDuration() const
 {
-    return getLengthItem(&MXF_ITEM_K(FileDescriptor, ContainerDuration));
+    return getLengthItem(CONTAINERDURATION_SLOT, &MXF_ITEM_K(FileDescriptor, ContainerDuration));
 }
 
 mxfUL FileDescriptorBase::getEssenceContainer() const
 {
-    return getULItem(&MXF_ITEM_K(FileDescriptor, EssenceContainer));
+    return getULItem(ESSENCECONTAINER_SLOT, &MXF_ITEM_K(FileDescriptor, EssenceContainer));
 }
 
 bool FileDescriptorBase::haveCodec() const
 {
-    return haveItem(&MXF_ITEM_K(FileDescriptor, Codec));
+    return haveItem(CODEC_SLOT, &MXF_ITEM_K(FileDescriptor, Codec));
 }
 
 mxfUL FileDescriptorBase::getCodec() const
 {
-    return getULItem(&MXF_ITEM_K(FileDescriptor, Codec));
+    return getULItem(CODEC_SLOT, &MXF_ITEM_K(FileDescriptor, Codec));
 }
 
 void FileDescriptorBase::setLinkedTrackID(uint32_t value)
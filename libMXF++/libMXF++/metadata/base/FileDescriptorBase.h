@@ -74,6 +74,16 @@ public:
 
 
 protected:
+    enum
+    {
+        LINKEDTRACKID_SLOT = GenericDescriptor::ITEM_SLOT_END,
+        SAMPLERATE_SLOT,
+        CONTAINERDURATION_SLOT,
+        ESSENCECONTAINER_SLOT,
+        CODEC_SLOT,
+        ITEM_SLOT_END
+    };
+
     FileDescriptorBase(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet);
 };
 
@@ -59,12 +59,12 @@ GenericDataEssenceDescriptorBase::~GenericDataEssenceDescriptorBase()
 
 bool GenericDataEssenceDescriptorBase::haveDataEssenceCoding() const
 {
-    return haveItem(&MXF_ITEM_K(GenericDataEssenceDescriptor, DataEssenceCoding));
+    return haveItem(DATAESSENCECODING_SLOT, &MXF_ITEM_K(GenericDataEssenceDescriptor, DataEssenceCoding));
 }
 
 mxfUL GenericDataEssenceDescriptorBase::getDataEssenceCoding() const
 {
-    return getULItem(&MXF_ITEM_K(GenericDataEssenceDescriptor, DataEssenceCoding));
+    return getULItem(DATAESSENCECODING_SLOT, &MXF_ITEM_K(GenericDataEssenceDescriptor, DataEssenceCoding));
 }
 
 void GenericDataEssenceDescriptorBase::setDataEssenceCoding(mxfUL value)
@@ -64,6 +64,12 @@ public:
 
 
 protected:
+    enum
+    {
+        DATAESSENCECODING_SLOT = FileDescriptor::ITEM_SLOT_END,
+        ITEM_SLOT_END
+    };
+
     GenericDataEssenceDescriptorBase(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet);
 };
 
@@ -61,7 +61,7 @@ GenericDescriptorBase::~GenericDescriptorBase()
 
 bool GenericDescriptorBase::haveLocators() const
 {
-    return haveItem(&MXF_ITEM_K(GenericDescriptor, Locators));
+    return haveItem(LOCATORS_SLOT, &MXF_ITEM_K(GenericDescriptor, Locators));
 }
 
 std::vector<Locator*> GenericDescriptorBase::getLocators() const
@@ -78,7 +78,7 @@ std::vector<Locator*> GenericDescriptorBase::getLocators() const
 
 bool GenericDescriptorBase::haveSubDescriptors() const
 {
-    return haveItem(&MXF_ITEM_K(GenericDescriptor, SubDescriptors));
+    return haveItem(SUBDESCRIPTORS_SLOT, &MXF_ITEM_K(GenericDescriptor, SubDescriptors));
 }
 
 std::vector<SubDescriptor*> GenericDescriptorBase::getSubDescriptors() const
@@ -69,6 +69,13 @@ public:
 
 
 protected:
+    enum
+    {
+        LOCATORS_SLOT = InterchangeObject::ITEM_SLOT_END,
+        SUBDESCRIPTORS_SLOT,
+        ITEM_SLOT_END
+    };
+
     GenericDescriptorBase(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet);
 };
 
@@ -61,12 +61,12 @@ GenericPackageBase::~GenericPackageBase()
 
 mxfUMID GenericPackageBase::getPackageUID() const
 {
-    return getUMIDItem(&MXF_ITEM_K(GenericPackage, PackageUID));
+    return getUMIDItem(PACKAGEUID_SLOT, &MXF_ITEM_K(GenericPackage, PackageUID));
 }
 
 bool GenericPackageBase::haveName() const
 {
-    return haveItem(&MXF_ITEM_K(GenericPackage, Name));
+    return haveItem(NAME_SLOT, &MXF_ITEM_K(GenericPackage, Name));
 }
 
 std::string GenericPackageBase::getName() const
@@ -76,12 +76,12 @@ std::string GenericPackageBase::getName() const
 
 mxfTimestamp GenericPackageBase::getPackageCreationDate() const
 {
-    return getTimestampItem(&MXF_ITEM_K(GenericPackage, PackageCreationDate));
+    return getTimestampItem(PACKAGECREATIONDATE_SLOT, &MXF_ITEM_K(GenericPackage, PackageCreationDate));
 }
 
 mxfTimestamp GenericPackageBase::getPackageModifiedDate() const
 {
-    return getTimestampItem(&MXF_ITEM_K(GenericPackage, PackageModifiedDate));
+    return getTimestampItem(PACKAGEMODIFIEDDATE_SLOT, &MXF_ITEM_K(GenericPackage, PackageModifiedDate));
 }
 
 std::vector<GenericTrack*> GenericPackageBase::getTracks() const
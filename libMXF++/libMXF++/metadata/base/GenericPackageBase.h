@@ -73,6 +73,16 @@ public:
 
 
 protected:
+    enum
+    {
+        PACKAGEUID_SLOT = InterchangeObject::ITEM_SLOT_END,
+        NAME_SLOT,
+        PACKAGECREATIONDATE_SLOT,
+        PACKAGEMODIFIEDDATE_SLOT,
+        USERCOMMENTS_SLOT,
+        ITEM_SLOT_END
+    };
+
     GenericPackageBase(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet);
 };
 
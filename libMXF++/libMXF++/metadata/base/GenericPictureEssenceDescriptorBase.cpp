@@ -59,167 +59,167 @@ GenericPictureEssenceDescriptorBase::~GenericPictureEssenceDescriptorBase()
 
 bool GenericPictureEssenceDescriptorBase::haveSignalStandard() const
 {
-    return haveItem(&MXF_ITEM_K(GenericPictureEssenceDescriptor, SignalStandard));
+    return haveItem(SIGNALSTANDARD_SLOT, &MXF_ITEM_K(GenericPictureEssenceDescriptor, SignalStandard));
 }
 
 uint8_t GenericPictureEssenceDescriptorBase::getSignalStandard() const
 {
-    return getUInt8Item(&MXF_ITEM_K(GenericPictureEssenceDescriptor, SignalStandard));
+    return getUInt8Item(SIGNALSTANDARD_SLOT, &MXF_ITEM_K(GenericPictureEssenceDescriptor, SignalStandard));
 }
 
 bool GenericPictureEssenceDescriptorBase::haveFrameLayout() const
 {
-    return haveItem(&MXF_ITEM_K(GenericPictureEssenceDescriptor, FrameLayout));
+    return haveItem(FRAMELAYOUT_SLOT, &MXF_ITEM_K(GenericPictureEssenceDescriptor, FrameLayout));
 }
 
 uint8_t GenericPictureEssenceDescriptorBase::getFrameLayout() const
 {
-    return getUInt8Item(&MXF_ITEM_K(GenericPictureEssenceDescriptor, FrameLayout));
+    return getUInt8Item(FRAMELAYOUT_SLOT, &MXF_ITEM_K(GenericPictureEssenceDescriptor, FrameLayout));
 }
 
 bool GenericPictureEssenceDescriptorBase::haveStoredWidth() const
 {
-    return haveItem(&MXF_ITEM_K(GenericPictureEssenceDescriptor, StoredWidth));
+    return haveItem(STOREDWIDTH_SLOT, &MXF_ITEM_K(GenericPictureEssenceDescriptor, StoredWidth));
 }
 
 uint32_t GenericPictureEssenceDescriptorBase::getStoredWidth() const
 {
-    return getUInt32Item(&MXF_ITEM_K(GenericPictureEssenceDescriptor, StoredWidth));
+    return getUInt32Item(STOREDWIDTH_SLOT, &MXF_ITEM_K(GenericPictureEssenceDescriptor, StoredWidth));
 }
 
 bool GenericPictureEssenceDescriptorBase::haveStoredHeight() const
 {
-    return haveItem(&MXF_ITEM_K(GenericPictureEssenceDescriptor, StoredHeight));
+    return haveItem(STOREDHEIGHT_SLOT, &MXF_ITEM_K(GenericPictureEssenceDescriptor, StoredHeight));
 }
 
 uint32_t GenericPictureEssenceDescriptorBase::getStoredHeight() const
 {
-    return getUInt32Item(&MXF_ITEM_K(GenericPictureEssenceDescriptor, StoredHeight));
+    return getUInt32Item(STOREDHEIGHT_SLOT, &MXF_ITEM_K(GenericPictureEssenceDescriptor, StoredHeight));
 }
 
 bool GenericPictureEssenceDescriptorBase::haveStoredF2Offset() const
 {
-    return haveItem(&MXF_ITEM_K(GenericPictureEssenceDescriptor, StoredF2Offset));
+    return haveItem(STOREDF2OFFSET_SLOT, &MXF_ITEM_K(GenericPictureEssenceDescriptor, StoredF2Offset));
 }
 
 int32_t GenericPictureEssenceDescriptorBase::getStoredF2Offset() const
 {
-    return getInt32Item(&MXF_ITEM_K(GenericPictureEssenceDescriptor, StoredF2Offset));
+    return getInt32Item(STOREDF2OFFSET_SLOT, &MXF_ITEM_K(GenericPictureEssenceDescriptor, StoredF2Offset));
 }
 
 bool GenericPictureEssenceDescriptorBase::haveSampledWidth() const
 {
-    return haveItem(&MXF_ITEM_K(GenericPictureEssenceDescriptor, SampledWidth));
+    return haveItem(SAMPLEDWIDTH_SLOT, &MXF_ITEM_K(GenericPictureEssenceDescriptor, SampledWidth));
 }
 
 uint32_t GenericPictureEssenceDescriptorBase::getSampledWidth() const
 {
-    return getUInt32Item(&MXF_ITEM_K(GenericPictureEssenceDescriptor, SampledWidth));
+    return getUInt32Item(SAMPLEDWIDTH_SLOT, &MXF_ITEM_K(GenericPictureEssenceDescriptor, SampledWidth));
 }
 
 bool GenericPictureEssenceDescriptorBase::haveSampledHeight() const
 {
-    return haveItem(&MXF_ITEM_K(GenericPictureEssenceDescriptor, SampledHeight));
+    return haveItem(SAMPLEDHEIGHT_SLOT, &MXF_ITEM_K(GenericPictureEssenceDescriptor, SampledHeight));
 }
 
 uint32_t GenericPictureEssenceDescriptorBase::getSampledHeight() const
 {
-    return getUInt32Item(&MXF_ITEM_K(GenericPictureEssenceDescriptor, SampledHeight));
+    return getUInt32Item(SAMPLEDHEIGHT_SLOT, &MXF_ITEM_K(GenericPictureEssenceDescriptor, SampledHeight));
 }
 
 bool GenericPictureEssenceDescriptorBase::haveSampledXOffset() const
 {
-    return haveItem(&MXF_ITEM_K(GenericPictureEssenceDescriptor, SampledXOffset));
+    return haveItem(SAMPLEDXOFFSET_SLOT, &MXF_ITEM_K(GenericPictureEssenceDescriptor, SampledXOffset));
 }
 
 int32_t GenericPictureEssenceDescriptorBase::getSampledXOffset() const
 {
-    return getInt32Item(&MXF_ITEM_K(GenericPictureEssenceDescriptor, SampledXOffset));
+    return getInt32Item(SAMPLEDXOFFSET_SLOT, &MXF_ITEM_K(GenericPictureEssenceDescriptor, SampledXOffset));
 }
 
 bool GenericPictureEssenceDescriptorBase::haveSampledYOffset() const
 {
-    return haveItem(&MXF_ITEM_K(GenericPictureEssenceDescriptor, SampledYOffset));
+    return haveItem(SAMPLEDYOFFSET_SLOT, &MXF_ITEM_K(GenericPictureEssenceDescriptor, SampledYOffset));
 }
 
 int32_t GenericPictureEssenceDescriptorBase::getSampledYOffset() const
 {
-    return getInt32Item(&MXF_ITEM_K(GenericPictureEssenceDescriptor, SampledYOffset));
+    return getInt32Item(SAMPLEDYOFFSET_SLOT, &MXF_ITEM_K(GenericPictureEssenceDescriptor, SampledYOffset));
 }
 
 bool GenericPictureEssenceDescriptorBase::haveDisplayHeight() const
 {
-    return haveItem(&MXF_ITEM_K(GenericPictureEssenceDescriptor, DisplayHeight));
+    return haveItem(DISPLAYHEIGHT_SLOT, &MXF_ITEM_K(GenericPictureEssenceDescriptor, DisplayHeight));
 }
 
 uint32_t GenericPictureEssenceDescriptorBase::getDisplayHeight() const
 {
-    return getUInt32Item(&MXF_ITEM_K(GenericPictureEssenceDescriptor, DisplayHeight));
+    return getUInt32Item(DISPLAYHEIGHT_SLOT, &MXF_ITEM_K(GenericPictureEssenceDescriptor, DisplayHeight));
 }
 
 bool GenericPictureEssenceDescriptorBase::haveDisplayWidth() const
 {
-    return haveItem(&MXF_ITEM_K(GenericPictureEssenceDescriptor, DisplayWidth));
+    return haveItem(DISPLAYWIDTH_SLOT, &MXF_ITEM_K(GenericPictureEssenceDescriptor, DisplayWidth));
 }
 
 uint32_t GenericPictureEssenceDescriptorBase::getDisplayWidth() const
 {
-    return getUInt32Item(&MXF_ITEM_K(GenericPictureEssenceDescriptor, DisplayWidth));
+    return getUInt32Item(DISPLAYWIDTH_SLOT, &MXF_ITEM_K(GenericPictureEssenceDescriptor, DisplayWidth));
 }
 
 bool GenericPictureEssenceDescriptorBase::haveDisplayXOffset() const
 {
-    return haveItem(&MXF_ITEM_K(GenericPictureEssenceDescriptor, DisplayXOffset));
+    return haveItem(DISPLAYXOFFSET_SLOT, &MXF_ITEM_K(GenericPictureEssenceDescriptor, DisplayXOffset));
 }
 
 int32_t GenericPictureEssenceDescriptorBase::getDisplayXOffset() const
 {
-    return getInt32Item(&MXF_ITEM_K(GenericPictureEssenceDescriptor, DisplayXOffset));
+    return getInt32Item(DISPLAYXOFFSET_SLOT, &MXF_ITEM_K(GenericPictureEssenceDescriptor, DisplayXOffset));
 }
 
 bool GenericPictureEssenceDescriptorBase::haveDisplayYOffset() const
 {
-    return haveItem(&MXF_ITEM_K(GenericPictureEssenceDescriptor, DisplayYOffset));
+    return haveItem(DISPLAYYOFFSET_SLOT, &MXF_ITEM_K(GenericPictureEssenceDescriptor, DisplayYOffset));
 }
 
 int32_t GenericPictureEssenceDescriptorBase::getDisplayYOffset() const
 {
-    return getInt32Item(&MXF_ITEM_K(GenericPictureEssenceDescriptor, DisplayYOffset));
+    return getInt32Item(DISPLAYYOFFSET_SLOT, &MXF_ITEM_K(GenericPictureEssenceDescriptor, DisplayYOffset));
 }
 
 bool GenericPictureEssenceDescriptorBase::haveDisplayF2Offset() const
 {
-    return haveItem(&MXF_ITEM_K(GenericPictureEssenceDescriptor, DisplayF2Offset));
+    return haveItem(DISPLAYF2OFFSET_SLOT, &MXF_ITEM_K(GenericPictureEssenceDescriptor, DisplayF2Offset));
 }
 
 int32_t GenericPictureEssenceDescriptorBase::getDisplayF2Offset() const
 {
-    return getInt32Item(&MXF_ITEM_K(GenericPictureEssenceDescriptor, DisplayF2Offset));
+    return getInt32Item(DISPLAYF2OFFSET_SLOT, &MXF_ITEM_K(GenericPictureEssenceDescriptor, DisplayF2Offset));
 }
 
 bool GenericPictureEssenceDescriptorBase::haveAspectRatio() const
 {
-    return haveItem(&MXF_ITEM_K(GenericPictureEssenceDescriptor, AspectRatio));
+    return haveItem(ASPECTRATIO_SLOT, &MXF_ITEM_K(GenericPictureEssenceDescriptor, AspectRatio));
 }
 
 mxfRational GenericPictureEssenceDescriptorBase::getAspectRatio() const
 {
-    return getRationalItem(&MXF_ITEM_K(GenericPictureEssenceDescriptor, AspectRatio));
+    return getRationalItem(ASPECTRATIO_SLOT, &MXF_ITEM_K(GenericPictureEssenceDescriptor, AspectRatio));
 }
 
 bool GenericPictureEssenceDescriptorBase::haveActiveFormatDescriptor() const
 {
-    return haveItem(&MXF_ITEM_K(GenericPictureEssenceDescriptor, ActiveFormatDescriptor));
+    return haveItem(ACTIVEFORMATDESCRIPTOR_SLOT, &MXF_ITEM_K(GenericPictureEssenceDescriptor, ActiveFormatDescriptor));
 }
 
 uint8_t GenericPictureEssenceDescriptorBase::getActiveFormatDescriptor() const
 {
-    return getUInt8Item(&MXF_ITEM_K(GenericPictureEssenceDescriptor, ActiveFormatDescriptor));
+    return getUInt8Item(ACTIVEFORMATDESCRIPTOR_SLOT, &MXF_ITEM_K(GenericPictureEssenceDescriptor, ActiveFormatDescriptor));
 }
 
 bool GenericPictureEssenceDescriptorBase::haveVideoLineMap() const
 {
-    return haveItem(&MXF_ITEM_K(GenericPictureEssenceDescriptor, VideoLineMap));
+    return haveItem(VIDEOLINEMAP_SLOT, &MXF_ITEM_K(GenericPictureEssenceDescriptor, VideoLineMap));
 }
 
 std::vector<int32_t> GenericPictureEssenceDescriptorBase::getVideoLineMap() const
@@ -229,92 +229,92 @@ std::vector<int32_t> GenericPictureEssenceDescriptorBase::getVideoLineMap() cons
 
 bool GenericPictureEssenceDescriptorBase::haveAlphaTransparency() const
 {
-    return haveItem(&MXF_ITEM_K(GenericPictureEssenceDescriptor, AlphaTransparency));
+    return haveItem(ALPHATRANSPARENCY_SLOT, &MXF_ITEM_K(GenericPictureEssenceDescriptor, AlphaTransparency));
 }
 
 uint8_t GenericPictureEssenceDescriptorBase::getAlphaTransparency() const
 {
-    return getUInt8Item(&MXF_ITEM_K(GenericPictureEssenceDescriptor, AlphaTransparency));
+    return getUInt8Item(ALPHATRANSPARENCY_SLOT, &MXF_ITEM_K(GenericPictureEssenceDescriptor, AlphaTransparency));
 }
 
 bool GenericPictureEssenceDescriptorBase::haveCaptureGamma() const
 {
-    return haveItem(&MXF_ITEM_K(GenericPictureEssenceDescriptor, CaptureGamma));
+    return haveItem(CAPTUREGAMMA_SLOT, &MXF_ITEM_K(GenericPictureEssenceDescriptor, CaptureGamma));
 }
 
 mxfUL GenericPictureEssenceDescriptorBase::getCaptureGamma() const
 {
-    return getULItem(&MXF_ITEM_K(GenericPictureEssenceDescriptor, CaptureGamma));
+    return getULItem(CAPTUREGAMMA_SLOT, &MXF_ITEM_K(GenericPictureEssenceDescriptor, CaptureGamma));
 }
 
 bool GenericPictureEssenceDescriptorBase::haveImageAlignmentOffset() const
 {
-    return haveItem(&MXF_ITEM_K(GenericPictureEssenceDescriptor, ImageAlignmentOffset));
+    return haveItem(IMAGEALIGNMENTOFFSET_SLOT, &MXF_ITEM_K(GenericPictureEssenceDescriptor, ImageAlignmentOffset));
 }
 
 uint32_t GenericPictureEssenceDescriptorBase::getImageAlignmentOffset() const
 {
-    return getUInt32Item(&MXF_ITEM_K(GenericPictureEssenceDescriptor, ImageAlignmentOffset));
+    return getUInt32Item(IMAGEALIGNMENTOFFSET_SLOT, &MXF_ITEM_K(GenericPictureEssenceDescriptor, ImageAlignmentOffset));
 }
 
 bool GenericPictureEssenceDescriptorBase::haveImageStartOffset() const
 {
-    return haveItem(&MXF_ITEM_K(GenericPictureEssenceDescriptor, ImageStartOffset));
+    return haveItem(IMAGESTARTOFFSET_SLOT, &MXF_ITEM_K(GenericPictureEssenceDescriptor, ImageStartOffset));
 }
 
 uint32_t GenericPictureEssenceDescriptorBase::getImageStartOffset() const
 {
-    return getUInt32Item(&MXF_ITEM_K(GenericPictureEssenceDescriptor, ImageStartOffset));
+    return getUInt32Item(IMAGESTARTOFFSET_SLOT, &MXF_ITEM_K(GenericPictureEssenceDescriptor, ImageStartOffset));
 }
 
 bool GenericPictureEssenceDescriptorBase::haveImageEndOffset() const
 {
-    return haveItem(&MXF_ITEM_K(GenericPictureEssenceDescriptor, ImageEndOffset));
+    return haveItem(IMAGEENDOFFSET_SLOT, &MXF_ITEM_K(GenericPictureEssenceDescriptor, ImageEndOffset));
 }
 
 uint32_t GenericPictureEssenceDescriptorBase::getImageEndOffset() const
 {
-    return getUInt32Item(&MXF_ITEM_K(GenericPictureEssenceDescriptor, ImageEndOffset));
+    return getUInt32Item(IMAGEENDOFFSET_SLOT, &MXF_ITEM_K(GenericPictureEssenceDescriptor, ImageEndOffset));
 }
 
 bool GenericPictureEssenceDescriptorBase::haveFieldDominance() const
 {
-    return haveItem(&MXF_ITEM_K(GenericPictureEssenceDescriptor, FieldDominance));
+    return haveItem(FIELDDOMINANCE_SLOT, &MXF_ITEM_K(GenericPictureEssenceDescriptor, FieldDominance));
 }
 
 uint8_t GenericPictureEssenceDescriptorBase::getFieldDominance() const
 {
-    return getUInt8Item(&MXF_ITEM_K(GenericPictureEssenceDescriptor, FieldDominance));
+    return getUInt8Item(FIELDDOMINANCE_SLOT, &MXF_ITEM_K(GenericPictureEssenceDescriptor, FieldDominance));
 }
 
 bool GenericPictureEssenceDescriptorBase::havePictureEssenceCoding() const
 {
-    return haveItem(&MXF_ITEM_K(GenericPictureEssenceDescriptor, PictureEssenceCoding));
+    return haveItem(PICTUREESSENCECODING_SLOT, &MXF_ITEM_K(GenericPictureEssenceDescriptor, PictureEssenceCoding));
 }
 
 mxfUL GenericPictureEssenceDescriptorBase::getPictureEssenceCoding() const
 {
-    return getULItem(&MXF_ITEM_K(GenericPictureEssenceDescriptor, PictureEssenceCoding));
+    return getULItem(PICTUREESSENCECODING_SLOT, &MXF_ITEM_K(GenericPictureEssenceDescriptor, PictureEssenceCoding));
 }
 
 bool GenericPictureEssenceDescriptorBase::haveCodingEquations() const
 {
-    return haveItem(&MXF_ITEM_K(GenericPictureEssenceDescriptor, CodingEquations));
+    return haveItem(CODINGEQUATIONS_SLOT, &MXF_ITEM_K(GenericPictureEssenceDescriptor, CodingEquations));
 }
 
 mxfUL GenericPictureEssenceDescriptorBase::getCodingEquations() const
 {
-    return getULItem(&MXF_ITEM_K(GenericPictureEssenceDescriptor, CodingEquations));
+    return getULItem(CODINGEQUATIONS_SLOT, &MXF_ITEM_K(GenericPictureEssenceDescriptor, CodingEquations));
 }
 
 bool GenericPictureEssenceDescriptorBase::haveColorPrimaries() const
 {
-    return haveItem(&MXF_ITEM_K(GenericPictureEssenceDescriptor, ColorPrimaries));
+    return haveItem(COLORPRIMARIES_SLOT, &MXF_ITEM_K(GenericPictureEssenceDescriptor, ColorPrimaries));
 }
 
 mxfUL GenericPictureEssenceDescriptorBase::getColorPrimaries() const
 {
-    return getULItem(&MXF_ITEM_K(GenericPictureEssenceDescriptor, ColorPrimaries));
+    return getULItem(COLORPRIMARIES_SLOT, &MXF_ITEM_K(GenericPictureEssenceDescriptor, ColorPrimaries));
 }
 
 void GenericPictureEssenceDescriptorBase::setSignalStandard(uint8_t value)
@@ -140,6 +140,37 @@ public:
 
 
 protected:
+    enum
+    {
+        SIGNALSTANDARD_SLOT = FileDescriptor::ITEM_SLOT_END,
+        FRAMELAYOUT_SLOT,
+        STOREDWIDTH_SLOT,
+        STOREDHEIGHT_SLOT,
+        STOREDF2OFFSET_SLOT,
+        SAMPLEDWIDTH_SLOT,
+        SAMPLEDHEIGHT_SLOT,
+        SAMPLEDXOFFSET_SLOT,
+        SAMPLEDYOFFSET_SLOT,
+        DISPLAYHEIGHT_SLOT,
+        DISPLAYWIDTH_SLOT,
+        DISPLAYXOFFSET_SLOT,
+        DISPLAYYOFFSET_SLOT,
+        DISPLAYF2OFFSET_SLOT,
+        ASPECTRATIO_SLOT,
+        ACTIVEFORMATDESCRIPTOR_SLOT,
+        VIDEOLINEMAP_SLOT,
+        ALPHATRANSPARENCY_SLOT,
+        CAPTUREGAMMA_SLOT,
+        IMAGEALIGNMENTOFFSET_SLOT,
+        IMAGESTARTOFFSET_SLOT,
+        IMAGEENDOFFSET_SLOT,
+        FIELDDOMINANCE_SLOT,
+        PICTUREESSENCECODING_SLOT,
+        CODINGEQUATIONS_SLOT,
+        COLORPRIMARIES_SLOT,
+        ITEM_SLOT_END
+    };
+
     GenericPictureEssenceDescriptorBase(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet);
 };
 
@@ -59,82 +59,82 @@ GenericSoundEssenceDescriptorBase::~GenericSoundEssenceDescriptorBase()
 
 bool GenericSoundEssenceDescriptorBase::haveAudioSamplingRate() const
 {
-    return haveItem(&MXF_ITEM_K(GenericSoundEssenceDescriptor, AudioSamplingRate));
+    return haveItem(AUDIOSAMPLINGRATE_SLOT, &MXF_ITEM_K(GenericSoundEssenceDescriptor, AudioSamplingRate));
 }
 
 mxfRational GenericSoundEssenceDescriptorBase::getAudioSamplingRate() const
 {
-    return getRationalItem(&MXF_ITEM_K(GenericSoundEssenceDescriptor, AudioSamplingRate));
+    return getRationalItem(AUDIOSAMPLINGRATE_SLOT, &MXF_ITEM_K(GenericSoundEssenceDescriptor, AudioSamplingRate));
 }
 
 bool GenericSoundEssenceDescriptorBase::haveLocked() const
 {
-    return haveItem(&MXF_ITEM_K(GenericSoundEssenceDescriptor, Locked));
+    return haveItem(LOCKED_SLOT, &MXF_ITEM_K(GenericSoundEssenceDescriptor, Locked));
 }
 
 bool GenericSoundEssenceDescriptorBase::getLocked() const
 {
-    return getBooleanItem(&MXF_ITEM_K(GenericSoundEssenceDescriptor, Locked));
+    return getBooleanItem(LOCKED_SLOT, &MXF_ITEM_K(GenericSoundEssenceDescriptor, Locked));
 }
 
 bool GenericSoundEssenceDescriptorBase::haveAudioRefLevel() const
 {
-    return haveItem(&MXF_ITEM_K(GenericSoundEssenceDescriptor, AudioRefLevel));
+    return haveItem(AUDIOREFLEVEL_SLOT, &MXF_ITEM_K(GenericSoundEssenceDescriptor, AudioRefLevel));
 }
 
 int8_t GenericSoundEssenceDescriptorBase::getAudioRefLevel() const
 {
-    return getInt8Item(&MXF_ITEM_K(GenericSoundEssenceDescriptor, AudioRefLevel));
+    return getInt8Item(AUDIOREFLEVEL_SLOT, &MXF_ITEM_K(GenericSoundEssenceDescriptor, AudioRefLevel));
 }
 
 bool GenericSoundEssenceDescriptorBase::haveElectroSpatialFormulation() const
 {
-    return haveItem(&MXF_ITEM_K(GenericSoundEssenceDescriptor, ElectroSpatialFormulation));
+    return haveItem(ELECTROSPATIALFORMULATION_SLOT, &MXF_ITEM_K(GenericSoundEssenceDescriptor, ElectroSpatialFormulation));
 }
 
 uint8_t GenericSoundEssenceDescriptorBase::getElectroSpatialFormulation() const
 {
-    return getUInt8Item(&MXF_ITEM_K(GenericSoundEssenceDescriptor, ElectroSpatialFormulation));
+    return getUInt8Item(ELECTROSPATIALFORMULATION_SLOT, &MXF_ITEM_K(GenericSoundEssenceDescriptor, ElectroSpatialFormulation));
 }
 
 bool GenericSoundEssenceDescriptorBase::haveChannelCount() const
 {
-    return haveItem(&MXF_ITEM_K(GenericSoundEssenceDescriptor, ChannelCount));
+    return haveItem(CHANNELCOUNT_SLOT, &MXF_ITEM_K(GenericSoundEssenceDescriptor, ChannelCount));
 }
 
 uint32_t GenericSoundEssenceDescriptorBase::getChannelCount() const
 {
-    return getUInt32Item(&MXF_ITEM_K(GenericSoundEssenceDescriptor, ChannelCount));
+    return getUInt32Item(CHANNELCOUNT_SLOT, &MXF_ITEM_K(GenericSoundEssenceDescriptor, ChannelCount));
 }
 
 bool GenericSoundEssenceDescriptorBase::haveQuantizationBits() const
 {
-    return haveItem(&MXF_ITEM_K(GenericSoundEssenceDescriptor, QuantizationBits));
+    return haveItem(QUANTIZATIONBITS_SLOT, &MXF_ITEM_K(GenericSoundEssenceDescriptor, QuantizationBits));
 }
 
 uint32_t GenericSoundEssenceDescriptorBase::getQuantizationBits() const
 {
-    return getUInt32Item(&MXF_ITEM_K(GenericSoundEssenceDescriptor, QuantizationBits));
+    return getUInt32Item(QUANTIZATIONBITS_SLOT, &MXF_ITEM_K(GenericSoundEssenceDescriptor, QuantizationBits));
 }
 
 bool GenericSoundEssenceDescriptorBase::haveDialNorm() const
 {
-    return haveItem(&MXF_ITEM_K(GenericSoundEssenceDescriptor, DialNorm));
+    return haveItem(DIALNORM_SLOT, &MXF_ITEM_K(GenericSoundEssenceDescriptor, DialNorm));
 }
 
 int8_t GenericSoundEssenceDescriptorBase::getDialNorm() const
 {
-    return getInt8Item(&MXF_ITEM_K(GenericSoundEssenceDescriptor, DialNorm));
+    return getInt8Item(DIALNORM_SLOT, &MXF_ITEM_K(GenericSoundEssenceDescriptor, DialNorm));
 }
 
 bool GenericSoundEssenceDescriptorBase::haveSoundEssenceCompression() const
 {
-    return haveItem(&MXF_ITEM_K(GenericSoundEssenceDescriptor, SoundEssenceCompression));
+    return haveItem(SOUNDESSENCECOMPRESSION_SLOT, &MXF_ITEM_K(GenericSoundEssenceDescriptor, SoundEssenceCompression));
 }
 
 mxfUL GenericSoundEssenceDescriptorBase::getSoundEssenceCompression() const
 {
-    return getULItem(&MXF_ITEM_K(GenericSoundEssenceDescriptor, SoundEssenceCompression));
+    return getULItem(SOUNDESSENCECOMPRESSION_SLOT, &MXF_ITEM_K(GenericSoundEssenceDescriptor, SoundEssenceCompression));
 }
 
 void GenericSoundEssenceDescriptorBase::setAudioSamplingRate(mxfRational value)
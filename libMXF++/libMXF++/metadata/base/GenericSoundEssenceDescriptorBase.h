@@ -85,6 +85,19 @@ public:
 
 
 protected:
+    enum
+    {
+        AUDIOSAMPLINGRATE_SLOT = FileDescriptor::ITEM_SLOT_END,
+        LOCKED_SLOT,
+        AUDIOREFLEVEL_SLOT,
+        ELECTROSPATIALFORMULATION_SLOT,
+        CHANNELCOUNT_SLOT,
+        QUANTIZATIONBITS_SLOT,
+        DIALNORM_SLOT,
+        SOUNDESSENCECOMPRESSION_SLOT,
+        ITEM_SLOT_END
+    };
+
     GenericSoundEssenceDescriptorBase(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet);
 };
 
@@ -59,7 +59,7 @@ GenericStreamTextBasedSetBase::~GenericStreamTextBasedSetBase()
 
 uint32_t GenericStreamTextBasedSetBase::getGenericStreamSID() const
 {
-    return getUInt32Item(&MXF_ITEM_K(GenericStreamTextBasedSet, GenericStreamSID));
+    return getUInt32Item(GENERICSTREAMSID_SLOT, &MXF_ITEM_K(GenericStreamTextBasedSet, GenericStreamSID));
 }
 
 void GenericStreamTextBasedSetBase::setGenericStreamSID(uint32_t value)
@@ -63,6 +63,12 @@ public:
 
 
 protected:
+    enum
+    {
+        GENERICSTREAMSID_SLOT = TextBasedObject::ITEM_SLOT_END,
+        ITEM_SLOT_END
+    };
+
     GenericStreamTextBasedSetBase(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet);
 };
 
@@ -61,22 +61,22 @@ GenericTrackBase::~GenericTrackBase()
 
 bool GenericTrackBase::haveTrackID() const
 {
-    return haveItem(&MXF_ITEM_K(GenericTrack, TrackID));
+    return haveItem(TRACKID_SLOT, &MXF_ITEM_K(GenericTrack, TrackID));
 }
 
 uint32_t GenericTrackBase::getTrackID() const
 {
-    return getUInt32Item(&MXF_ITEM_K(GenericTrack, TrackID));
+    return getUInt32Item(TRACKID_SLOT, &MXF_ITEM_K(GenericTrack, TrackID));
 }
 
 uint32_t GenericTrackBase::getTrackNumber() const
 {
-    return getUInt32Item(&MXF_ITEM_K(GenericTrack, TrackNumber));
+    return getUInt32Item(TRACKNUMBER_SLOT, &MXF_ITEM_K(GenericTrack, TrackNumber));
 }
 
 bool GenericTrackBase::haveTrackName() const
 {
-    return haveItem(&MXF_ITEM_K(GenericTrack, TrackName));
+    return haveItem(TRACKNAME_SLOT, &MXF_ITEM_K(GenericTrack, TrackName));
 }
 
 std::string GenericTrackBase::getTrackName() const
@@ -86,7 +86,7 @@ std::string GenericTrackBase::getTrackName() const
 
 StructuralComponent* GenericTrackBase::getSequence() const
 {
-    auto_ptr<MetadataSet> obj(getStrongRefItem(&MXF_ITEM_K(GenericTrack, Sequence)));
+    auto_ptr<MetadataSet> obj(getStrongRefItem(SEQUENCE_SLOT, &MXF_ITEM_K(GenericTrack, Sequence)));
     MXFPP_CHECK(dynamic_cast<StructuralComponent*>(obj.get()) != 0);
     return dynamic_cast<StructuralComponent*>(obj.release());
 }
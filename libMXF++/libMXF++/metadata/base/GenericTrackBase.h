@@ -71,6 +71,15 @@ public:
 
 
 protected:
+    enum
+    {
+        TRACKID_SLOT = InterchangeObject::ITEM_SLOT_END,
+        TRACKNUMBER_SLOT,
+        TRACKNAME_SLOT,
+        SEQUENCE_SLOT,
+        ITEM_SLOT_END
+    };
+
     GenericTrackBase(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet);
 };
 
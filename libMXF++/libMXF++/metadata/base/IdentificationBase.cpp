@@ -59,7 +59,7 @@ IdentificationBase::~IdentificationBase()
 
 mxfUUID IdentificationBase::getThisGenerationUID() const
 {
-    return getUUIDItem(&MXF_ITEM_K(Identification, ThisGenerationUID));
+    return getUUIDItem(THISGENERATIONUID_SLOT, &MXF_ITEM_K(Identification, ThisGenerationUID));
 }
 
 std::string IdentificationBase::getCompanyName() const
@@ -74,12 +74,12 @@ std::string IdentificationBase::getProductName() const
 
 bool IdentificationBase::haveProductVersion() const
 {
-    return haveItem(&MXF_ITEM_K(Identification, ProductVersion));
+    return haveItem(PRODUCTVERSION_SLOT, &MXF_ITEM_K(Identification, ProductVersion));
 }
 
 mxfProductVersion IdentificationBase::getProductVersion() const
 {
-    return getProductVersionItem(&MXF_ITEM_K(Identification, ProductVersion));
+    return getProductVersionItem(PRODUCTVERSION_SLOT, &MXF_ITEM_K(Identification, ProductVersion));
 }
 
 std::string IdentificationBase::getVersionString() const
@@ -89,27 +89,27 @@ std::string IdentificationBase::getVersionString() const
 
 mxfUUID IdentificationBase::getProductUID() const
 {
-    return getUUIDItem(&MXF_ITEM_K(Identification, ProductUID));
+    return getUUIDItem(PRODUCTUID_SLOT, &MXF_ITEM_K(Identification, ProductUID));
 }
 
 mxfTimestamp IdentificationBase::getModificationDate() const
 {
-    return getTimestampItem(&MXF_ITEM_K(Identification, ModificationDate));
+    return getTimestampItem(MODIFICATIONDATE_SLOT, &MXF_ITEM_K(Identification, ModificationDate));
 }
 
 bool IdentificationBase::haveToolkitVersion() const
 {
-    return haveItem(&MXF_ITEM_K(Identification, ToolkitVersion));
+    return haveItem(TOOLKITVERSION_SLOT, &MXF_ITEM_K(Identification, ToolkitVersion));
 }
 
 mxfProductVersion IdentificationBase::getToolkitVersion() const
 {
-    return getProductVersionItem(&MXF_ITEM_K(Identification, ToolkitVersion));
+    return getProductVersionItem(TOOLKITVERSION_SLOT, &MXF_ITEM_K(Identification, ToolkitVersion));
 }
 
 bool IdentificationBase::havePlatform() const
 {
-    return haveItem(&MXF_ITEM_K(Identification, Platform));
+    return haveItem(PLATFORM_SLOT, &MXF_ITEM_K(Identification, Platform));
 }
 
 std::string IdentificationBase::getPlatform() const
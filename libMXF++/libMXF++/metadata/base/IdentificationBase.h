@@ -82,6 +82,17 @@ public:
 
 
 protected:
+    enum
+    {
+        THISGENERATIONUID_SLOT = InterchangeObject::ITEM_SLOT_END,
+        PRODUCTVERSION_SLOT,
+        PRODUCTUID_SLOT,
+        MODIFICATIONDATE_SLOT,
+        TOOLKITVERSION_SLOT,
+        PLATFORM_SLOT,
+        ITEM_SLOT_END
+    };
+
     IdentificationBase(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet);
 };
 
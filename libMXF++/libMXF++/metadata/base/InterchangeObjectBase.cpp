@@ -59,17 +59,17 @@ InterchangeObjectBase::~InterchangeObjectBase()
 
 mxfUUID InterchangeObjectBase::getInstanceUID() const
 {
-    return getUUIDItem(&MXF_ITEM_K(InterchangeObject, InstanceUID));
+    return getUUIDItem(INSTANCEUID_SLOT, &MXF_ITEM_K(InterchangeObject, InstanceUID));
 }
 
 bool InterchangeObjectBase::haveGenerationUID() const
 {
-    return haveItem(&MXF_ITEM_K(InterchangeObject, GenerationUID));
+    return haveItem(GENERATIONUID_SLOT, &MXF_ITEM_K(InterchangeObject, GenerationUID));
 }
 
 mxfUUID InterchangeObjectBase::getGenerationUID() const
 {
-    return getUUIDItem(&MXF_ITEM_K(InterchangeObject, GenerationUID));
+    return getUUIDItem(GENERATIONUID_SLOT, &MXF_ITEM_K(InterchangeObject, GenerationUID));
 }
 
 void InterchangeObjectBase::setInstanceUID(mxfUUID value)
@@ -66,6 +66,13 @@ public:
 
 
 protected:
+    enum
+    {
+        INSTANCEUID_SLOT = MetadataSet::ITEM_SLOT_END,
+        GENERATIONUID_SLOT,
+        ITEM_SLOT_END
+    };
+
     InterchangeObjectBase(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet);
 };
 
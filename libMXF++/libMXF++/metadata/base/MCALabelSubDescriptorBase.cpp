@@ -59,17 +59,17 @@ MCALabelSubDescriptorBase::~MCALabelSubDescriptorBase()
 
 bool MCALabelSubDescriptorBase::haveMCAChannelID() const
 {
-    return haveItem(&MXF_ITEM_K(MCALabelSubDescriptor, MCAChannelID));
+    return haveItem(MCACHANNELID_SLOT, &MXF_ITEM_K(MCALabelSubDescriptor, MCAChannelID));
 }
 
 uint32_t MCALabelSubDescriptorBase::getMCAChannelID() const
 {
-    return getUInt32Item(&MXF_ITEM_K(MCALabelSubDescriptor, MCAChannelID));
+    return getUInt32Item(MCACHANNELID_SLOT, &MXF_ITEM_K(MCALabelSubDescriptor, MCAChannelID));
 }
 
 mxfUL MCALabelSubDescriptorBase::getMCALabelDictionaryID() const
 {
-    return getULItem(&MXF_ITEM_K(MCALabelSubDescriptor, MCALabelDictionaryID));
+    return getULItem(MCALABELDICTIONARYID_SLOT, &MXF_ITEM_K(MCALabelSubDescriptor, MCALabelDictionaryID));
 }
 
 std::string MCALabelSubDescriptorBase::getMCATagSymbol() const
@@ -79,7 +79,7 @@ std::string MCALabelSubDescriptorBase::getMCATagSymbol() const
 
 bool MCALabelSubDescriptorBase::haveMCATagName() const
 {
-    return haveItem(&MXF_ITEM_K(MCALabelSubDescriptor, MCATagName));
+    return haveItem(MCATAGNAME_SLOT, &MXF_ITEM_K(MCALabelSubDescriptor, MCATagName));
 }
 
 std::string MCALabelSubDescriptorBase::getMCATagName() const
@@ -89,12 +89,12 @@ std::string MCALabelSubDescriptorBase::getMCATagName() const
 
 mxfUUID MCALabelSubDescriptorBase::getMCALinkID() const
 {
-    return getUUIDItem(&MXF_ITEM_K(MCALabelSubDescriptor, MCALinkID));
+    return getUUIDItem(MCALINKID_SLOT, &MXF_ITEM_K(MCALabelSubDescriptor, MCALinkID));
 }
 
 bool MCALabelSubDescriptorBase::haveMCAPartitionKind() const
 {
-    return haveItem(&MXF_ITEM_K(MCALabelSubDescriptor, MCAPartitionKind));
+    return haveItem(MCAPARTITIONKIND_SLOT, &MXF_ITEM_K(MCALabelSubDescriptor, MCAPartitionKind));
 }
 
 std::string MCALabelSubDescriptorBase::getMCAPartitionKind() const
@@ -104,7 +104,7 @@ std::string MCALabelSubDescriptorBase::getMCAPartitionKind() const
 
 bool MCALabelSubDescriptorBase::haveMCAPartitionNumber() const
 {
-    return haveItem(&MXF_ITEM_K(MCALabelSubDescriptor, MCAPartitionNumber));
+    return haveItem(MCAPARTITIONNUMBER_SLOT, &MXF_ITEM_K(MCALabelSubDescriptor, MCAPartitionNumber));
 }
 
 std::string MCALabelSubDescriptorBase::getMCAPartitionNumber() const
@@ -114,7 +114,7 @@ std::string MCALabelSubDescriptorBase::getMCAPartitionNumber() const
 
 bool MCALabelSubDescriptorBase::haveMCATitle() const
 {
-    return haveItem(&MXF_ITEM_K(MCALabelSubDescriptor, MCATitle));
+    return haveItem(MCATITLE_SLOT, &MXF_ITEM_K(MCALabelSubDescriptor, MCATitle));
 }
 
 std::string MCALabelSubDescriptorBase::getMCATitle() const
@@ -124,7 +124,7 @@ std::string MCALabelSubDescriptorBase::getMCATitle() const
 
 bool MCALabelSubDescriptorBase::haveMCATitleVersion() const
 {
-    return haveItem(&MXF_ITEM_K(MCALabelSubDescriptor, MCATitleVersion));
+    return haveItem(MCATITLEVERSION_SLOT, &MXF_ITEM_K(MCALabelSubDescriptor, MCATitleVersion));
 }
 
 std::string MCALabelSubDescriptorBase::getMCATitleVersion() const
@@ -134,7 +134,7 @@ std::string MCALabelSubDescriptorBase::getMCATitleVersion() const
 
 bool MCALabelSubDescriptorBase::haveMCATitleSubVersion() const
 {
-    return haveItem(&MXF_ITEM_K(MCALabelSubDescriptor, MCATitleSubVersion));
+    return haveItem(MCATITLESUBVERSION_SLOT, &MXF_ITEM_K(MCALabelSubDescriptor, MCATitleSubVersion));
 }
 
 std::string MCALabelSubDescriptorBase::getMCATitleSubVersion() const
@@ -144,7 +144,7 @@ std::string MCALabelSubDescriptorBase::getMCATitleSubVersion() const
 
 bool MCALabelSubDescriptorBase::haveMCAEpisode() const
 {
-    return haveItem(&MXF_ITEM_K(MCALabelSubDescriptor, MCAEpisode));
+    return haveItem(MCAEPISODE_SLOT, &MXF_ITEM_K(MCALabelSubDescriptor, MCAEpisode));
 }
 
 std::string MCALabelSubDescriptorBase::getMCAEpisode() const
@@ -154,7 +154,7 @@ std::string MCALabelSubDescriptorBase::getMCAEpisode() const
 
 bool MCALabelSubDescriptorBase::haveRFC5646SpokenLanguage() const
 {
-    return haveItem(&MXF_ITEM_K(MCALabelSubDescriptor, RFC5646SpokenLanguage));
+    return haveItem(RFC5646SPOKENLANGUAGE_SLOT, &MXF_ITEM_K(MCALabelSubDescriptor, RFC5646SpokenLanguage));
 }
 
 std::string MCALabelSubDescriptorBase::getRFC5646SpokenLanguage() const
@@ -164,7 +164,7 @@ std::string MCALabelSubDescriptorBase::getRFC5646SpokenLanguage() const
 
 bool MCALabelSubDescriptorBase::haveMCAAudioContentKind() const
 {
-    return haveItem(&MXF_ITEM_K(MCALabelSubDescriptor, MCAAudioContentKind));
+    return haveItem(MCAAUDIOCONTENTKIND_SLOT, &MXF_ITEM_K(MCALabelSubDescriptor, MCAAudioContentKind));
 }
 
 std::string MCALabelSubDescriptorBase::getMCAAudioContentKind() const
@@ -174,7 +174,7 @@ std::string MCALabelSubDescriptorBase::getMCAAudioContentKind() const
 
 bool MCALabelSubDescriptorBase::haveMCAAudioElementKind() const
 {
-    return haveItem(&MXF_ITEM_K(MCALabelSubDescriptor, MCAAudioElementKind));
+    return haveItem(MCAAUDIOELEMENTKIND_SLOT, &MXF_ITEM_K(MCALabelSubDescriptor, MCAAudioElementKind));
 }
 
 std::string MCALabelSubDescriptorBase::getMCAAudioElementKind() const
@@ -100,6 +100,24 @@ public:
 
 
 protected:
+    enum
+    {
+        MCACHANNELID_SLOT = SubDescriptor::ITEM_SLOT_END,
+        MCALABELDICTIONARYID_SLOT,
+        MCATAGNAME_SLOT,
+        MCALINKID_SLOT,
+        MCAPARTITIONKIND_SLOT,
+        MCAPARTITIONNUMBER_SLOT,
+        MCATITLE_SLOT,
+        MCATITLEVERSION_SLOT,
+        MCATITLESUBVERSION_SLOT,
+        MCAEPISODE_SLOT,
+        RFC5646SPOKENLANGUAGE_SLOT,
+        MCAAUDIOCONTENTKIND_SLOT,
+        MCAAUDIOELEMENTKIND_SLOT,
+        ITEM_SLOT_END
+    };
+
     MCALabelSubDescriptorBase(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet);
 };
 
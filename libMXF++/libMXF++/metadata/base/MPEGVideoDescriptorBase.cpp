@@ -59,102 +59,102 @@ MPEGVideoDescriptorBase::~MPEGVideoDescriptorBase()
 
 bool MPEGVideoDescriptorBase::haveSingleSequence() const
 {
-    return haveItem(&MXF_ITEM_K(MPEGVideoDescriptor, SingleSequence));
+    return haveItem(SINGLESEQUENCE_SLOT, &MXF_ITEM_K(MPEGVideoDescriptor, SingleSequence));
 }
 
 bool MPEGVideoDescriptorBase::getSingleSequence() const
 {
-    return getBooleanItem(&MXF_ITEM_K(MPEGVideoDescriptor, SingleSequence));
+    return getBooleanItem(SINGLESEQUENCE_SLOT, &MXF_ITEM_K(MPEGVideoDescriptor, SingleSequence));
 }
 
 bool MPEGVideoDescriptorBase::haveConstantBFrames() const
 {
-    return haveItem(&MXF_ITEM_K(MPEGVideoDescriptor, ConstantBFrames));
+    return haveItem(CONSTANTBFRAMES_SLOT, &MXF_ITEM_K(MPEGVideoDescriptor, ConstantBFrames));
 }
 
 bool MPEGVideoDescriptorBase::getConstantBFrames() const
 {
-    return getBooleanItem(&MXF_ITEM_K(MPEGVideoDescriptor, ConstantBFrames));
+    return getBooleanItem(CONSTANTBFRAMES_SLOT, &MXF_ITEM_K(MPEGVideoDescriptor, ConstantBFrames));
 }
 
 bool MPEGVideoDescriptorBase::haveCodedContentType() const
 {
-    return haveItem(&MXF_ITEM_K(MPEGVideoDescriptor, CodedContentType));
+    return haveItem(CODEDCONTENTTYPE_SLOT, &MXF_ITEM_K(MPEGVideoDescriptor, CodedContentType));
 }
 
 uint8_t MPEGVideoDescriptorBase::getCodedContentType() const
 {
-    return getUInt8Item(&MXF_ITEM_K(MPEGVideoDescriptor, CodedContentType));
+    return getUInt8Item(CODEDCONTENTTYPE_SLOT, &MXF_ITEM_K(MPEGVideoDescriptor, CodedContentType));
 }
 
 bool MPEGVideoDescriptorBase::haveLowDelay() const
 {
-    return haveItem(&MXF_ITEM_K(MPEGVideoDescriptor, LowDelay));
+    return haveItem(LOWDELAY_SLOT, &MXF_ITEM_K(MPEGVideoDescriptor, LowDelay));
 }
 
 bool MPEGVideoDescriptorBase::getLowDelay() const
 {
-    return getBooleanItem(&MXF_ITEM_K(MPEGVideoDescriptor, LowDelay));
+    return getBooleanItem(LOWDELAY_SLOT, &MXF_ITEM_K(MPEGVideoDescriptor, LowDelay));
 }
 
 bool MPEGVideoDescriptorBase::haveClosedGOP() const
 {
-    return haveItem(&MXF_ITEM_K(MPEGVideoDescriptor, ClosedGOP));
+    return haveItem(CLOSEDGOP_SLOT, &MXF_ITEM_K(MPEGVideoDescriptor, ClosedGOP));
 }
 
 bool MPEGVideoDescriptorBase::getClosedGOP() const
 {
-    return getBooleanItem(&MXF_ITEM_K(MPEGVideoDescriptor, ClosedGOP));
+    return getBooleanItem(CLOSEDGOP_SLOT, &MXF_ITEM_K(MPEGVideoDescriptor, ClosedGOP));
 }
 
 bool MPEGVideoDescriptorBase::haveIdenticalGOP() const
 {
-    return haveItem(&MXF_ITEM_K(MPEGVideoDescriptor, IdenticalGOP));
+    return haveItem(IDENTICALGOP_SLOT, &MXF_ITEM_K(MPEGVideoDescriptor, IdenticalGOP));
 }
 
 bool MPEGVideoDescriptorBase::getIdenticalGOP() const
 {
-    return getBooleanItem(&MXF_ITEM_K(MPEGVideoDescriptor, IdenticalGOP));
+    return getBooleanItem(IDENTICALGOP_SLOT, &MXF_ITEM_K(MPEGVideoDescriptor, IdenticalGOP));
 }
 
 bool MPEGVideoDescriptorBase::haveMaxGOP() const
 {
-    return haveItem(&MXF_ITEM_K(MPEGVideoDescriptor, MaxGOP));
+    return haveItem(MAXGOP_SLOT, &MXF_ITEM_K(MPEGVideoDescriptor, MaxGOP));
 }
 
 uint16_t MPEGVideoDescriptorBase::getMaxGOP() const
 {
-    return getUInt16Item(&MXF_ITEM_K(MPEGVideoDescriptor, MaxGOP));
+    return getUInt16Item(MAXGOP_SLOT, &MXF_ITEM_K(MPEGVideoDescriptor, MaxGOP));
 }
 
 bool MPEGVideoDescriptorBase::haveMaxBPictureCount() const
 {
-    return haveItem(&MXF_ITEM_K(MPEGVideoDescriptor, MaxBPictureCount));
+    return haveItem(MAXBPICTURECOUNT_SLOT, &MXF_ITEM_K(MPEGVideoDescriptor, MaxBPictureCount));
 }
 
 uint16_t MPEGVideoDescriptorBase::getMaxBPictureCount() const
 {
-    return getUInt16Item(&MXF_ITEM_K(MPEGVideoDescriptor, MaxBPictureCount));
+    return getUInt16Item(MAXBPICTURECOUNT_SLOT, &MXF_ITEM_K(MPEGVideoDescriptor, MaxBPictureCount));
 }
 
 bool MPEGVideoDescriptorBase::haveBitRate() const
 {
-    return haveItem(&MXF_ITEM_K(MPEGVideoDescriptor, BitRate));
+    return haveItem(BITRATE_SLOT, &MXF_ITEM_K(MPEGVideoDescriptor, BitRate));
 }
 
 uint32_t MPEGVideoDescriptorBase::getBitRate() const
 {
-    return getUInt32Item(&MXF_ITEM_K(MPEGVideoDescriptor, BitRate));
+    return getUInt32Item(BITRATE_SLOT, &MXF_ITEM_K(MPEGVideoDescriptor, BitRate));
 }
 
 bool MPEGVideoDescriptorBase::haveProfileAndLevel() const
 {
-    return haveItem(&MXF_ITEM_K(MPEGVideoDescriptor, ProfileAndLevel));
+    return haveItem(PROFILEANDLEVEL_SLOT, &MXF_ITEM_K(MPEGVideoDescriptor, ProfileAndLevel));
 }
 
 uint8_t MPEGVideoDescriptorBase::getProfileAndLevel() const
 {
-    return getUInt8Item(&MXF_ITEM_K(MPEGVideoDescriptor, ProfileAndLevel));
+    return getUInt8Item(PROFILEANDLEVEL_SLOT, &MXF_ITEM_K(MPEGVideoDescriptor, ProfileAndLevel));
 }
 
 void MPEGVideoDescriptorBase::setSingleSequence(bool value)
@@ -91,6 +91,21 @@ public:
 
 
 protected:
+    enum
+    {
+        SINGLESEQUENCE_SLOT = CDCIEssenceDescriptor::ITEM_SLOT_END,
+        CONSTANTBFRAMES_SLOT,
+        CODEDCONTENTTYPE_SLOT,
+        LOWDELAY_SLOT,
+        CLOSEDGOP_SLOT,
+        IDENTICALGOP_SLOT,
+        MAXGOP_SLOT,
+        MAXBPICTURECOUNT_SLOT,
+        BITRATE_SLOT,
+        PROFILEANDLEVEL_SLOT,
+        ITEM_SLOT_END
+    };
+
     MPEGVideoDescriptorBase(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet);
 };
 
@@ -61,32 +61,32 @@ PrefaceBase::~PrefaceBase()
 
 mxfTimestamp PrefaceBase::getLastModifiedDate() const
 {
-    return getTimestampItem(&MXF_ITEM_K(Preface, LastModifiedDate));
+    return getTimestampItem(LASTMODIFIEDDATE_SLOT, &MXF_ITEM_K(Preface, LastModifiedDate));
 }
 
 uint16_t PrefaceBase::getVersion() const
 {
-    return getVersionTypeItem(&MXF_ITEM_K(Preface, Version));
+    return getVersionTypeItem(VERSION_SLOT, &MXF_ITEM_K(Preface, Version));
 }
 
 bool PrefaceBase::haveObjectModelVersion() const
 {
-    return haveItem(&MXF_ITEM_K(Preface, ObjectModelVersion));
+    return haveItem(OBJECTMODELVERSION_SLOT, &MXF_ITEM_K(Preface, ObjectModelVersion));
 }
 
 uint32_t PrefaceBase::getObjectModelVersion() const
 {
-    return getUInt32Item(&MXF_ITEM_K(Preface, ObjectModelVersion));
+    return getUInt32Item(OBJECTMODELVERSION_SLOT, &MXF_ITEM_K(Preface, ObjectModelVersion));
 }
 
 bool PrefaceBase::havePrimaryPackage() const
 {
-    return haveItem(&MXF_ITEM_K(Preface, PrimaryPackage));
+    return haveItem(PRIMARYPACKAGE_SLOT, &MXF_ITEM_K(Preface, PrimaryPackage));
 }
 
 GenericPackage* PrefaceBase::getPrimaryPackage() const
 {
-    auto_ptr<MetadataSet> obj(getWeakRefItem(&MXF_ITEM_K(Preface, PrimaryPackage)));
+    auto_ptr<MetadataSet> obj(getWeakRefItem(PRIMARYPACKAGE_SLOT, &MXF_ITEM_K(Preface, PrimaryPackage)));
     MXFPP_CHECK(dynamic_cast<GenericPackage*>(obj.get()) != 0);
     return dynamic_cast<GenericPackage*>(obj.release());
 }
@@ -105,14 +105,14 @@ std::vector<Identification*> PrefaceBase::getIdentifications() const
 
 ContentStorage* PrefaceBase::getContentStorage() const
 {
-    auto_ptr<MetadataSet> obj(getStrongRefItem(&MXF_ITEM_K(Preface, ContentStorage)));
+    auto_ptr<MetadataSet> obj(getStrongRefItem(CONTENTSTORAGE_SLOT, &MXF_ITEM_K(Preface, ContentStorage)));
     MXFPP_CHECK(dynamic_cast<ContentStorage*>(obj.get()) != 0);
     return dynamic_cast<ContentStorage*>(obj.release());
 }
 
 mxfUL PrefaceBase::getOperationalPattern() const
 {
-    return getULItem(&MXF_ITEM_K(Preface, OperationalPattern));
+    return getULItem(OPERATIONALPATTERN_SLOT, &MXF_ITEM_K(Preface, OperationalPattern));
 }
 
 std::vector<mxfUL> PrefaceBase::getEssenceContainers() const
@@ -127,12 +127,12 @@ std::vector<mxfUL> PrefaceBase::getDMSchemes() const
 
 bool PrefaceBase::haveIsRIPPresent() const
 {
-    return haveItem(&MXF_ITEM_K(Preface, IsRIPPresent));
+    return haveItem(ISRIPPRESENT_SLOT, &MXF_ITEM_K(Preface, IsRIPPresent));
 }
 
 bool PrefaceBase::getIsRIPPresent() const
 {
-    return getBooleanItem(&MXF_ITEM_K(Preface, IsRIPPresent));
+    return getBooleanItem(ISRIPPRESENT_SLOT, &MXF_ITEM_K(Preface, IsRIPPresent));
 }
 
 void PrefaceBase::setLastModifiedDate(mxfTimestamp value)
@@ -87,6 +87,18 @@ public:
 
 
 protected:
+    enum
+    {
+        LASTMODIFIEDDATE_SLOT = InterchangeObject::ITEM_SLOT_END,
+        VERSION_SLOT,
+        OBJECTMODELVERSION_SLOT,
+        PRIMARYPACKAGE_SLOT,
+        CONTENTSTORAGE_SLOT,
+        OPERATIONALPATTERN_SLOT,
+        ISRIPPRESENT_SLOT,
+        ITEM_SLOT_END
+    };
+
     PrefaceBase(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet);
 };
 
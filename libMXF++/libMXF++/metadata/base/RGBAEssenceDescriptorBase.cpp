@@ -59,57 +59,57 @@ RGBAEssenceDescriptorBase::~RGBAEssenceDescriptorBase()
 
 bool RGBAEssenceDescriptorBase::haveComponentMaxRef() const
 {
-    return haveItem(&MXF_ITEM_K(RGBAEssenceDescriptor, ComponentMaxRef));
+    return haveItem(COMPONENTMAXREF_SLOT, &MXF_ITEM_K(RGBAEssenceDescriptor, ComponentMaxRef));
 }
 
 uint32_t RGBAEssenceDescriptorBase::getComponentMaxRef() const
 {
-    return getUInt32Item(&MXF_ITEM_K(RGBAEssenceDescriptor, ComponentMaxRef));
+    return getUInt32Item(COMPONENTMAXREF_SLOT, &MXF_ITEM_K(RGBAEssenceDescriptor, ComponentMaxRef));
 }
 
 bool RGBAEssenceDescriptorBase::haveComponentMinRef() const
 {
-    return haveItem(&MXF_ITEM_K(RGBAEssenceDescriptor, ComponentMinRef));
+    return haveItem(COMPONENTMINREF_SLOT, &MXF_ITEM_K(RGBAEssenceDescriptor, ComponentMinRef));
 }
 
 uint32_t RGBAEssenceDescriptorBase::getComponentMinRef() const
 {
-    return getUInt32Item(&MXF_ITEM_K(RGBAEssenceDescriptor, ComponentMinRef));
+    return getUInt32Item(COMPONENTMINREF_SLOT, &MXF_ITEM_K(RGBAEssenceDescriptor, ComponentMinRef));
 }
 
 bool RGBAEssenceDescriptorBase::haveAlphaMaxRef() const
 {
-    return haveItem(&MXF_ITEM_K(RGBAEssenceDescriptor, AlphaMaxRef));
+    return haveItem(ALPHAMAXREF_SLOT, &MXF_ITEM_K(RGBAEssenceDescriptor, AlphaMaxRef));
 }
 
 uint32_t RGBAEssenceDescriptorBase::getAlphaMaxRef() const
 {
-    return getUInt32Item(&MXF_ITEM_K(RGBAEssenceDescriptor, AlphaMaxRef));
+    return getUInt32Item(ALPHAMAXREF_SLOT, &MXF_ITEM_K(RGBAEssenceDescriptor, AlphaMaxRef));
 }
 
 bool RGBAEssenceDescriptorBase::haveAlphaMinRef() const
 {
-    return haveItem(&MXF_ITEM_K(RGBAEssenceDescriptor, AlphaMinRef));
+    return haveItem(ALPHAMINREF_SLOT, &MXF_ITEM_K(RGBAEssenceDescriptor, AlphaMinRef));
 }
 
 uint32_t RGBAEssenceDescriptorBase::getAlphaMinRef() const
 {
-    return getUInt32Item(&MXF_ITEM_K(RGBAEssenceDescriptor, AlphaMinRef));
+    return getUInt32Item(ALPHAMINREF_SLOT, &MXF_ITEM_K(RGBAEssenceDescriptor, AlphaMinRef));
 }
 
 bool RGBAEssenceDescriptorBase::haveScanningDirection() const
 {
-    return haveItem(&MXF_ITEM_K(RGBAEssenceDescriptor, ScanningDirection));
+    return haveItem(SCANNINGDIRECTION_SLOT, &MXF_ITEM_K(RGBAEssenceDescriptor, ScanningDirection));
 }
 
 uint8_t RGBAEssenceDescriptorBase::getScanningDirection() const
 {
-    return getUInt8Item(&MXF_ITEM_K(RGBAEssenceDescriptor, ScanningDirection));
+    return getUInt8Item(SCANNINGDIRECTION_SLOT, &MXF_ITEM_K(RGBAEssenceDescriptor, ScanningDirection));
 }
 
 bool RGBAEssenceDescriptorBase::havePixelLayout() const
 {
-    return haveItem(&MXF_ITEM_K(RGBAEssenceDescriptor, PixelLayout));
+    return haveItem(PIXELLAYOUT_SLOT, &MXF_ITEM_K(RGBAEssenceDescriptor, PixelLayout));
 }
 
 mxfRGBALayout RGBAEssenceDescriptorBase::getPixelLayout() const
@@ -119,7 +119,7 @@ mxfRGBALayout RGBAEssenceDescriptorBase::getPixelLayout() const
 
 bool RGBAEssenceDescriptorBase::havePalette() const
 {
-    return haveItem(&MXF_ITEM_K(RGBAEssenceDescriptor, Palette));
+    return haveItem(PALETTE_SLOT, &MXF_ITEM_K(RGBAEssenceDescriptor, Palette));
 }
 
 ByteArray RGBAEssenceDescriptorBase::getPalette() const
@@ -129,7 +129,7 @@ ByteArray RGBAEssenceDescriptorBase::getPalette() const
 
 bool RGBAEssenceDescriptorBase::havePaletteLayout() const
 {
-    return haveItem(&MXF_ITEM_K(RGBAEssenceDescriptor, PaletteLayout));
+    return haveItem(PALETTELAYOUT_SLOT, &MXF_ITEM_K(RGBAEssenceDescriptor, PaletteLayout));
 }
 
 mxfRGBALayout RGBAEssenceDescriptorBase::getPaletteLayout() const
@@ -85,6 +85,19 @@ public:
 
 
 protected:
+    enum
+    {
+        COMPONENTMAXREF_SLOT = GenericPictureEssenceDescriptor::ITEM_SLOT_END,
+        COMPONENTMINREF_SLOT,
+        ALPHAMAXREF_SLOT,
+        ALPHAMINREF_SLOT,
+        SCANNINGDIRECTION_SLOT,
+        PIXELLAYOUT_SLOT,
+        PALETTE_SLOT,
+        PALETTELAYOUT_SLOT,
+        ITEM_SLOT_END
+    };
+
     RGBAEssenceDescriptorBase(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet);
 };
 
@@ -59,7 +59,7 @@ SoundfieldGroupLabelSubDescriptorBase::~SoundfieldGroupLabelSubDescriptorBase()
 
 bool SoundfieldGroupLabelSubDescriptorBase::haveGroupOfSoundfieldGroupsLinkID() const
 {
-    return haveItem(&MXF_ITEM_K(SoundfieldGroupLabelSubDescriptor, GroupOfSoundfieldGroupsLinkID));
+    return haveItem(GROUPOFSOUNDFIELDGROUPSLINKID_SLOT, &MXF_ITEM_K(SoundfieldGroupLabelSubDescriptor, GroupOfSoundfieldGroupsLinkID));
 }
 
 std::vector<mxfUUID> SoundfieldGroupLabelSubDescriptorBase::getGroupOfSoundfieldGroupsLinkID() const
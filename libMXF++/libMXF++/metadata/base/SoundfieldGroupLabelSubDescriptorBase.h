@@ -65,6 +65,12 @@ public:
 
 
 protected:
+    enum
+    {
+        GROUPOFSOUNDFIELDGROUPSLINKID_SLOT = MCALabelSubDescriptor::ITEM_SLOT_END,
+        ITEM_SLOT_END
+    };
+
     SoundfieldGroupLabelSubDescriptorBase(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet);
 };
 
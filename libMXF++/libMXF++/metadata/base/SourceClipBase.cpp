@@ -59,17 +59,17 @@ SourceClipBase::~SourceClipBase()
 
 int64_t SourceClipBase::getStartPosition() const
 {
-    return getPositionItem(&MXF_ITEM_K(SourceClip, StartPosition));
+    return getPositionItem(STARTPOSITION_SLOT, &MXF_ITEM_K(SourceClip, StartPosition));
 }
 
 mxfUMID SourceClipBase::getSourcePackageID() const
 {
-    return getUMIDItem(&MXF_ITEM_K(SourceClip, SourcePackageID));
+    return getUMIDItem(SOURCEPACKAGEID_SLOT, &MXF_ITEM_K(SourceClip, SourcePackageID));
 }
 
 uint32_t SourceClipBase::getSourceTrackID() const
 {
-    return getUInt32Item(&MXF_ITEM_K(SourceClip, SourceTrackID));
+    return getUInt32Item(SOURCETRACKID_SLOT, &MXF_ITEM_K(SourceClip, SourceTrackID));
 }
 
 void SourceClipBase::setStartPosition(int64_t value)
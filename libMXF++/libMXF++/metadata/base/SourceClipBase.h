@@ -67,6 +67,14 @@ public:
 
 
 protected:
+    enum
+    {
+        STARTPOSITION_SLOT = StructuralComponent::ITEM_SLOT_END,
+        SOURCEPACKAGEID_SLOT,
+        SOURCETRACKID_SLOT,
+        ITEM_SLOT_END
+    };
+
     SourceClipBase(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet);
 };
 
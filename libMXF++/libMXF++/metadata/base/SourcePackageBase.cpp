@@ -61,12 +61,12 @@ SourcePackageBase::~SourcePackageBase()
 
 bool SourcePackageBase::haveDescriptor() const
 {
-    return haveItem(&MXF_ITEM_K(SourcePackage, Descriptor));
+    return haveItem(DESCRIPTOR_SLOT, &MXF_ITEM_K(SourcePackage, Descriptor));
 }
 
 GenericDescriptor* SourcePackageBase::getDescriptor() const
 {
-    auto_ptr<MetadataSet> obj(getStrongRefItem(&MXF_ITEM_K(SourcePackage, Descriptor)));
+    auto_ptr<MetadataSet> obj(getStrongRefItem(DESCRIPTOR_SLOT, &MXF_ITEM_K(SourcePackage, Descriptor)));
     MXFPP_CHECK(dynamic_cast<GenericDescriptor*>(obj.get()) != 0);
     return dynamic_cast<GenericDescriptor*>(obj.release());
 }
@@ -64,6 +64,12 @@ public:
 
 
 protected:
+    enum
+    {
+        DESCRIPTOR_SLOT = GenericPackage::ITEM_SLOT_END,
+        ITEM_SLOT_END
+    };
+
     SourcePackageBase(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet);
 };
 
@@ -59,17 +59,17 @@ StructuralComponentBase::~StructuralComponentBase()
 
 mxfUL StructuralComponentBase::getDataDefinition() const
 {
-    return getULItem(&MXF_ITEM_K(StructuralComponent, DataDefinition));
+    return getULItem(DATADEFINITION_SLOT, &MXF_ITEM_K(StructuralComponent, DataDefinition));
 }
 
 bool StructuralComponentBase::haveDuration() const
 {
-    return haveItem(&MXF_ITEM_K(StructuralComponent, Duration));
+    return haveItem(DURATION_SLOT, &MXF_ITEM_K(StructuralComponent, Duration));
 }
 
 int64_t StructuralComponentBase::getDuration() const
 {
-    return getLengthItem(&MXF_ITEM_K(StructuralComponent, Duration));
+    return getLengthItem(DURATION_SLOT, &MXF_ITEM_K(StructuralComponent, Duration));
 }
 
 void StructuralComponentBase::setDataDefinition(mxfUL value)
@@ -66,6 +66,13 @@ public:
 
 
 protected:
+    enum
+    {
+        DATADEFINITION_SLOT = InterchangeObject::ITEM_SLOT_END,
+        DURATION_SLOT,
+        ITEM_SLOT_END
+    };
+
     StructuralComponentBase(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet);
 };
 
@@ -61,12 +61,12 @@ TextBasedDMFrameworkBase::~TextBasedDMFrameworkBase()
 
 bool TextBasedDMFrameworkBase::haveTextBasedObject() const
 {
-    return haveItem(&MXF_ITEM_K(TextBasedDMFramework, TextBasedObject));
+    return haveItem(TEXTBASEDOBJECT_SLOT, &MXF_ITEM_K(TextBasedDMFramework, TextBasedObject));
 }
 
 TextBasedObject* TextBasedDMFrameworkBase::getTextBasedObject() const
 {
-    auto_ptr<MetadataSet> obj(getStrongRefItem(&MXF_ITEM_K(TextBasedDMFramework, TextBasedObject)));
+    auto_ptr<MetadataSet> obj(getStrongRefItem(TEXTBASEDOBJECT_SLOT, &MXF_ITEM_K(TextBasedDMFramework, TextBasedObject)));
     MXFPP_CHECK(dynamic_cast<TextBasedObject*>(obj.get()) != 0);
     return dynamic_cast<TextBasedObject*>(obj.release());
 }
@@ -64,6 +64,12 @@ public:
 
 
 protected:
+    enum
+    {
+        TEXTBASEDOBJECT_SLOT = DMFramework::ITEM_SLOT_END,
+        ITEM_SLOT_END
+    };
+
     TextBasedDMFrameworkBase(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet);
 };
 
@@ -59,7 +59,7 @@ TextBasedObjectBase::~TextBasedObjectBase()
 
 mxfUL TextBasedObjectBase::getTextBasedMetadataPayloadSchemaID() const
 {
-    return getULItem(&MXF_ITEM_K(TextBasedObject, TextBasedMetadataPayloadSchemaID));
+    return getULItem(TEXTBASEDMETADATAPAYLOADSCHEMAID_SLOT, &MXF_ITEM_K(TextBasedObject, TextBasedMetadataPayloadSchemaID));
 }
 
 std::string TextBasedObjectBase::getTextMIMEMediaType() const
@@ -74,7 +74,7 @@ std::string TextBasedObjectBase::getRFC5646TextLanguageCode() const
 
 bool TextBasedObjectBase::haveTextDataDescription() const
 {
-    return haveItem(&MXF_ITEM_K(TextBasedObject, TextDataDescription));
+    return haveItem(TEXTDATADESCRIPTION_SLOT, &MXF_ITEM_K(TextBasedObject, TextDataDescription));
 }
 
 std::string TextBasedObjectBase::getTextDataDescription() const
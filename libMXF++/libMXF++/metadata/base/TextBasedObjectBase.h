@@ -70,6 +70,13 @@ public:
 
 
 protected:
+    enum
+    {
+        TEXTBASEDMETADATAPAYLOADSCHEMAID_SLOT = DMSet::ITEM_SLOT_END,
+        TEXTDATADESCRIPTION_SLOT,
+        ITEM_SLOT_END
+    };
+
     TextBasedObjectBase(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet);
 };
 
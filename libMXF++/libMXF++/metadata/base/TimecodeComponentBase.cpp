@@ -59,17 +59,17 @@ TimecodeComponentBase::~TimecodeComponentBase()
 
 uint16_t TimecodeComponentBase::getRoundedTimecodeBase() const
 {
-    return getUInt16Item(&MXF_ITEM_K(TimecodeComponent, RoundedTimecodeBase));
+    return getUInt16Item(ROUNDEDTIMECODEBASE_SLOT, &MXF_ITEM_K(TimecodeComponent, RoundedTimecodeBase));
 }
 
 int64_t TimecodeComponentBase::getStartTimecode() const
 {
-    return getPositionItem(&MXF_ITEM_K(TimecodeComponent, StartTimecode));
+    return getPositionItem(STARTTIMECODE_SLOT, &MXF_ITEM_K(TimecodeComponent, StartTimecode));
 }
 
 bool TimecodeComponentBase::getDropFrame() const
 {
-    return getBooleanItem(&MXF_ITEM_K(TimecodeComponent, DropFrame));
+    return getBooleanItem(DROPFRAME_SLOT, &MXF_ITEM_K(TimecodeComponent, DropFrame));
 }
 
 void TimecodeComponentBase::setRoundedTimecodeBase(uint16_t value)
@@ -67,6 +67,14 @@ public:
 
 
 protected:
+    enum
+    {
+        ROUNDEDTIMECODEBASE_SLOT = StructuralComponent::ITEM_SLOT_END,
+        STARTTIMECODE_SLOT,
+        DROPFRAME_SLOT,
+        ITEM_SLOT_END
+    };
+
     TimecodeComponentBase(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet);
 };
 
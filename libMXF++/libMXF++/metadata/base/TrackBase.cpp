@@ -59,12 +59,12 @@ TrackBase::~TrackBase()
 
 mxfRational TrackBase::getEditRate() const
 {
-    return getRationalItem(&MXF_ITEM_K(Track, EditRate));
+    return getRationalItem(EDITRATE_SLOT, &MXF_ITEM_K(Track, EditRate));
 }
 
 int64_t TrackBase::getOrigin() const
 {
-    return getPositionItem(&MXF_ITEM_K(Track, Origin));
+    return getPositionItem(ORIGIN_SLOT, &MXF_ITEM_K(Track, Origin));
 }
 
 void TrackBase::setEditRate(mxfRational value)
@@ -65,6 +65,13 @@ public:
 
 
 protected:
+    enum
+    {
+        EDITRATE_SLOT = GenericTrack::ITEM_SLOT_END,
+        ORIGIN_SLOT,
+        ITEM_SLOT_END
+    };
+
     TrackBase(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet);
 };
 
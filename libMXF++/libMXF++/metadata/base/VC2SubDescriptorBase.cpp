@@ -61,27 +61,27 @@ VC2SubDescriptorBase::~VC2SubDescriptorBase()
 
 uint8_t VC2SubDescriptorBase::getVC2MajorVersion() const
 {
-    return getUInt8Item(&MXF_ITEM_K(VC2SubDescriptor, VC2MajorVersion));
+    return getUInt8Item(VC2MAJORVERSION_SLOT, &MXF_ITEM_K(VC2SubDescriptor, VC2MajorVersion));
 }
 
 uint8_t VC2SubDescriptorBase::getVC2MinorVersion() const
 {
-    return getUInt8Item(&MXF_ITEM_K(VC2SubDescriptor, VC2MinorVersion));
+    return getUInt8Item(VC2MINORVERSION_SLOT, &MXF_ITEM_K(VC2SubDescriptor, VC2MinorVersion));
 }
 
 uint8_t VC2SubDescriptorBase::getVC2Profile() const
 {
-    return getUInt8Item(&MXF_ITEM_K(VC2SubDescriptor, VC2Profile));
+    return getUInt8Item(VC2PROFILE_SLOT, &MXF_ITEM_K(VC2SubDescriptor, VC2Profile));
 }
 
 uint8_t VC2SubDescriptorBase::getVC2Level() const
 {
-    return getUInt8Item(&MXF_ITEM_K(VC2SubDescriptor, VC2Level));
+    return getUInt8Item(VC2LEVEL_SLOT, &MXF_ITEM_K(VC2SubDescriptor, VC2Level));
 }
 
 bool VC2SubDescriptorBase::haveVC2WaveletFilters() const
 {
-    return haveItem(&MXF_ITEM_K(VC2SubDescriptor, VC2WaveletFilters));
+    return haveItem(VC2WAVELETFILTERS_SLOT, &MXF_ITEM_K(VC2SubDescriptor, VC2WaveletFilters));
 }
 
 std::vector<uint8_t> VC2SubDescriptorBase::getVC2WaveletFilters() const
@@ -91,22 +91,22 @@ std::vector<uint8_t> VC2SubDescriptorBase::getVC2WaveletFilters() const
 
 bool VC2SubDescriptorBase::haveVC2SequenceHeadersIdentical() const
 {
-    return haveItem(&MXF_ITEM_K(VC2SubDescriptor, VC2SequenceHeadersIdentical));
+    return haveItem(VC2SEQUENCEHEADERSIDENTICAL_SLOT, &MXF_ITEM_K(VC2SubDescriptor, VC2SequenceHeadersIdentical));
 }
 
 bool VC2SubDescriptorBase::getVC2SequenceHeadersIdentical() const
 {
-    return getBooleanItem(&MXF_ITEM_K(VC2SubDescriptor, VC2SequenceHeadersIdentical));
+    return getBooleanItem(VC2SEQUENCEHEADERSIDENTICAL_SLOT, &MXF_ITEM_K(VC2SubDescriptor, VC2SequenceHeadersIdentical));
 }
 
 bool VC2SubDescriptorBase::haveVC2EditUnitsAreCompleteSequences() const
 {
-    return haveItem(&MXF_ITEM_K(VC2SubDescriptor, VC2EditUnitsAreCompleteSequences));
+    return haveItem(VC2EDITUNITSARECOMPLETESEQUENCES_SLOT, &MXF_ITEM_K(VC2SubDescriptor, VC2EditUnitsAreCompleteSequences));
 }
 
 bool VC2SubDescriptorBase::getVC2EditUnitsAreCompleteSequences() const
 {
-    return getBooleanItem(&MXF_ITEM_K(VC2SubDescriptor, VC2EditUnitsAreCompleteSequences));
+    return getBooleanItem(VC2EDITUNITSARECOMPLETESEQUENCES_SLOT, &MXF_ITEM_K(VC2SubDescriptor, VC2EditUnitsAreCompleteSequences));
 }
 
 void VC2SubDescriptorBase::setVC2MajorVersion(uint8_t value)
@@ -79,6 +79,18 @@ public:
 
 
 protected:
+    enum
+    {
+        VC2MAJORVERSION_SLOT = SubDescriptor::ITEM_SLOT_END,
+        VC2MINORVERSION_SLOT,
+        VC2PROFILE_SLOT,
+        VC2LEVEL_SLOT,
+        VC2WAVELETFILTERS_SLOT,
+        VC2SEQUENCEHEADERSIDENTICAL_SLOT,
+        VC2EDITUNITSARECOMPLETESEQUENCES_SLOT,
+        ITEM_SLOT_END
+    };
+
     VC2SubDescriptorBase(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet);
 };
 
@@ -59,117 +59,117 @@ WaveAudioDescriptorBase::~WaveAudioDescriptorBase()
 
 uint16_t WaveAudioDescriptorBase::getBlockAlign() const
 {
-    return getUInt16Item(&MXF_ITEM_K(WaveAudioDescriptor, BlockAlign));
+    return getUInt16Item(BLOCKALIGN_SLOT, &MXF_ITEM_K(WaveAudioDescriptor, BlockAlign));
 }
 
 bool WaveAudioDescriptorBase::haveSequenceOffset() const
 {
-    return haveItem(&MXF_ITEM_K(WaveAudioDescriptor, SequenceOffset));
+    return haveItem(SEQUENCEOFFSET_SLOT, &MXF_ITEM_K(WaveAudioDescriptor, SequenceOffset));
 }
 
 uint8_t WaveAudioDescriptorBase::getSequenceOffset() const
 {
-    return getUInt8Item(&MXF_ITEM_K(WaveAudioDescriptor, SequenceOffset));
+    return getUInt8Item(SEQUENCEOFFSET_SLOT, &MXF_ITEM_K(WaveAudioDescriptor, SequenceOffset));
 }
 
 uint32_t WaveAudioDescriptorBase::getAvgBps() const
 {
-    return getUInt32Item(&MXF_ITEM_K(WaveAudioDescriptor, AvgBps));
+    return getUInt32Item(AVGBPS_SLOT, &MXF_ITEM_K(WaveAudioDescriptor, AvgBps));
 }
 
 bool WaveAudioDescriptorBase::haveChannelAssignment() const
 {
-    return haveItem(&MXF_ITEM_K(WaveAudioDescriptor, ChannelAssignment));
+    return haveItem(CHANNELASSIGNMENT_SLOT, &MXF_ITEM_K(WaveAudioDescriptor, ChannelAssignment));
 }
 
 mxfUL WaveAudioDescriptorBase::getChannelAssignment() const
 {
-    return getULItem(&MXF_ITEM_K(WaveAudioDescriptor, ChannelAssignment));
+    return getULItem(CHANNELASSIGNMENT_SLOT, &MXF_ITEM_K(WaveAudioDescriptor, ChannelAssignment));
 }
 
 bool WaveAudioDescriptorBase::havePeakEnvelopeVersion() const
 {
-    return haveItem(&MXF_ITEM_K(WaveAudioDescriptor, PeakEnvelopeVersion));
+    return haveItem(PEAKENVELOPEVERSION_SLOT, &MXF_ITEM_K(WaveAudioDescriptor, PeakEnvelopeVersion));
 }
 
 uint32_t WaveAudioDescriptorBase::getPeakEnvelopeVersion() const
 {
-    return getUInt32Item(&MXF_ITEM_K(WaveAudioDescriptor, PeakEnvelopeVersion));
+    return getUInt32Item(PEAKENVELOPEVERSION_SLOT, &MXF_ITEM_K(WaveAudioDescriptor, PeakEnvelopeVersion));
 }
 
 bool WaveAudioDescriptorBase::havePeakEnvelopeFormat() const
 {
-    return haveItem(&MXF_ITEM_K(WaveAudioDescriptor, PeakEnvelopeFormat));
+    return haveItem(PEAKENVELOPEFORMAT_SLOT, &MXF_ITEM_K(WaveAudioDescriptor, PeakEnvelopeFormat));
 }
 
 uint32_t WaveAudioDescriptorBase::getPeakEnvelopeFormat() const
 {
-    return getUInt32Item(&MXF_ITEM_K(WaveAudioDescriptor, PeakEnvelopeFormat));
+    return getUInt32Item(PEAKENVELOPEFORMAT_SLOT, &MXF_ITEM_K(WaveAudioDescriptor, PeakEnvelopeFormat));
 }
 
 bool WaveAudioDescriptorBase::havePointsPerPeakValue() const
 {
-    return haveItem(&MXF_ITEM_K(WaveAudioDescriptor, PointsPerPeakValue));
+    return haveItem(POINTSPERPEAKVALUE_SLOT, &MXF_ITEM_K(WaveAudioDescriptor, PointsPerPeakValue));
 }
 
 uint32_t WaveAudioDescriptorBase::getPointsPerPeakValue() const
 {
-    return getUInt32Item(&MXF_ITEM_K(WaveAudioDescriptor, PointsPerPeakValue));
+    return getUInt32Item(POINTSPERPEAKVALUE_SLOT, &MXF_ITEM_K(WaveAudioDescriptor, PointsPerPeakValue));
 }
 
 bool WaveAudioDescriptorBase::havePeakEnvelopeBlockSize() const
 {
-    return haveItem(&MXF_ITEM_K(WaveAudioDescriptor, PeakEnvelopeBlockSize));
+    return haveItem(PEAKENVELOPEBLOCKSIZE_SLOT, &MXF_ITEM_K(WaveAudioDescriptor, PeakEnvelopeBlockSize));
 }
 
 uint32_t WaveAudioDescriptorBase::getPeakEnvelopeBlockSize() const
 {
-    return getUInt32Item(&MXF_ITEM_K(WaveAudioDescriptor, PeakEnvelopeBlockSize));
+    return getUInt32Item(PEAKENVELOPEBLOCKSIZE_SLOT, &MXF_ITEM_K(WaveAudioDescriptor, PeakEnvelopeBlockSize));
 }
 
 bool WaveAudioDescriptorBase::havePeakChannels() const
 {
-    return haveItem(&MXF_ITEM_K(WaveAudioDescriptor, PeakChannels));
+    return haveItem(PEAKCHANNELS_SLOT, &MXF_ITEM_K(WaveAudioDescriptor, PeakChannels));
 }
 
 uint32_t WaveAudioDescriptorBase::getPeakChannels() const
 {
-    return getUInt32Item(&MXF_ITEM_K(WaveAudioDescriptor, PeakChannels));
+    return getUInt32Item(PEAKCHANNELS_SLOT, &MXF_ITEM_K(WaveAudioDescriptor, PeakChannels));
 }
 
 bool WaveAudioDescriptorBase::havePeakFrames() const
 {
-    return haveItem(&MXF_ITEM_K(WaveAudioDescriptor, PeakFrames));
+    return haveItem(PEAKFRAMES_SLOT, &MXF_ITEM_K(WaveAudioDescriptor, PeakFrames));
 }
 
 uint32_t WaveAudioDescriptorBase::getPeakFrames() const
 {
-    return getUInt32Item(&MXF_ITEM_K(WaveAudioDescriptor, PeakFrames));
+    return getUInt32Item(PEAKFRAMES_SLOT, &MXF_ITEM_K(WaveAudioDescriptor, PeakFrames));
 }
 
 bool WaveAudioDescriptorBase::havePeakOfPeaksPosition() const
 {
-    return haveItem(&MXF_ITEM_K(WaveAudioDescriptor, PeakOfPeaksPosition));
+    return haveItem(PEAKOFPEAKSPOSITION_SLOT, &MXF_ITEM_K(WaveAudioDescriptor, PeakOfPeaksPosition));
 }
 
 int64_t WaveAudioDescriptorBase::getPeakOfPeaksPosition() const
 {
-    return getPositionItem(&MXF_ITEM_K(WaveAudioDescriptor, PeakOfPeaksPosition));
+    return getPositionItem(PEAKOFPEAKSPOSITION_SLOT, &MXF_ITEM_K(WaveAudioDescriptor, PeakOfPeaksPosition));
 }
 
 bool WaveAudioDescriptorBase::havePeakEnvelopeTimestamp() const
 {
-    return haveItem(&MXF_ITEM_K(WaveAudioDescriptor, PeakEnvelopeTimestamp));
+    return haveItem(PEAKENVELOPETIMESTAMP_SLOT, &MXF_ITEM_K(WaveAudioDescriptor, PeakEnvelopeTimestamp));
 }
 
 mxfTimestamp WaveAudioDescriptorBase::getPeakEnvelopeTimestamp() const
 {
-    return getTimestampItem(&MXF_ITEM_K(WaveAudioDescriptor, PeakEnvelopeTimestamp));
+    return getTimestampItem(PEAKENVELOPETIMESTAMP_SLOT, &MXF_ITEM_K(WaveAudioDescriptor, PeakEnvelopeTimestamp));
 }
 
 bool WaveAudioDescriptorBase::havePeakEnvelopeData() const
 {
-    return haveItem(&MXF_ITEM_K(WaveAudioDescriptor, PeakEnvelopeData));
+    return haveItem(PEAKENVELOPEDATA_SLOT, &MXF_ITEM_K(WaveAudioDescriptor, PeakEnvelopeData));
 }
 
 ByteArray WaveAudioDescriptorBase::getPeakEnvelopeData() const
@@ -98,6 +98,24 @@ public:
 
 
 protected:
+    enum
+    {
+        BLOCKALIGN_SLOT = GenericSoundEssenceDescriptor::ITEM_SLOT_END,
+        SEQUENCEOFFSET_SLOT,
+        AVGBPS_SLOT,
+        CHANNELASSIGNMENT_SLOT,
+        PEAKENVELOPEVERSION_SLOT,
+        PEAKENVELOPEFORMAT_SLOT,
+        POINTSPERPEAKVALUE_SLOT,
+        PEAKENVELOPEBLOCKSIZE_SLOT,
+        PEAKCHANNELS_SLOT,
+        PEAKFRAMES_SLOT,
+        PEAKOFPEAKSPOSITION_SLOT,
+        PEAKENVELOPETIMESTAMP_SLOT,
+        PEAKENVELOPEDATA_SLOT,
+        ITEM_SLOT_END
+    };
+
     WaveAudioDescriptorBase(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet);
 };
 
@@ -79,6 +79,22 @@ static void testWrite()
     preface->setContentStorage(new ContentStorage(headerMetadata.get()));
     // etc.
 
+    // the getters cache the item lookups and must see items being added and removed
+    if (preface->haveGenerationUID())
+        throw "Preface::GenerationUID is not expected";
+    preface->setGenerationUID(g_Null_UUID);
+    if (!preface->haveGenerationUID())
+        throw "Preface::GenerationUID is missing";
+    preface->removeItem(&MXF_ITEM_K(InterchangeObject, GenerationUID));
+    if (preface->haveGenerationUID())
+        throw "Preface::GenerationUID was not removed";
+    if (preface->getVersion() != MXF_PREFACE_VER(1, 2))
+        throw "Unexpected Preface::Version";
+    preface->setVersion(MXF_PREFACE_VER(1, 3));
+    if (preface->getVersion() != MXF_PREFACE_VER(1, 3))
+        throw "Preface::Version was not updated";
+    preface->setVersion(MXF_PREFACE_VER(1, 2));
+
     headerMetadata->createDefaultDictionary(preface);
 
     headerMetadata->write(file.get(), &headerPartition, 0);
@@ -0,0 +1,221 @@
+/*
+ * Test libMXF++ KeyHashMap
+ *
+ * Copyright (C) 2017, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Author: Philip de Nier
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <cstdio>
+#include <cstring>
+
+#include <vector>
+
+#include <libMXF++/KeyHashMap.h>
+
+using namespace std;
+using namespace mxfpp;
+
+
+#define CHECK(cond)                                                             \
+    do {                                                                        \
+        if (!(cond)) {                                                          \
+            fprintf(stderr, "'%s' failed at line %d\n", #cond, __LINE__);       \
+            return false;                                                       \
+        }                                                                       \
+    } while (0)
+
+
+
+static mxfUUID create_key(uint32_t seed)
+{
+    mxfUUID key;
+    uint32_t value = seed * 2654435761U + 1;
+    size_t i;
+    for (i = 0; i < sizeof(key); i++)
+    {
+        value = value * 1103515245U + 12345U;
+        ((uint8_t*)&key)[i] = (uint8_t)(value >> 16);
+    }
+
+    return key;
+}
+
+// the FNV-1a hash used by KeyHashMap
+static uint32_t hash_key(const mxfUUID &key)
+{
+    const uint8_t *bytes = (const uint8_t*)&key;
+    uint32_t value = 2166136261U;
+    size_t i;
+    for (i = 0; i < sizeof(key); i++)
+    {
+        value ^= bytes[i];
+        value *= 16777619U;
+    }
+
+    return value;
+}
+
+
+static bool test_growth()
+{
+    KeyHashMap<mxfUUID, int> map;
+    const int count = 5000;
+    int i;
+
+    for (i = 0; i < count; i++)
+        CHECK(map.insert(create_key(i), i));
+    CHECK(map.size() == (size_t)count);
+
+    // all keys are found after the table was grown a number of times, and missing keys are not found
+    for (i = 0; i < count; i++)
+    {
+        int *value = map.find(create_key(i));
+        CHECK(value && *value == i);
+    }
+    for (i = count; i < 2 * count; i++)
+        CHECK(!map.find(create_key(i)));
+
+    // inserting an existing key leaves the value unchanged, replace changes it
+    CHECK(!map.insert(create_key(10), -1));
+    CHECK(*map.find(create_key(10)) == 10);
+    map.replace(create_key(10), -10);
+    CHECK(*map.find(create_key(10)) == -10);
+    CHECK(map.size() == (size_t)count);
+
+    // erase every other key
+    for (i = 0; i < count; i += 2)
+        CHECK(map.erase(create_key(i)));
+    CHECK(!map.erase(create_key(0)));
+    CHECK(map.size() == (size_t)count / 2);
+    for (i = 0; i < count; i++)
+    {
+        if (i % 2 == 0)
+            CHECK(!map.find(create_key(i)));
+        else
+            CHECK(map.find(create_key(i)) != 0);
+    }
+    CHECK(map.getValues().size() == (size_t)count / 2);
+
+    return true;
+}
+
+static bool test_collisions()
+{
+    // the initial table has 16 entries. Select keys that hash to slots 5 and 6 so that the
+    // probe sequences of the two groups overlap
+    vector<mxfUUID> keys;
+    uint32_t seed = 0;
+    size_t slot5_count = 0, slot6_count = 0;
+    while (slot5_count < 5 || slot6_count < 4)
+    {
+        mxfUUID key = create_key(seed++);
+        uint32_t slot = hash_key(key) & 15;
+        if (slot == 5 && slot5_count < 5)
+        {
+            keys.push_back(key);
+            slot5_count++;
+        }
+        else if (slot == 6 && slot6_count < 4)
+        {
+            keys.push_back(key);
+            slot6_count++;
+        }
+    }
+
+    KeyHashMap<mxfUUID, int> map;
+    size_t i;
+    for (i = 0; i < keys.size(); i++)
+        CHECK(map.insert(keys[i], (int)i));
+    for (i = 0; i < keys.size(); i++)
+        CHECK(map.find(keys[i]) && *map.find(keys[i]) == (int)i);
+
+    // a missing key with the same hash slot is not found after probing the chain
+    while (true)
+    {
+        mxfUUID key = create_key(seed++);
+        if ((hash_key(key) & 15) == 5)
+        {
+            CHECK(!map.find(key));
+            break;
+        }
+    }
+
+    // erasing from the middle of the chains keeps the remaining keys reachable
+    for (i = 1; i < keys.size(); i += 3)
+        CHECK(map.erase(keys[i]));
+    for (i = 0; i < keys.size(); i++)
+    {
+        if (i % 3 == 1)
+            CHECK(!map.find(keys[i]));
+        else
+            CHECK(map.find(keys[i]) && *map.find(keys[i]) == (int)i);
+    }
+
+    // re-insert the erased keys
+    for (i = 1; i < keys.size(); i += 3)
+        CHECK(map.insert(keys[i], (int)i));
+    for (i = 0; i < keys.size(); i++)
+        CHECK(map.find(keys[i]) && *map.find(keys[i]) == (int)i);
+
+    return true;
+}
+
+static bool test_empty()
+{
+    KeyHashMap<mxfUUID, int> map;
+
+    CHECK(!map.find(create_key(1)));
+    CHECK(!map.erase(create_key(1)));
+    CHECK(map.size() == 0);
+    CHECK(map.getValues().empty());
+
+    map.reserve(100);
+    CHECK(!map.find(create_key(1)));
+    CHECK(map.insert(create_key(1), 1));
+    CHECK(map.erase(create_key(1)));
+    CHECK(!map.find(create_key(1)));
+    CHECK(map.size() == 0);
+
+    return true;
+}
+
+
+
+int main()
+{
+    if (!test_empty() || !test_growth() || !test_collisions())
+        return 1;
+
+    return 0;
+}
+
@@ -0,0 +1,247 @@
+/*
+ * Test reading the partitions listed in the RIP lazily and eagerly
+ *
+ * Copyright (C) 2026, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <cstdio>
+#include <cstring>
+
+#include <memory>
+#include <vector>
+
+#include <libMXF++/MXF.h>
+
+using namespace std;
+using namespace mxfpp;
+
+
+#define CHECK(cond)                                                             \
+    do {                                                                        \
+        if (!(cond)) {                                                          \
+            fprintf(stderr, "'%s' failed at line %d\n", #cond, __LINE__);       \
+            return false;                                                       \
+        }                                                                       \
+    } while (0)
+
+
+#define NUM_BODY_PARTITIONS     12
+#define FRAMES_PER_PARTITION    5
+#define FRAME_SIZE              1000
+#define ESSENCE_BODY_SID        1
+#define OTHER_BODY_SID          2
+
+
+static const char TEST_FILENAME[] = "partitions_test.mxf";
+
+static const mxfKey ELEMENT_KEY =
+    {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x02, 0x01, 0x01, 0x0d, 0x01, 0x03, 0x01, 0x15, 0x01, 0x05, 0x01};
+
+
+
+static void write_frame(File *file, uint32_t frame_number)
+{
+    unsigned char data[FRAME_SIZE];
+    uint32_t i;
+    for (i = 0; i < FRAME_SIZE; i++)
+        data[i] = (unsigned char)((frame_number * 31 + i) % 251);
+
+    file->writeFixedKL(&ELEMENT_KEY, 4, FRAME_SIZE);
+    file->write(data, FRAME_SIZE);
+}
+
+static void write_test_file()
+{
+    auto_ptr<File> file(File::openNew(TEST_FILENAME));
+
+    Partition &header_partition = file->createPartition();
+    header_partition.setKey(&MXF_PP_K(ClosedComplete, Header));
+    header_partition.write(file.get());
+
+    // every third body partition holds another stream, which lazy reading shouldn't load
+    uint64_t body_offsets[3] = {0, 0, 0};
+    uint32_t frame_number = 0;
+    int i, j;
+    for (i = 0; i < NUM_BODY_PARTITIONS; i++) {
+        uint32_t body_sid = (i % 3 == 2 ? OTHER_BODY_SID : ESSENCE_BODY_SID);
+
+        Partition &body_partition = file->createPartition();
+        body_partition.setKey(&MXF_PP_K(ClosedComplete, Body));
+        body_partition.setBodySID(body_sid);
+        body_partition.setBodyOffset(body_offsets[body_sid]);
+        body_partition.write(file.get());
+
+        for (j = 0; j < FRAMES_PER_PARTITION; j++)
+            write_frame(file.get(), frame_number++);
+        body_offsets[body_sid] += FRAMES_PER_PARTITION * (mxfKey_extlen + 4 + FRAME_SIZE);
+    }
+
+    Partition &footer_partition = file->createPartition();
+    footer_partition.setKey(&MXF_PP_K(ClosedComplete, Footer));
+    footer_partition.setBodySID(0);
+    footer_partition.setBodyOffset(0);
+    footer_partition.write(file.get());
+
+    file->writeRIP();
+    file->updatePartitions();
+}
+
+// reads the frames in the partitions of the essence stream, using the partition directory to skip other streams
+static bool read_frames(File *file, vector<unsigned char> *frames, vector<uint64_t> *body_offsets)
+{
+    mxfKey key;
+    uint8_t llen;
+    uint64_t len;
+
+    size_t i;
+    for (i = 0; i < file->getNumPartitions(); i++) {
+        if (file->getPartitionBodySID(i) != ESSENCE_BODY_SID)
+            continue;
+
+        const Partition &partition = file->getPartition(i);
+        CHECK(partition.getBodySID() == ESSENCE_BODY_SID);
+        CHECK(partition.getThisPartition() == file->getPartitionOffset(i));
+        body_offsets->push_back(partition.getBodyOffset());
+
+        file->seek(partition.getThisPartition(), SEEK_SET);
+        file->readKL(&key, &llen, &len);
+        file->skip(len);
+        while (file->tell() < (int64_t)file->getPartitionOffset(i + 1)) {
+            file->readNextNonFillerKL(&key, &llen, &len);
+            CHECK(mxf_equals_key(&key, &ELEMENT_KEY) && len == FRAME_SIZE);
+
+            size_t frame_offset = frames->size();
+            frames->resize(frame_offset + FRAME_SIZE);
+            CHECK(file->read(&(*frames)[frame_offset], FRAME_SIZE) == FRAME_SIZE);
+        }
+    }
+
+    return true;
+}
+
+static bool test_lazy_matches_eager()
+{
+    auto_ptr<File> eager_file(File::openRead(TEST_FILENAME));
+    CHECK(eager_file->readPartitions(false));
+    CHECK(eager_file->getNumPartitions() == NUM_BODY_PARTITIONS + 2);
+    CHECK(eager_file->getPartitionPackReadCount() == NUM_BODY_PARTITIONS + 2);
+
+    auto_ptr<File> lazy_file(File::openRead(TEST_FILENAME));
+    CHECK(lazy_file->readPartitions(true));
+    CHECK(lazy_file->getNumPartitions() == NUM_BODY_PARTITIONS + 2);
+    // only the header and footer partition packs are read when opening
+    CHECK(lazy_file->getPartitionPackReadCount() == 2);
+    CHECK(!lazy_file->isPartitionLoaded(1));
+    CHECK(lazy_file->isPartitionLoaded(NUM_BODY_PARTITIONS + 1));
+
+    vector<unsigned char> eager_frames, lazy_frames;
+    vector<uint64_t> eager_body_offsets, lazy_body_offsets;
+    CHECK(read_frames(eager_file.get(), &eager_frames, &eager_body_offsets));
+    CHECK(read_frames(lazy_file.get(), &lazy_frames, &lazy_body_offsets));
+
+    CHECK(!eager_frames.empty());
+    CHECK(lazy_frames == eager_frames);
+    CHECK(lazy_body_offsets == eager_body_offsets);
+
+    // the partition packs of the other stream were not read
+    size_t num_other = NUM_BODY_PARTITIONS / 3;
+    CHECK(lazy_file->getPartitionPackReadCount() == NUM_BODY_PARTITIONS + 2 - num_other);
+    CHECK(!lazy_file->isPartitionLoaded(3));
+
+    // getPartitions loads the remaining partitions, including through a const File
+    const File *const_file = lazy_file.get();
+    const vector<Partition*> &partitions = const_file->getPartitions();
+    CHECK(partitions.size() == NUM_BODY_PARTITIONS + 2);
+    CHECK(lazy_file->getPartitionPackReadCount() == NUM_BODY_PARTITIONS + 2);
+    size_t i;
+    for (i = 0; i < partitions.size(); i++) {
+        CHECK(partitions[i] != 0);
+        CHECK(partitions[i]->getThisPartition() == eager_file->getPartitions()[i]->getThisPartition());
+        CHECK(partitions[i]->getBodySID() == eager_file->getPartitions()[i]->getBodySID());
+    }
+
+    return true;
+}
+
+static bool test_invalid_rip()
+{
+    mxfKey key;
+    uint8_t llen;
+    uint64_t len;
+
+    // set the offset of the second RIP entry beyond the end of the file
+    {
+        auto_ptr<File> file(File::openModify(TEST_FILENAME));
+        int64_t file_size = file->size();
+        file->seek(file_size - 4, SEEK_SET);
+        uint32_t rip_size = file->readUInt32();
+        file->seek(file_size - rip_size, SEEK_SET);
+        file->readKL(&key, &llen, &len);
+        CHECK(mxf_equals_key(&key, &g_RandomIndexPack_key));
+        file->seek(12 + 4, SEEK_CUR);
+        file->writeUInt64(file_size + 100);
+    }
+
+    // lazy reading falls back to reading all the partition packs and fails in the same way
+    auto_ptr<File> eager_file(File::openRead(TEST_FILENAME));
+    CHECK(!eager_file->readPartitions(false));
+    auto_ptr<File> lazy_file(File::openRead(TEST_FILENAME));
+    CHECK(!lazy_file->readPartitions(true));
+    CHECK(lazy_file->getNumPartitions() == eager_file->getNumPartitions());
+
+    return true;
+}
+
+
+
+int main(int argc, const char **argv)
+{
+    (void)argc;
+    (void)argv;
+
+    bool result = true;
+    try
+    {
+        write_test_file();
+
+        result = test_lazy_matches_eager() && test_invalid_rip();
+    }
+    catch (const MXFException &ex)
+    {
+        fprintf(stderr, "Failed: %s\n", ex.getMessage().c_str());
+        result = false;
+    }
+
+    remove(TEST_FILENAME);
+
+    return result ? 0 : 1;
+}
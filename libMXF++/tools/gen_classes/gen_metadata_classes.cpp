@@ -262,6 +262,57 @@ static const char* get_type_name(MXFDataModel *dataModel, MXFItemDef *itemDef,
     return typeName;
 }
 
+/* returns true if the item's getter looks up the item using a slot */
+static int have_slot_getter(MXFItemType *itemType)
+{
+    if (itemType->category == MXF_BASIC_TYPE_CAT)
+    {
+        return itemType->typeId != MXF_RAW_TYPE;
+    }
+    else if (itemType->category == MXF_INTERPRET_TYPE_CAT)
+    {
+        switch (itemType->typeId)
+        {
+            case MXF_VERSIONTYPE_TYPE:
+            case MXF_BOOLEAN_TYPE:
+            case MXF_LENGTH_TYPE:
+            case MXF_POSITION_TYPE:
+            case MXF_RGBACODE_TYPE:
+            case MXF_UMID_TYPE:
+            case MXF_UL_TYPE:
+            case MXF_UUID_TYPE:
+            case MXF_AUID_TYPE:
+            case MXF_PACKAGEID_TYPE:
+            case MXF_STRONGREF_TYPE:
+            case MXF_WEAKREF_TYPE:
+            case MXF_ORIENTATION_TYPE:
+            case MXF_CODED_CONTENT_TYPE_TYPE:
+                return 1;
+            default:
+                return 0;
+        }
+    }
+    else if (itemType->category == MXF_COMPOUND_TYPE_CAT)
+    {
+        return itemType->typeId == MXF_RATIONAL_TYPE ||
+               itemType->typeId == MXF_TIMESTAMP_TYPE ||
+               itemType->typeId == MXF_PRODUCTVERSION_TYPE;
+    }
+
+    return 0;
+}
+
+static void get_slot_name(MXFItemDef *itemDef, char slotName[256])
+{
+    size_t i;
+
+    for (i = 0; itemDef->name[i] != '\0'; i++)
+    {
+        slotName[i] = toupper(itemDef->name[i]);
+    }
+    strcpy(&slotName[i], "_SLOT");
+}
+
 static void gen_class(const char *directory, MXFDataModel *dataModel, MXFSetDef *setDef)
 {
     FILE *baseSourceFile;
@@ -279,6 +330,9 @@ static void gen_class(const char *directory, MXFDataModel *dataModel, MXFSetDef
     char itemName[256];
     char typeName[256];
     char elementTypeName[256];
+    char slotName[256];
+    char slotArg[264];
+    int haveSlots;
     char c;
 
 
@@ -644,6 +698,9 @@ static void gen_class(const char *directory, MXFDataModel *dataModel, MXFSetDef
 
         strcpy(itemName, itemDef->name);
         itemName[0] = toupper(itemName[0]);
+        get_slot_name(itemDef, slotName);
+        strcpy(slotArg, slotName);
+        strcat(slotArg, ", ");
 
         if (itemType->category == MXF_BASIC_TYPE_CAT ||
             itemType->category == MXF_INTERPRET_TYPE_CAT ||
@@ -685,11 +742,11 @@ static void gen_class(const char *directory, MXFDataModel *dataModel, MXFSetDef
             fprintf(baseSourceFile,
                 "bool %s::have%s() const\n"
                 "{\n"
-                "    return haveItem(&MXF_ITEM_K(%s, %s));\n"
+                "    return haveItem(%s, &MXF_ITEM_K(%s, %s));\n"
                 "}\n"
                 "\n",
                 baseClassName, itemName,
-                className, itemName);
+                slotName, className, itemName);
         }
 
         fprintf(baseSourceFile,
@@ -703,36 +760,36 @@ static void gen_class(const char *directory, MXFDataModel *dataModel, MXFSetDef
             switch (itemType->typeId)
             {
                 case MXF_INT8_TYPE:
-                    fprintf(baseSourceFile, "    return getInt8Item(&MXF_ITEM_K(%s, %s));\n",
-                        className, itemName);
+                    fprintf(baseSourceFile, "    return getInt8Item(%s&MXF_ITEM_K(%s, %s));\n",
+                        slotArg, className, itemName);
                     break;
                 case MXF_INT16_TYPE:
-                    fprintf(baseSourceFile, "    return getInt16Item(&MXF_ITEM_K(%s, %s));\n",
-                        className, itemName);
+                    fprintf(baseSourceFile, "    return getInt16Item(%s&MXF_ITEM_K(%s, %s));\n",
+                        slotArg, className, itemName);
                     break;
                 case MXF_INT32_TYPE:
-                    fprintf(baseSourceFile, "    return getInt32Item(&MXF_ITEM_K(%s, %s));\n",
-                        className, itemName);
+                    fprintf(baseSourceFile, "    return getInt32Item(%s&MXF_ITEM_K(%s, %s));\n",
+                        slotArg, className, itemName);
                     break;
                 case MXF_INT64_TYPE:
-                    fprintf(baseSourceFile, "    return getInt64Item(&MXF_ITEM_K(%s, %s));\n",
-                        className, itemName);
+                    fprintf(baseSourceFile, "    return getInt64Item(%s&MXF_ITEM_K(%s, %s));\n",
+                        slotArg, className, itemName);
                     break;
                 case MXF_UINT8_TYPE:
-                    fprintf(baseSourceFile, "    return getUInt8Item(&MXF_ITEM_K(%s, %s));\n",
-                        className, itemName);
+                    fprintf(baseSourceFile, "    return getUInt8Item(%s&MXF_ITEM_K(%s, %s));\n",
+                        slotArg, className, itemName);
                     break;
                 case MXF_UINT16_TYPE:
-                    fprintf(baseSourceFile, "    return getUInt16Item(&MXF_ITEM_K(%s, %s));\n",
-                        className, itemName);
+                    fprintf(baseSourceFile, "    return getUInt16Item(%s&MXF_ITEM_K(%s, %s));\n",
+                        slotArg, className, itemName);
                     break;
                 case MXF_UINT32_TYPE:
-                    fprintf(baseSourceFile, "    return getUInt32Item(&MXF_ITEM_K(%s, %s));\n",
-                        className, itemName);
+                    fprintf(baseSourceFile, "    return getUInt32Item(%s&MXF_ITEM_K(%s, %s));\n",
+                        slotArg, className, itemName);
                     break;
                 case MXF_UINT64_TYPE:
-                    fprintf(baseSourceFile, "    return getUInt64Item(&MXF_ITEM_K(%s, %s));\n",
-                        className, itemName);
+                    fprintf(baseSourceFile, "    return getUInt64Item(%s&MXF_ITEM_K(%s, %s));\n",
+                        slotArg, className, itemName);
                     break;
                 case MXF_RAW_TYPE:
                     fprintf(baseSourceFile, "    return getRawBytesItem(&MXF_ITEM_K(%s, %s));\n",
@@ -749,24 +806,24 @@ static void gen_class(const char *directory, MXFDataModel *dataModel, MXFSetDef
             switch (itemType->typeId)
             {
                 case MXF_VERSIONTYPE_TYPE:
-                    fprintf(baseSourceFile, "    return getVersionTypeItem(&MXF_ITEM_K(%s, %s));\n",
-                        className, itemName);
+                    fprintf(baseSourceFile, "    return getVersionTypeItem(%s&MXF_ITEM_K(%s, %s));\n",
+                        slotArg, className, itemName);
                     break;
                 case MXF_BOOLEAN_TYPE:
-                    fprintf(baseSourceFile, "    return getBooleanItem(&MXF_ITEM_K(%s, %s));\n",
-                        className, itemName);
+                    fprintf(baseSourceFile, "    return getBooleanItem(%s&MXF_ITEM_K(%s, %s));\n",
+                        slotArg, className, itemName);
                     break;
                case MXF_LENGTH_TYPE:
-                    fprintf(baseSourceFile, "    return getLengthItem(&MXF_ITEM_K(%s, %s));\n",
-                        className, itemName);
+                    fprintf(baseSourceFile, "    return getLengthItem(%s&MXF_ITEM_K(%s, %s));\n",
+                        slotArg, className, itemName);
                     break;
                 case MXF_POSITION_TYPE:
-                    fprintf(baseSourceFile, "    return getPositionItem(&MXF_ITEM_K(%s, %s));\n",
-                        className, itemName);
+                    fprintf(baseSourceFile, "    return getPositionItem(%s&MXF_ITEM_K(%s, %s));\n",
+                        slotArg, className, itemName);
                     break;
                 case MXF_RGBACODE_TYPE:
-                    fprintf(baseSourceFile, "    return getUInt8Item(&MXF_ITEM_K(%s, %s));\n",
-                        className, itemName);
+                    fprintf(baseSourceFile, "    return getUInt8Item(%s&MXF_ITEM_K(%s, %s));\n",
+                        slotArg, className, itemName);
                     break;
                 case MXF_STREAM_TYPE:
                     fprintf(baseSourceFile, "    return getRawBytesItem(&MXF_ITEM_K(%s, %s));\n",
@@ -785,56 +842,56 @@ static void gen_class(const char *directory, MXFDataModel *dataModel, MXFSetDef
                         className, itemName);
                     break;
                 case MXF_UMID_TYPE:
-                    fprintf(baseSourceFile, "    return getUMIDItem(&MXF_ITEM_K(%s, %s));\n",
-                        className, itemName);
+                    fprintf(baseSourceFile, "    return getUMIDItem(%s&MXF_ITEM_K(%s, %s));\n",
+                        slotArg, className, itemName);
                     break;
                 case MXF_UID_TYPE:
                     fprintf(baseSourceFile, "    return getUIDItem(&MXF_ITEM_K(%s, %s));\n",
                         className, itemName);
                     break;
                 case MXF_UL_TYPE:
-                    fprintf(baseSourceFile, "    return getULItem(&MXF_ITEM_K(%s, %s));\n",
-                        className, itemName);
+                    fprintf(baseSourceFile, "    return getULItem(%s&MXF_ITEM_K(%s, %s));\n",
+                        slotArg, className, itemName);
                     break;
                 case MXF_UUID_TYPE:
-                    fprintf(baseSourceFile, "    return getUUIDItem(&MXF_ITEM_K(%s, %s));\n",
-                        className, itemName);
+                    fprintf(baseSourceFile, "    return getUUIDItem(%s&MXF_ITEM_K(%s, %s));\n",
+                        slotArg, className, itemName);
                     break;
                 case MXF_AUID_TYPE:
-                    fprintf(baseSourceFile, "    return getAUIDItem(&MXF_ITEM_K(%s, %s));\n",
-                        className, itemName);
+                    fprintf(baseSourceFile, "    return getAUIDItem(%s&MXF_ITEM_K(%s, %s));\n",
+                        slotArg, className, itemName);
                     break;
                 case MXF_PACKAGEID_TYPE:
-                    fprintf(baseSourceFile, "    return getUMIDItem(&MXF_ITEM_K(%s, %s));\n",
-                        className, itemName);
+                    fprintf(baseSourceFile, "    return getUMIDItem(%s&MXF_ITEM_K(%s, %s));\n",
+                        slotArg, className, itemName);
                     break;
                 case MXF_STRONGREF_TYPE:
                     c = typeName[strlen(typeName) - 1];
                     typeName[strlen(typeName) - 1] = '\0';
                     fprintf(baseSourceFile,
-                        "    auto_ptr<MetadataSet> obj(getStrongRefItem(&MXF_ITEM_K(%s, %s)));\n"
+                        "    auto_ptr<MetadataSet> obj(getStrongRefItem(%s&MXF_ITEM_K(%s, %s)));\n"
                         "    MXFPP_CHECK(dynamic_cast<%s*>(obj.get()) != 0);\n"
                         "    return dynamic_cast<%s*>(obj.release());\n",
-                        className, itemName, typeName, typeName);
+                        slotArg, className, itemName, typeName, typeName);
                     typeName[strlen(typeName) - 1] = c;
                     break;
                 case MXF_WEAKREF_TYPE:
                     c = typeName[strlen(typeName) - 1];
                     typeName[strlen(typeName) - 1] = '\0';
                     fprintf(baseSourceFile,
-                        "    auto_ptr<MetadataSet> obj(getWeakRefItem(&MXF_ITEM_K(%s, %s)));\n"
+                        "    auto_ptr<MetadataSet> obj(getWeakRefItem(%s&MXF_ITEM_K(%s, %s)));\n"
                         "    MXFPP_CHECK(dynamic_cast<%s*>(obj.get()) != 0);\n"
                         "    return dynamic_cast<%s*>(obj.release());\n",
-                        className, itemName, typeName, typeName);
+                        slotArg, className, itemName, typeName, typeName);
                     typeName[strlen(typeName) - 1] = c;
                     break;
                 case MXF_ORIENTATION_TYPE:
-                    fprintf(baseSourceFile, "    return getUInt8Item(&MXF_ITEM_K(%s, %s));\n",
-                        className, itemName);
+                    fprintf(baseSourceFile, "    return getUInt8Item(%s&MXF_ITEM_K(%s, %s));\n",
+                        slotArg, className, itemName);
                     break;
                 case MXF_CODED_CONTENT_TYPE_TYPE:
-                    fprintf(baseSourceFile, "    return getUInt8Item(&MXF_ITEM_K(%s, %s));\n",
-                        className, itemName);
+                    fprintf(baseSourceFile, "    return getUInt8Item(%s&MXF_ITEM_K(%s, %s));\n",
+                        slotArg, className, itemName);
                     break;
                 default:
                     fprintf(stderr, "Warning: unknown interpret type %d\n", itemType->typeId);
@@ -847,16 +904,16 @@ static void gen_class(const char *directory, MXFDataModel *dataModel, MXFSetDef
             switch (itemType->typeId)
             {
                 case MXF_RATIONAL_TYPE:
-                    fprintf(baseSourceFile, "    return getRationalItem(&MXF_ITEM_K(%s, %s));\n",
-                        className, itemName);
+                    fprintf(baseSourceFile, "    return getRationalItem(%s&MXF_ITEM_K(%s, %s));\n",
+                        slotArg, className, itemName);
                     break;
                 case MXF_TIMESTAMP_TYPE:
-                    fprintf(baseSourceFile, "    return getTimestampItem(&MXF_ITEM_K(%s, %s));\n",
-                        className, itemName);
+                    fprintf(baseSourceFile, "    return getTimestampItem(%s&MXF_ITEM_K(%s, %s));\n",
+                        slotArg, className, itemName);
                     break;
                 case MXF_PRODUCTVERSION_TYPE:
-                    fprintf(baseSourceFile, "    return getProductVersionItem(&MXF_ITEM_K(%s, %s));\n",
-                        className, itemName);
+                    fprintf(baseSourceFile, "    return getProductVersionItem(%s&MXF_ITEM_K(%s, %s));\n",
+                        slotArg, className, itemName);
                     break;
                 case MXF_INDIRECT_TYPE:
                     fprintf(baseSourceFile, "    return getRGBALayoutComponentItem(&MXF_ITEM_K(%s, %s));\n",
@@ -1940,7 +1997,47 @@ static void gen_class(const char *directory, MXFDataModel *dataModel, MXFSetDef
     fprintf(baseHeaderFile,
         "\n"
         "\n"
-        "protected:\n"
+        "protected:\n");
+
+    haveSlots = 0;
+    mxf_initialise_list_iter(&itemIter, &setDef->itemDefs);
+    while (mxf_next_list_iter_element(&itemIter))
+    {
+        MXFItemDef *itemDef = (MXFItemDef*)mxf_get_iter_element(&itemIter);
+        MXFItemType *itemType = mxf_get_item_def_type(dataModel, itemDef->typeId);
+        CHECK(itemType != NULL);
+
+        if (itemDef->isRequired && !have_slot_getter(itemType))
+        {
+            continue;
+        }
+
+        get_slot_name(itemDef, slotName);
+        if (!haveSlots)
+        {
+            fprintf(baseHeaderFile,
+                "    enum\n"
+                "    {\n"
+                "        %s = %s::ITEM_SLOT_END,\n",
+                slotName, parentClassName);
+            haveSlots = 1;
+        }
+        else
+        {
+            fprintf(baseHeaderFile,
+                "        %s,\n",
+                slotName);
+        }
+    }
+    if (haveSlots)
+    {
+        fprintf(baseHeaderFile,
+            "        ITEM_SLOT_END\n"
+            "    };\n"
+            "\n");
+    }
+
+    fprintf(baseHeaderFile,
         "    %s(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet);\n"
         "};\n"
         "\n"
@@ -44,6 +44,7 @@ extern "C"
 #include <mxf/mxf_version.h>
 #include <mxf/mxf_labels_and_keys.h>
 #include <mxf/mxf_list.h>
+#include <mxf/mxf_arena.h>
 #include <mxf/mxf_tree.h>
 #include <mxf/mxf_logging.h>
 #include <mxf/mxf_file.h>
@@ -0,0 +1,178 @@
+/*
+ * Copyright (C) 2017, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Author: Philip de Nier
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+#include <mxf/mxf.h>
+#include <mxf/mxf_macros.h>
+
+
+#define ARENA_ALIGNMENT     16
+
+#define ALIGN_SIZE(size)    (((size) + ARENA_ALIGNMENT - 1) & ~((size_t)ARENA_ALIGNMENT - 1))
+
+
+typedef struct ArenaBlock
+{
+    struct ArenaBlock *next;
+    size_t size;
+    size_t used;
+} ArenaBlock;
+
+struct MXFArena
+{
+    size_t blockSize;
+    ArenaBlock *blocks;
+    int refCount;
+};
+
+
+/* the block header is padded so that block data starts aligned */
+#define BLOCK_HEADER_SIZE   ALIGN_SIZE(sizeof(ArenaBlock))
+#define BLOCK_DATA(block)   ((uint8_t*)(block) + BLOCK_HEADER_SIZE)
+
+
+static ArenaBlock* alloc_block(size_t size)
+{
+    ArenaBlock *block;
+
+    block = (ArenaBlock*)malloc(BLOCK_HEADER_SIZE + size);
+    if (!block)
+    {
+        mxf_log_error("Failed to allocate arena block of size %"PRIszt LOG_LOC_FORMAT, size, LOG_LOC_PARAMS);
+        return NULL;
+    }
+    block->next = NULL;
+    block->size = size;
+    block->used = 0;
+
+    return block;
+}
+
+
+
+int mxf_create_arena(MXFArena **arena, size_t blockSize)
+{
+    MXFArena *newArena;
+
+    CHK_MALLOC_ORET(newArena, MXFArena);
+    memset(newArena, 0, sizeof(*newArena));
+    newArena->blockSize = ALIGN_SIZE(blockSize > 0 ? blockSize : MXF_ARENA_DEFAULT_BLOCK_SIZE);
+    newArena->refCount  = 1;
+
+    *arena = newArena;
+    return 1;
+}
+
+MXFArena* mxf_ref_arena(MXFArena *arena)
+{
+    arena->refCount++;
+    return arena;
+}
+
+void mxf_unref_arena(MXFArena **arena)
+{
+    ArenaBlock *block;
+    ArenaBlock *nextBlock;
+
+    if (*arena == NULL)
+    {
+        return;
+    }
+
+    (*arena)->refCount--;
+    if ((*arena)->refCount == 0)
+    {
+        block = (*arena)->blocks;
+        while (block)
+        {
+            nextBlock = block->next;
+            free(block);
+            block = nextBlock;
+        }
+        SAFE_FREE(*arena);
+    }
+
+    *arena = NULL;
+}
+
+void* mxf_arena_alloc(MXFArena *arena, size_t size)
+{
+    ArenaBlock *block;
+    void *result;
+
+    size = ALIGN_SIZE(size);
+
+    /* large allocations get a block of their own which is placed after the current block */
+    if (size > arena->blockSize / 4)
+    {
+        block = alloc_block(size);
+        if (!block)
+        {
+            return NULL;
+        }
+        if (arena->blocks)
+        {
+            block->next = arena->blocks->next;
+            arena->blocks->next = block;
+        }
+        else
+        {
+            arena->blocks = block;
+        }
+        block->used = size;
+        return BLOCK_DATA(block);
+    }
+
+    block = arena->blocks;
+    if (!block || block->used + size > block->size)
+    {
+        block = alloc_block(arena->blockSize);
+        if (!block)
+        {
+            return NULL;
+        }
+        block->next = arena->blocks;
+        arena->blocks = block;
+    }
+
+    result = BLOCK_DATA(block) + block->used;
+    block->used += size;
+
+    return result;
+}
+
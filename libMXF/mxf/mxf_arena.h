@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2017, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Author: Philip de Nier
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef MXF_ARENA_H_
+#define MXF_ARENA_H_
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+
+/* default size of the blocks an arena allocates from */
+#define MXF_ARENA_DEFAULT_BLOCK_SIZE    (64 * 1024)
+
+
+/* An arena hands out memory from a few large blocks that are freed together when the last
+   reference to the arena is released. Memory is not returned to the arena when an allocation
+   is no longer used. Objects allocated from an arena should hold a reference for as long as they
+   are alive so that they can outlive the original owner of the arena */
+typedef struct MXFArena MXFArena;
+
+
+int mxf_create_arena(MXFArena **arena, size_t blockSize);
+MXFArena* mxf_ref_arena(MXFArena *arena);
+void mxf_unref_arena(MXFArena **arena);
+
+/* returns memory aligned for any basic type, or NULL if the allocation failed */
+void* mxf_arena_alloc(MXFArena *arena, size_t size);
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif
+
@@ -1120,10 +1120,11 @@ int mxf_avid_get_product_version_item(MXFMetadataSet *set, const mxfKey *itemKey
     return 1;
 }
 
-int mxf_avid_read_index_table_segment_2(MXFFile *mxfFile, uint64_t segmentLen,
-                                        mxf_add_delta_entry *addDeltaEntry, void *addDeltaEntryData,
-                                        mxf_add_index_entry *addIndexEntry, void *addIndexEntryData,
-                                        MXFIndexTableSegment **segment)
+static int avid_read_index_table_segment(MXFFile *mxfFile, uint64_t segmentLen,
+                                         mxf_add_delta_entry *addDeltaEntry, void *addDeltaEntryData,
+                                         mxf_add_index_entry *addIndexEntry, void *addIndexEntryData,
+                                         mxf_get_index_entry_arrays *getIndexEntryArrays, void *getIndexEntryArraysData,
+                                         MXFIndexTableSegment **segment)
 {
     MXFIndexTableSegment *newSegment = NULL;
     mxfLocalTag localTag;
@@ -1263,7 +1264,17 @@ int mxf_avid_read_index_table_segment_2(MXFFile *mxfFile, uint64_t segmentLen,
                     mxf_log_warn("Index entry length %u is incorrect; it should be %u\n", indexEntryLen,
                                  (uint32_t)11 + newSegment->sliceCount * 4 + newSegment->posTableCount * 8);
                 }
-                entry = indexEntryArrayLen;
+                if (getIndexEntryArrays != NULL)
+                {
+                    CHK_OFAIL(mxf_read_index_entry_array(mxfFile, newSegment, indexEntryArrayLen, indexEntryLen,
+                                                         getIndexEntryArrays, getIndexEntryArraysData));
+                    actualLen += (uint64_t)indexEntryArrayLen * indexEntryLen;
+                    entry = 0;
+                }
+                else
+                {
+                    entry = indexEntryArrayLen;
+                }
                 for (; entry > 0; entry--)
                 {
                     actualEntryLen = 0;
@@ -1324,6 +1335,24 @@ fail:
     return 0;
 }
 
+int mxf_avid_read_index_table_segment_2(MXFFile *mxfFile, uint64_t segmentLen,
+                                        mxf_add_delta_entry *addDeltaEntry, void *addDeltaEntryData,
+                                        mxf_add_index_entry *addIndexEntry, void *addIndexEntryData,
+                                        MXFIndexTableSegment **segment)
+{
+    return avid_read_index_table_segment(mxfFile, segmentLen, addDeltaEntry, addDeltaEntryData,
+                                         addIndexEntry, addIndexEntryData, NULL, NULL, segment);
+}
+
+int mxf_avid_read_index_table_segment_3(MXFFile *mxfFile, uint64_t segmentLen,
+                                        mxf_add_delta_entry *addDeltaEntry, void *addDeltaEntryData,
+                                        mxf_get_index_entry_arrays *getIndexEntryArrays, void *getIndexEntryArraysData,
+                                        MXFIndexTableSegment **segment)
+{
+    return avid_read_index_table_segment(mxfFile, segmentLen, addDeltaEntry, addDeltaEntryData,
+                                         NULL, NULL, getIndexEntryArrays, getIndexEntryArraysData, segment);
+}
+
 int mxf_avid_read_index_table_segment(MXFFile *mxfFile, uint64_t segmentLen, MXFIndexTableSegment **segment)
 {
     CHK_ORET(mxf_avid_read_index_table_segment_2(mxfFile, segmentLen, mxf_default_add_delta_entry, NULL,
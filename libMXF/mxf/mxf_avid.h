@@ -136,6 +136,10 @@ int mxf_avid_read_index_table_segment_2(MXFFile *mxfFile, uint64_t segmentLen,
                                         mxf_add_delta_entry *addDeltaEntry, void *addDeltaEntryData,
                                         mxf_add_index_entry *addIndexEntry, void *addIndexEntryData,
                                         MXFIndexTableSegment **segment);
+int mxf_avid_read_index_table_segment_3(MXFFile *mxfFile, uint64_t segmentLen,
+                                        mxf_add_delta_entry *addDeltaEntry, void *addDeltaEntryData,
+                                        mxf_get_index_entry_arrays *getIndexEntryArrays, void *getIndexEntryArraysData,
+                                        MXFIndexTableSegment **segment);
 
 
 int mxf_avid_is_mjpeg_essence_element(const mxfKey *key);
@@ -43,6 +43,8 @@
 #include <mxf/mxf_macros.h>
 
 
+#define NO_PAGE     UINT32_MAX
+
 
 typedef struct
 {
@@ -51,6 +53,15 @@ typedef struct
     int isDirty;
 } Page;
 
+typedef struct
+{
+    int64_t position;
+    uint32_t size;
+    uint32_t lruPrev;
+    uint32_t lruNext;
+    uint32_t hashNext;
+} ReadPage;
+
 struct MXFCacheFile
 {
     MXFFile *mxfFile;
@@ -71,6 +82,20 @@ struct MXFFileSysData
     uint32_t dirtyCount;
     int eof;
     int writingAtEOF;
+
+    /* read-only mode with least-recently-used page eviction */
+    int readOnly;
+    ReadPage *readPages;
+    uint32_t *hashTable;
+    uint32_t hashMask;
+    uint32_t lruHead;       /* most recently used page */
+    uint32_t lruTail;       /* least recently used page */
+    unsigned char *readAheadData;
+    uint32_t readAheadPages;
+    int64_t nextLoadPosition;
+    int64_t targetPosition;
+    int64_t numHits;
+    int64_t numMisses;
 };
 
 
@@ -154,22 +179,31 @@ static int flush_dirty_pages(MXFFileSysData *sysData, uint32_t pageIndex, uint32
 static void cache_file_close(MXFFileSysData *sysData)
 {
     if (sysData->target) {
-        flush_dirty_pages(sysData, 0, sysData->numPages);
+        if (!sysData->readOnly)
+            flush_dirty_pages(sysData, 0, sysData->numPages);
         mxf_file_close(&sysData->target);
     }
 
+    if (sysData->readOnly && sysData->numHits + sysData->numMisses > 0) {
+        mxf_log_debug("Read cache file had %" PRId64 " page hits and %" PRId64 " page misses\n",
+                      sysData->numHits, sysData->numMisses);
+    }
+
     SAFE_FREE(sysData->pages);
     SAFE_FREE(sysData->allocCacheData);
+    SAFE_FREE(sysData->readPages);
+    SAFE_FREE(sysData->hashTable);
+    SAFE_FREE(sysData->readAheadData);
 }
 
-static uint32_t cache_file_read(MXFFileSysData *sysData, uint8_t *data, uint32_t count)
+static uint64_t cache_file_read_64(MXFFileSysData *sysData, uint8_t *data, uint64_t count)
 {
     int64_t pagePosition;
     uint32_t pageIndex;
     uint32_t pageOffset;
     uint32_t numRead;
     uint32_t numPagesRead;
-    uint32_t remCount = count;
+    uint64_t remCount = count;
     uint32_t i;
 
     while (remCount > 0) {
@@ -181,7 +215,7 @@ static uint32_t cache_file_read(MXFFileSysData *sysData, uint8_t *data, uint32_t
 
             numRead = sysData->pages[pageIndex].size - pageOffset;
             if (numRead > remCount)
-                numRead = remCount;
+                numRead = (uint32_t)remCount;
             if (data)
                 memcpy(&data[count - remCount], &sysData->cacheData[pageIndex * sysData->pageSize + pageOffset], numRead);
             remCount -= numRead;
@@ -189,9 +223,10 @@ static uint32_t cache_file_read(MXFFileSysData *sysData, uint8_t *data, uint32_t
         } else {
             /* read as many pages as possible in one read call */
             /* note: we assume that the data to be read is not already in the cache */
-            numPagesRead = (remCount + sysData->pageSize - 1) / sysData->pageSize;
-            if (numPagesRead > sysData->numPages - pageIndex)
+            if (remCount > (uint64_t)(sysData->numPages - pageIndex) * sysData->pageSize)
                 numPagesRead = sysData->numPages - pageIndex;
+            else
+                numPagesRead = (uint32_t)((remCount + sysData->pageSize - 1) / sysData->pageSize);
 
             CHK_ORET(flush_dirty_pages(sysData, pageIndex, numPagesRead));
 
@@ -219,15 +254,15 @@ static uint32_t cache_file_read(MXFFileSysData *sysData, uint8_t *data, uint32_t
     return count - remCount;
 }
 
-static uint32_t cache_file_write(MXFFileSysData *sysData, const uint8_t *data, uint32_t count)
+static uint64_t cache_file_write_64(MXFFileSysData *sysData, const uint8_t *data, uint64_t count)
 {
     int64_t pagePosition;
     uint32_t pageIndex;
     uint32_t pageOffset;
     uint32_t numWrite;
     uint32_t numPagesWrite;
-    uint32_t remCount = count;
-    uint32_t numRead;
+    uint64_t remCount = count;
+    uint64_t numRead;
     int64_t originalPosition;
     int originalEOF;
     uint32_t i;
@@ -259,16 +294,17 @@ static uint32_t cache_file_write(MXFFileSysData *sysData, const uint8_t *data, u
 
             numWrite = sysData->pageSize - pageOffset;
             if (numWrite > remCount)
-                numWrite = remCount;
+                numWrite = (uint32_t)remCount;
             memcpy(&sysData->cacheData[pageIndex * sysData->pageSize + pageOffset], &data[count - remCount], numWrite);
             if (pageOffset + numWrite > sysData->pages[pageIndex].size)
                 sysData->pages[pageIndex].size = pageOffset + numWrite;
             remCount -= numWrite;
             sysData->position += numWrite;
         } else {
-            numPagesWrite = (remCount + sysData->pageSize - 1) / sysData->pageSize;
-            if (numPagesWrite > sysData->numPages)
+            if (remCount > (uint64_t)sysData->numPages * sysData->pageSize)
                 numPagesWrite = sysData->numPages;
+            else
+                numPagesWrite = (uint32_t)((remCount + sysData->pageSize - 1) / sysData->pageSize);
 
             if (sysData->writingAtEOF) {
                 CHK_ORET(flush_dirty_pages(sysData, pageIndex, numPagesWrite));
@@ -280,7 +316,7 @@ static uint32_t cache_file_write(MXFFileSysData *sysData, const uint8_t *data, u
                 originalPosition = sysData->position;
                 originalEOF      = sysData->eof;
 
-                numRead = cache_file_read(sysData, NULL, numPagesWrite * sysData->pageSize);
+                numRead = cache_file_read_64(sysData, NULL, numPagesWrite * sysData->pageSize);
                 if (numRead < numPagesWrite * sysData->pageSize) {
                     CHK_ORET(sysData->eof);
                     sysData->writingAtEOF = 1;
@@ -295,6 +331,16 @@ static uint32_t cache_file_write(MXFFileSysData *sysData, const uint8_t *data, u
     return count - remCount;
 }
 
+static uint32_t cache_file_read(MXFFileSysData *sysData, uint8_t *data, uint32_t count)
+{
+    return (uint32_t)cache_file_read_64(sysData, data, count);
+}
+
+static uint32_t cache_file_write(MXFFileSysData *sysData, const uint8_t *data, uint32_t count)
+{
+    return (uint32_t)cache_file_write_64(sysData, data, count);
+}
+
 static int cache_file_getchar(MXFFileSysData *sysData)
 {
     uint8_t data;
@@ -382,6 +428,293 @@ static int64_t cache_file_size(MXFFileSysData *sysData)
     return size;
 }
 
+static uint32_t hash_page_position(MXFFileSysData *sysData, int64_t pagePosition)
+{
+    uint64_t pageNumber = (uint64_t)(pagePosition / sysData->pageSize);
+
+    return (uint32_t)((pageNumber ^ (pageNumber >> 32)) * 2654435761U) & sysData->hashMask;
+}
+
+static uint32_t find_read_page(MXFFileSysData *sysData, int64_t pagePosition)
+{
+    uint32_t pageIndex = sysData->hashTable[hash_page_position(sysData, pagePosition)];
+
+    while (pageIndex != NO_PAGE && sysData->readPages[pageIndex].position != pagePosition)
+        pageIndex = sysData->readPages[pageIndex].hashNext;
+
+    return pageIndex;
+}
+
+static void lru_unlink(MXFFileSysData *sysData, uint32_t pageIndex)
+{
+    ReadPage *page = &sysData->readPages[pageIndex];
+
+    if (page->lruPrev != NO_PAGE)
+        sysData->readPages[page->lruPrev].lruNext = page->lruNext;
+    else
+        sysData->lruHead = page->lruNext;
+    if (page->lruNext != NO_PAGE)
+        sysData->readPages[page->lruNext].lruPrev = page->lruPrev;
+    else
+        sysData->lruTail = page->lruPrev;
+}
+
+static void lru_touch(MXFFileSysData *sysData, uint32_t pageIndex)
+{
+    ReadPage *page = &sysData->readPages[pageIndex];
+
+    if (sysData->lruHead == pageIndex)
+        return;
+
+    lru_unlink(sysData, pageIndex);
+    page->lruPrev = NO_PAGE;
+    page->lruNext = sysData->lruHead;
+    sysData->readPages[sysData->lruHead].lruPrev = pageIndex;
+    sysData->lruHead = pageIndex;
+}
+
+static uint32_t evict_read_page(MXFFileSysData *sysData, int64_t newPosition)
+{
+    uint32_t pageIndex = sysData->lruTail;
+    ReadPage *page = &sysData->readPages[pageIndex];
+    uint32_t *hashLink;
+
+    if (page->position >= 0) {
+        hashLink = &sysData->hashTable[hash_page_position(sysData, page->position)];
+        while (*hashLink != pageIndex)
+            hashLink = &sysData->readPages[*hashLink].hashNext;
+        *hashLink = page->hashNext;
+    }
+
+    page->position = newPosition;
+    page->size     = 0;
+    hashLink = &sysData->hashTable[hash_page_position(sysData, newPosition)];
+    page->hashNext = *hashLink;
+    *hashLink = pageIndex;
+
+    lru_touch(sysData, pageIndex);
+
+    return pageIndex;
+}
+
+static void drop_read_page(MXFFileSysData *sysData, uint32_t pageIndex)
+{
+    ReadPage *page = &sysData->readPages[pageIndex];
+    uint32_t *hashLink;
+
+    hashLink = &sysData->hashTable[hash_page_position(sysData, page->position)];
+    while (*hashLink != pageIndex)
+        hashLink = &sysData->readPages[*hashLink].hashNext;
+    *hashLink = page->hashNext;
+
+    page->position = -1;
+    page->size     = 0;
+    page->hashNext = NO_PAGE;
+
+    /* the page is re-used first */
+    if (sysData->lruTail != pageIndex) {
+        lru_unlink(sysData, pageIndex);
+        page->lruPrev = sysData->lruTail;
+        page->lruNext = NO_PAGE;
+        sysData->readPages[sysData->lruTail].lruNext = pageIndex;
+        sysData->lruTail = pageIndex;
+    }
+}
+
+static int load_read_pages(MXFFileSysData *sysData, int64_t pagePosition, uint32_t numPages)
+{
+    unsigned char *loadData;
+    uint32_t pageIndex;
+    uint32_t numRead;
+    uint32_t pageSize;
+    uint32_t i;
+
+    if (sysData->targetPosition != pagePosition) {
+        CHK_ORET(mxf_file_seek(sysData->target, pagePosition, SEEK_SET));
+        sysData->targetPosition = pagePosition;
+    }
+
+    /* a single page is read into the cache directly, multiple pages via the read ahead buffer */
+    if (numPages == 1) {
+        pageIndex = evict_read_page(sysData, pagePosition);
+        loadData = &sysData->cacheData[pageIndex * sysData->pageSize];
+    } else {
+        pageIndex = NO_PAGE;
+        loadData = sysData->readAheadData;
+    }
+
+    numRead = mxf_file_read(sysData->target, loadData, numPages * sysData->pageSize);
+    sysData->targetPosition += numRead;
+    sysData->nextLoadPosition = pagePosition + numRead;
+
+    if (pageIndex != NO_PAGE) {
+        sysData->readPages[pageIndex].size = numRead;
+    } else {
+        for (i = 0; i < numPages && i * sysData->pageSize < numRead; i++) {
+            pageSize = numRead - i * sysData->pageSize;
+            if (pageSize > sysData->pageSize)
+                pageSize = sysData->pageSize;
+            pageIndex = find_read_page(sysData, pagePosition + (int64_t)i * sysData->pageSize);
+            if (pageIndex != NO_PAGE) {
+                lru_touch(sysData, pageIndex);
+                /* a partially filled last page is updated if the file has grown */
+                if (sysData->readPages[pageIndex].size >= pageSize)
+                    continue;
+            } else {
+                pageIndex = evict_read_page(sysData, pagePosition + (int64_t)i * sysData->pageSize);
+            }
+            memcpy(&sysData->cacheData[pageIndex * sysData->pageSize], &loadData[i * sysData->pageSize], pageSize);
+            sysData->readPages[pageIndex].size = pageSize;
+        }
+    }
+
+    return numRead > 0;
+}
+
+static uint64_t cache_file_read_only_64(MXFFileSysData *sysData, uint8_t *data, uint64_t count)
+{
+    int64_t pagePosition;
+    uint32_t pageOffset;
+    uint32_t pageIndex;
+    uint32_t numRead;
+    uint32_t numPages;
+    uint64_t remCount = count;
+    uint64_t directCount;
+    int loaded = 0;
+
+    while (remCount > 0) {
+        pagePosition = sysData->position - sysData->position % sysData->pageSize;
+        pageOffset   = (uint32_t)(sysData->position - pagePosition);
+
+        pageIndex = find_read_page(sysData, pagePosition);
+        if (pageIndex != NO_PAGE) {
+            if (pageOffset + remCount > sysData->readPages[pageIndex].size &&
+                sysData->readPages[pageIndex].size < sysData->pageSize &&
+                mxf_file_size(sysData->target) > pagePosition + sysData->readPages[pageIndex].size)
+            {
+                /* the file has grown since the partially filled last page was loaded */
+                drop_read_page(sysData, pageIndex);
+                continue;
+            }
+            if (!loaded)
+                sysData->numHits++;
+            loaded = 0;
+            lru_touch(sysData, pageIndex);
+            if (pageOffset >= sysData->readPages[pageIndex].size)
+                break; /* positioned beyond end of file */
+
+            numRead = sysData->readPages[pageIndex].size - pageOffset;
+            if (numRead > remCount)
+                numRead = (uint32_t)remCount;
+            memcpy(&data[count - remCount], &sysData->cacheData[pageIndex * sysData->pageSize + pageOffset], numRead);
+            remCount -= numRead;
+            sysData->position += numRead;
+            continue;
+        }
+
+        sysData->numMisses++;
+
+        /* large page aligned reads, e.g. essence data, bypass the cache to avoid evicting the pages that are
+           re-used, e.g. header metadata and index table segments */
+        if (pageOffset == 0 && remCount >= (uint64_t)sysData->readAheadPages * sysData->pageSize) {
+            directCount = remCount - remCount % sysData->pageSize;
+            if (sysData->targetPosition != sysData->position) {
+                CHK_ORET(mxf_file_seek(sysData->target, sysData->position, SEEK_SET));
+                sysData->targetPosition = sysData->position;
+            }
+            directCount = mxf_file_read_64(sysData->target, &data[count - remCount], directCount);
+            sysData->targetPosition += directCount;
+            sysData->nextLoadPosition = sysData->targetPosition;
+            remCount -= directCount;
+            sysData->position += directCount;
+            if (directCount == 0 || directCount % sysData->pageSize != 0)
+                break;
+            continue;
+        }
+
+        /* read ahead if the miss continues from the previous load */
+        if (pagePosition == sysData->nextLoadPosition)
+            numPages = sysData->readAheadPages;
+        else
+            numPages = (uint32_t)((pageOffset + remCount + sysData->pageSize - 1) / sysData->pageSize);
+        if (numPages > sysData->readAheadPages)
+            numPages = sysData->readAheadPages;
+
+        if (!load_read_pages(sysData, pagePosition, numPages))
+            break;
+        loaded = 1;
+    }
+
+    sysData->eof = (count > 0 && remCount > 0);
+
+    return count - remCount;
+}
+
+static uint64_t cache_file_read_only_write_64(MXFFileSysData *sysData, const uint8_t *data, uint64_t count)
+{
+    (void)sysData;
+    (void)data;
+    (void)count;
+    return 0;
+}
+
+static uint32_t cache_file_read_only(MXFFileSysData *sysData, uint8_t *data, uint32_t count)
+{
+    return (uint32_t)cache_file_read_only_64(sysData, data, count);
+}
+
+static uint32_t cache_file_read_only_write(MXFFileSysData *sysData, const uint8_t *data, uint32_t count)
+{
+    (void)sysData;
+    (void)data;
+    (void)count;
+    return 0;
+}
+
+static int cache_file_read_only_getchar(MXFFileSysData *sysData)
+{
+    uint8_t data;
+    if (cache_file_read_only(sysData, &data, 1) != 1)
+        return EOF;
+
+    return data;
+}
+
+static int cache_file_read_only_putchar(MXFFileSysData *sysData, int c)
+{
+    (void)sysData;
+    (void)c;
+    return EOF;
+}
+
+static int cache_file_read_only_seek(MXFFileSysData *sysData, int64_t offset, int whence)
+{
+    int64_t newPosition;
+
+    switch (whence)
+    {
+        case SEEK_SET:
+            newPosition = offset;
+            break;
+        case SEEK_CUR:
+            newPosition = sysData->position + offset;
+            break;
+        case SEEK_END:
+            newPosition = mxf_file_size(sysData->target) + offset;
+            break;
+        default:
+            return 0;
+    }
+    if (newPosition < 0)
+        return 0;
+
+    /* the target file is positioned when the data is loaded */
+    sysData->eof      = 0;
+    sysData->position = newPosition;
+
+    return 1;
+}
+
 static void free_cache_file(MXFFileSysData *sysData)
 {
     free(sysData);
@@ -447,6 +780,8 @@ int mxf_cache_file_open(MXFFile *target, uint32_t in_cachePageSize, uint32_t cac
     newMXFFile->tell          = cache_file_tell;
     newMXFFile->is_seekable   = cache_file_is_seekable;
     newMXFFile->size          = cache_file_size;
+    newMXFFile->read_64       = cache_file_read_64;
+    newMXFFile->write_64      = cache_file_write_64;
     newMXFFile->free_sys_data = free_cache_file;
     newMXFFile->sysData       = newDiskFile;
     newMXFFile->minLLen       = target->minLLen;
@@ -464,6 +799,110 @@ fail:
     return 0;
 }
 
+int mxf_cache_file_open_read(MXFFile *target, uint32_t in_cachePageSize, uint32_t numPages, uint32_t readAheadPages,
+                             MXFCacheFile **cacheFile)
+{
+    MXFFile *newMXFFile = NULL;
+    MXFFileSysData *newCacheFile = NULL;
+    uint32_t sysPageSize;
+    uint32_t cachePageSize = in_cachePageSize;
+    uint32_t hashSize;
+    uint32_t i;
+
+    sysPageSize = mxf_get_system_page_size();
+    CHK_ORET(sysPageSize > 0);
+
+    if (cachePageSize == 0) {
+        cachePageSize = MXF_CACHE_FILE_DEFAULT_READ_PAGE_SIZE;
+    } else if (cachePageSize % sysPageSize != 0) {
+        cachePageSize = (cachePageSize + sysPageSize - 1) & ~(sysPageSize - 1);
+        mxf_log_warn("MXF cache file page size %u is not a multiple of page size %u. "
+                     "Changed cache page size to %u\n",
+                     in_cachePageSize, sysPageSize, cachePageSize);
+    }
+    if (numPages == 0)
+        numPages = MXF_CACHE_FILE_DEFAULT_READ_NUM_PAGES;
+    if (readAheadPages == 0)
+        readAheadPages = 1;
+    if (readAheadPages > numPages)
+        readAheadPages = numPages;
+
+    CHK_ORET(numPages < UINT32_MAX / cachePageSize); /* required to prevent overflows in calculations */
+
+    hashSize = 1;
+    while (hashSize < numPages * 2)
+        hashSize <<= 1;
+
+    CHK_MALLOC_ORET(newMXFFile, MXFFile);
+    memset(newMXFFile, 0, sizeof(MXFFile));
+    CHK_MALLOC_OFAIL(newCacheFile, MXFFileSysData);
+    memset(newCacheFile, 0, sizeof(MXFFileSysData));
+    CHK_MALLOC_ARRAY_OFAIL(newCacheFile->allocCacheData, unsigned char, numPages * cachePageSize + sysPageSize);
+    CHK_MALLOC_ARRAY_OFAIL(newCacheFile->readPages, ReadPage, numPages);
+    CHK_MALLOC_ARRAY_OFAIL(newCacheFile->hashTable, uint32_t, hashSize);
+    if (readAheadPages > 1)
+        CHK_MALLOC_ARRAY_OFAIL(newCacheFile->readAheadData, unsigned char, readAheadPages * cachePageSize);
+
+    for (i = 0; i < hashSize; i++)
+        newCacheFile->hashTable[i] = NO_PAGE;
+    for (i = 0; i < numPages; i++) {
+        newCacheFile->readPages[i].position = -1;
+        newCacheFile->readPages[i].size     = 0;
+        newCacheFile->readPages[i].lruPrev  = (i == 0 ? NO_PAGE : i - 1);
+        newCacheFile->readPages[i].lruNext  = (i == numPages - 1 ? NO_PAGE : i + 1);
+        newCacheFile->readPages[i].hashNext = NO_PAGE;
+    }
+
+    newCacheFile->target           = target;
+    newCacheFile->readOnly         = 1;
+    newCacheFile->cacheData        = (unsigned char*)(((uintptr_t)newCacheFile->allocCacheData + sysPageSize - 1) &
+                                                        ~(uintptr_t)(sysPageSize - 1));
+    newCacheFile->cacheSize        = numPages * cachePageSize;
+    newCacheFile->numPages         = numPages;
+    newCacheFile->pageSize         = cachePageSize;
+    newCacheFile->hashMask         = hashSize - 1;
+    newCacheFile->lruHead          = 0;
+    newCacheFile->lruTail          = numPages - 1;
+    newCacheFile->readAheadPages   = readAheadPages;
+    newCacheFile->nextLoadPosition = -1;
+    newCacheFile->position         = mxf_file_tell(target);
+    newCacheFile->targetPosition   = newCacheFile->position;
+
+    newCacheFile->cacheFile.mxfFile = newMXFFile;
+
+    newMXFFile->close         = cache_file_close;
+    newMXFFile->read          = cache_file_read_only;
+    newMXFFile->write         = cache_file_read_only_write;
+    newMXFFile->get_char      = cache_file_read_only_getchar;
+    newMXFFile->put_char      = cache_file_read_only_putchar;
+    newMXFFile->eof           = cache_file_eof;
+    newMXFFile->seek          = cache_file_read_only_seek;
+    newMXFFile->tell          = cache_file_tell;
+    newMXFFile->is_seekable   = cache_file_is_seekable;
+    newMXFFile->size          = cache_file_size;
+    newMXFFile->read_64       = cache_file_read_only_64;
+    newMXFFile->write_64      = cache_file_read_only_write_64;
+    newMXFFile->free_sys_data = free_cache_file;
+    newMXFFile->sysData       = newCacheFile;
+    newMXFFile->minLLen       = target->minLLen;
+    newMXFFile->runinLen      = target->runinLen;
+
+
+    *cacheFile = &newCacheFile->cacheFile;
+    return 1;
+
+fail:
+    if (newCacheFile) {
+        SAFE_FREE(newCacheFile->allocCacheData);
+        SAFE_FREE(newCacheFile->readPages);
+        SAFE_FREE(newCacheFile->hashTable);
+        SAFE_FREE(newCacheFile->readAheadData);
+    }
+    SAFE_FREE(newCacheFile);
+    SAFE_FREE(newMXFFile);
+    return 0;
+}
+
 MXFFile* mxf_cache_file_get_file(MXFCacheFile *cacheFile)
 {
     return cacheFile->mxfFile;
@@ -474,6 +913,12 @@ uint32_t mxf_cache_file_get_dirty_count(MXFCacheFile *cacheFile)
     return cacheFile->mxfFile->sysData->dirtyCount;
 }
 
+void mxf_cache_file_get_stats(MXFCacheFile *cacheFile, int64_t *numHits, int64_t *numMisses)
+{
+    *numHits   = cacheFile->mxfFile->sysData->numHits;
+    *numMisses = cacheFile->mxfFile->sysData->numMisses;
+}
+
 uint32_t mxf_cache_file_flush(MXFCacheFile *cacheFile, uint32_t minSize)
 {
     MXFFileSysData *sysData = cacheFile->mxfFile->sysData;
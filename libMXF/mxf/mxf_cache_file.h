@@ -45,14 +45,30 @@ extern "C"
 typedef struct MXFCacheFile MXFCacheFile;
 
 
+/* default page size and number of pages used when the values passed to mxf_cache_file_open_read are 0 */
+#define MXF_CACHE_FILE_DEFAULT_READ_PAGE_SIZE   (64 * 1024)
+#define MXF_CACHE_FILE_DEFAULT_READ_NUM_PAGES   256
+
+
 
 int mxf_cache_file_open(MXFFile *target, uint32_t cachePageSize, uint32_t cacheSize, MXFCacheFile **cacheFile);
 
+/* open a read-only cache of numPages pages that are evicted in least-recently-used order.
+   A miss that continues from the previously loaded pages loads readAheadPages pages in one read and
+   page aligned reads of at least readAheadPages pages bypass the cache.
+   A partially filled last page is reloaded if the target file has grown when it is read again */
+int mxf_cache_file_open_read(MXFFile *target, uint32_t cachePageSize, uint32_t numPages, uint32_t readAheadPages,
+                             MXFCacheFile **cacheFile);
+
 MXFFile* mxf_cache_file_get_file(MXFCacheFile *cacheFile);
 
 
 uint32_t mxf_cache_file_get_dirty_count(MXFCacheFile *cacheFile);
 
+/* page hit and miss counts for a cache opened using mxf_cache_file_open_read. They are also logged at
+   debug level when the file is closed */
+void mxf_cache_file_get_stats(MXFCacheFile *cacheFile, int64_t *numHits, int64_t *numMisses);
+
 uint32_t mxf_cache_file_flush(MXFCacheFile *cacheFile, uint32_t minSize);
 
 
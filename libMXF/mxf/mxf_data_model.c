@@ -36,6 +36,7 @@
 #endif
 
 #include <stdlib.h>
+#include <stddef.h>
 #include <string.h>
 #include <stdio.h>
 
@@ -115,6 +116,194 @@ static int item_def_eq(void *data, void *info)
     return mxf_equals_key((mxfKey*)info, &((MXFItemDef*)data)->key);
 }
 
+
+
+#define DEF_INDEX_MIN_SIZE      64
+
+#define DEF_INDEX_KEY(index, def)   ((const mxfKey*)((const uint8_t*)(def) + (index)->keyOffset))
+
+static uint32_t hash_def_key(const mxfKey *key)
+{
+    const uint8_t *bytes = (const uint8_t*)key;
+    uint32_t hash = 2166136261U;
+    size_t i;
+
+    for (i = 0; i < sizeof(mxfKey); i++) {
+        hash ^= bytes[i];
+        hash *= 16777619U;
+    }
+
+    return hash;
+}
+
+static void clear_def_index(MXFDefIndex *index)
+{
+    SAFE_FREE(index->entries);
+    index->size = 0;
+    index->used = 0;
+}
+
+/* the first def registered with a key is kept, matching a search of the registration order.
+   Returns 0 if the def was not inserted because another def with the same key is already present */
+static int insert_def_index_entry(MXFDefIndex *index, void *def)
+{
+    size_t mask = index->size - 1;
+    size_t pos = hash_def_key(DEF_INDEX_KEY(index, def)) & mask;
+
+    while (index->entries[pos]) {
+        if (mxf_equals_key(DEF_INDEX_KEY(index, index->entries[pos]), DEF_INDEX_KEY(index, def)))
+            return 0;
+        pos = (pos + 1) & mask;
+    }
+
+    index->entries[pos] = def;
+    index->used++;
+
+    return 1;
+}
+
+static int create_def_index(MXFDefIndex *index, size_t keyOffset, size_t minCount)
+{
+    size_t size = DEF_INDEX_MIN_SIZE;
+
+    clear_def_index(index);
+
+    while (size < minCount * 2)
+        size *= 2;
+
+    CHK_ORET((index->entries = (void**)calloc(size, sizeof(void*))) != NULL);
+    index->size = size;
+    index->keyOffset = keyOffset;
+
+    return 1;
+}
+
+static int add_def_index_entry(MXFDefIndex *index, void *def)
+{
+    if (index->size == 0)
+        return 1; /* index is created when the data model is finalised */
+
+    if ((index->used + 1) * 4 > index->size * 3) {
+        MXFDefIndex newIndex;
+        size_t i;
+
+        memset(&newIndex, 0, sizeof(newIndex));
+        CHK_ORET(create_def_index(&newIndex, index->keyOffset, index->used + 1));
+        for (i = 0; i < index->size; i++) {
+            if (index->entries[i])
+                insert_def_index_entry(&newIndex, index->entries[i]);
+        }
+        clear_def_index(index);
+        *index = newIndex;
+    }
+
+    insert_def_index_entry(index, def);
+
+    return 1;
+}
+
+static void* find_def_index_entry(const MXFDefIndex *index, const mxfKey *key)
+{
+    size_t mask = index->size - 1;
+    size_t pos = hash_def_key(key) & mask;
+
+    while (index->entries[pos]) {
+        if (mxf_equals_key(DEF_INDEX_KEY(index, index->entries[pos]), key))
+            return index->entries[pos];
+        pos = (pos + 1) & mask;
+    }
+
+    return NULL;
+}
+
+static int count_set_def(void *nodeData, void *processData)
+{
+    (void)nodeData;
+
+    (*(size_t*)processData)++;
+    return 1;
+}
+
+static int index_set_def(void *nodeData, void *processData)
+{
+    MXFSetDef *setDef = (MXFSetDef*)nodeData;
+    MXFDataModel *dataModel = (MXFDataModel*)processData;
+
+    /* a duplicate set def is left without an id and mxf_is_subclass_of_2 walks its parent set defs instead */
+    if (insert_def_index_entry(&dataModel->setDefIndex, setDef))
+        setDef->id = (unsigned int)dataModel->setDefIndex.used;
+    else
+        setDef->id = 0;
+
+    return 1;
+}
+
+static int set_ancestor_bits(void *nodeData, void *processData)
+{
+    MXFSetDef *setDef = (MXFSetDef*)nodeData;
+    MXFDataModel *dataModel = (MXFDataModel*)processData;
+    size_t bitsSize = (dataModel->setDefIndex.used + 1 + 31) / 32;
+    uint32_t *bits;
+    MXFSetDef *ancestorSetDef = setDef;
+
+    if (setDef->id == 0) {
+        setDef->ancestorBits = NULL;
+        return 1;
+    }
+    bits = &dataModel->ancestorBits[(setDef->id - 1) * bitsSize];
+
+    /* stop at a set def that is its own parent, as mxf_is_subclass_of_2 does, or if a cycle is found */
+    while (ancestorSetDef) {
+        /* use the indexed set def in place of a duplicate, which has no id */
+        if (ancestorSetDef->id == 0)
+            ancestorSetDef = (MXFSetDef*)find_def_index_entry(&dataModel->setDefIndex, &ancestorSetDef->key);
+        if (bits[ancestorSetDef->id >> 5] & (1U << (ancestorSetDef->id & 31)))
+            break;
+
+        bits[ancestorSetDef->id >> 5] |= 1U << (ancestorSetDef->id & 31);
+        if (mxf_equals_key(&ancestorSetDef->key, &ancestorSetDef->parentSetDefKey))
+            break;
+        ancestorSetDef = ancestorSetDef->parentSetDef;
+    }
+    setDef->ancestorBits = bits;
+
+    return 1;
+}
+
+static int index_data_model(MXFDataModel *dataModel)
+{
+    MXFListIterator iter;
+    size_t setDefCount = 0;
+    size_t bitsSize;
+
+    CHK_ORET(mxf_tree_traverse(&dataModel->setDefs, count_set_def, &setDefCount));
+
+    /* assign dense set def ids in key order */
+    CHK_ORET(create_def_index(&dataModel->setDefIndex, offsetof(MXFSetDef, key), setDefCount));
+    CHK_ORET(mxf_tree_traverse(&dataModel->setDefs, index_set_def, dataModel));
+
+    SAFE_FREE(dataModel->ancestorBits);
+    bitsSize = (dataModel->setDefIndex.used + 1 + 31) / 32;
+    if (dataModel->setDefIndex.used > 0) {
+        CHK_ORET((dataModel->ancestorBits = (uint32_t*)calloc(dataModel->setDefIndex.used * bitsSize,
+                                                              sizeof(uint32_t))) != NULL);
+        CHK_ORET(mxf_tree_traverse(&dataModel->setDefs, set_ancestor_bits, dataModel));
+    }
+
+    CHK_ORET(create_def_index(&dataModel->itemDefIndex, offsetof(MXFItemDef, key),
+                              mxf_get_list_length(&dataModel->itemDefs)));
+    mxf_initialise_list_iter(&iter, &dataModel->itemDefs);
+    while (mxf_next_list_iter_element(&iter))
+        insert_def_index_entry(&dataModel->itemDefIndex, mxf_get_iter_element(&iter));
+
+    return 1;
+}
+
+static int is_ancestor_set_def(const MXFSetDef *setDef, const MXFSetDef *ancestorSetDef)
+{
+    return (setDef->ancestorBits[ancestorSetDef->id >> 5] >> (ancestorSetDef->id & 31)) & 1;
+}
+
 static unsigned int get_new_type_id(MXFDataModel *dataModel)
 {
     size_t i;
@@ -166,6 +355,11 @@ static MXFSetDef* register_set_def(MXFDataModel *dataModel, const char *name, co
     mxf_initialise_list(&newSetDef->itemDefs, NULL);
 
     CHK_OFAIL(mxf_tree_insert(&dataModel->setDefs, newSetDef));
+    if (!add_def_index_entry(&dataModel->setDefIndex, newSetDef)) {
+        /* the tree owns the set def */
+        mxf_tree_remove(&dataModel->setDefs, newSetDef);
+        return NULL;
+    }
 
     return newSetDef;
 
@@ -190,6 +384,7 @@ static MXFItemDef* register_item_def(MXFDataModel *dataModel, const char *name,
     newItemDef->isRequired = isRequired;
 
     CHK_OFAIL(mxf_append_list_element(&dataModel->itemDefs, newItemDef));
+    CHK_ORET(add_def_index_entry(&dataModel->itemDefIndex, newItemDef)); /* the list owns the item def */
 
     return newItemDef;
 
@@ -375,6 +570,9 @@ void mxf_free_data_model(MXFDataModel **dataModel)
 
     mxf_tree_clear(&(*dataModel)->setDefs);
     mxf_clear_list(&(*dataModel)->itemDefs);
+    clear_def_index(&(*dataModel)->setDefIndex);
+    clear_def_index(&(*dataModel)->itemDefIndex);
+    SAFE_FREE((*dataModel)->ancestorBits);
 
     for (i = 0; i < ARRAY_SIZE((*dataModel)->types); i++)
         clear_type(&(*dataModel)->types[i]);
@@ -482,6 +680,9 @@ int mxf_finalise_data_model(MXFDataModel *dataModel)
         CHK_ORET(mxf_append_list_element(&setDef->itemDefs, (void*)itemDef));
     }
 
+    /* assign set def ids and ancestor bitsets and create the key lookup tables */
+    CHK_ORET(index_data_model(dataModel));
+
     return 1;
 }
 
@@ -550,8 +751,12 @@ int mxf_find_set_def(MXFDataModel *dataModel, const mxfKey *key, MXFSetDef **set
     MXFSetDef *result;
     MXFSetDef setDefKey;
 
-    setDefKey.key = *key;
-    result = mxf_tree_find(&dataModel->setDefs, &setDefKey);
+    if (dataModel->setDefIndex.size > 0) {
+        result = (MXFSetDef*)find_def_index_entry(&dataModel->setDefIndex, key);
+    } else {
+        setDefKey.key = *key;
+        result = mxf_tree_find(&dataModel->setDefs, &setDefKey);
+    }
     if (!result)
         return 0;
 
@@ -561,7 +766,12 @@ int mxf_find_set_def(MXFDataModel *dataModel, const mxfKey *key, MXFSetDef **set
 
 int mxf_find_item_def(MXFDataModel *dataModel, const mxfKey *key, MXFItemDef **itemDef)
 {
-    void *result = mxf_find_list_element(&dataModel->itemDefs, (void*)key, item_def_eq);
+    void *result;
+
+    if (dataModel->itemDefIndex.size > 0)
+        result = find_def_index_entry(&dataModel->itemDefIndex, key);
+    else
+        result = mxf_find_list_element(&dataModel->itemDefs, (void*)key, item_def_eq);
     if (!result)
         return 0;
 
@@ -605,9 +815,19 @@ int mxf_is_subclass_of(MXFDataModel *dataModel, const mxfKey *setKey, const mxfK
 
 int mxf_is_subclass_of_2(MXFDataModel *dataModel, MXFSetDef *setDef, const mxfKey *parentSetKey)
 {
+    MXFSetDef *parentSetDef;
+
     if (mxf_equals_key(&setDef->key, parentSetKey))
         return 1;
 
+    /* set defs registered after the data model was finalised have no id and walk the parent set defs */
+    if (setDef->id != 0) {
+        if (!mxf_find_set_def(dataModel, parentSetKey, &parentSetDef))
+            return 0;
+        if (parentSetDef->id != 0)
+            return is_ancestor_set_def(setDef, parentSetDef);
+    }
+
     if (!setDef->parentSetDef || mxf_equals_key(&setDef->key, &setDef->parentSetDefKey))
         return 0;
 
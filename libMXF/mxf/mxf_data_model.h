@@ -114,14 +114,31 @@ typedef struct MXFSetDef
     mxfKey key;
     MXFList itemDefs;
     struct MXFSetDef *parentSetDef;
+    /* dense id assigned by mxf_finalise_data_model (0 if registered later) and the bitset of ids of this
+       set def and its ancestors */
+    unsigned int id;
+    const uint32_t *ancestorBits;
 } MXFSetDef;
 
+/* open-addressing hash table of set or item defs keyed by the def key */
+typedef struct
+{
+    void **entries;
+    size_t size;
+    size_t used;
+    size_t keyOffset;
+} MXFDefIndex;
+
 typedef struct
 {
     MXFList itemDefs;
     MXFTree setDefs;
     MXFItemType types[128]; /* index 0 is not used */
     unsigned int lastTypeId;
+    /* lookup tables created by mxf_finalise_data_model and kept up to date by later registrations */
+    MXFDefIndex setDefIndex;
+    MXFDefIndex itemDefIndex;
+    uint32_t *ancestorBits;
 } MXFDataModel;
 
 
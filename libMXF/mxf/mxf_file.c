@@ -45,6 +45,9 @@
 #if defined(_WIN32)
 #include <io.h>
 #include <fcntl.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
 #endif
 
 #include <mxf/mxf.h>
@@ -64,6 +67,9 @@
 #define MAX_ZEROS_BUFFER_SIZE   16384
 #define ZEROS_BUFFER_INCREMENT  2048
 
+/* size of the aligned staging buffer used for direct I/O */
+#define DIRECT_BUFFER_SIZE      (8 * 1024 * 1024)
+
 
 typedef enum
 {
@@ -72,11 +78,30 @@ typedef enum
     MODIFY_MODE,
 } OpenMode;
 
+typedef struct
+{
+    int fd;
+    uint32_t alignment;
+
+    uint8_t *buffer;        /* aligned staging buffer */
+    uint32_t bufferSize;
+    int64_t bufferOffset;   /* aligned file offset of buffer */
+    uint32_t bufferLen;     /* number of aligned bytes loaded in buffer */
+    uint32_t dirtyStart;    /* range of bytes in buffer that need to be written */
+    uint32_t dirtyEnd;
+
+    int64_t position;
+    int64_t fileSize;       /* logical file size */
+    int64_t diskSize;       /* size of the file on disk; this includes the padding in the last block */
+    int isEOF;
+} DirectFile;
+
 struct MXFFileSysData
 {
     FILE *file;
     OpenMode mode;
     int isSeekable;
+    DirectFile *direct;
 };
 
 
@@ -117,24 +142,34 @@ static void disk_file_close(MXFFileSysData *sysData)
     sysData->file = NULL;
 }
 
-static uint32_t disk_file_read(MXFFileSysData *sysData, uint8_t *data, uint32_t count)
+static uint64_t disk_file_read_64(MXFFileSysData *sysData, uint8_t *data, uint64_t count)
 {
     char errorBuf[128];
-    uint32_t result = (uint32_t)fread(data, 1, count, sysData->file);
+    uint64_t result = fread(data, 1, (size_t)count, sysData->file);
     if (result != count && ferror(sysData->file))
         mxf_log_error("fread failed: %s\n", mxf_strerror(errno, errorBuf, sizeof(errorBuf)));
     return result;
 }
 
-static uint32_t disk_file_write(MXFFileSysData *sysData, const uint8_t *data, uint32_t count)
+static uint64_t disk_file_write_64(MXFFileSysData *sysData, const uint8_t *data, uint64_t count)
 {
     char errorBuf[128];
-    uint32_t result = (uint32_t)fwrite(data, 1, count, sysData->file);
+    uint64_t result = fwrite(data, 1, (size_t)count, sysData->file);
     if (result != count)
         mxf_log_error("fwrite failed: %s\n", mxf_strerror(errno, errorBuf, sizeof(errorBuf)));
     return result;
 }
 
+static uint32_t disk_file_read(MXFFileSysData *sysData, uint8_t *data, uint32_t count)
+{
+    return (uint32_t)disk_file_read_64(sysData, data, count);
+}
+
+static uint32_t disk_file_write(MXFFileSysData *sysData, const uint8_t *data, uint32_t count)
+{
+    return (uint32_t)disk_file_write_64(sysData, data, count);
+}
+
 static int disk_file_getchar(MXFFileSysData *sysData)
 {
     return fgetc(sysData->file);
@@ -231,6 +266,8 @@ static int disk_file_open(FILE *file, OpenMode mode, MXFFile **mxfFile)
     newMXFFile->tell          = disk_file_tell;
     newMXFFile->is_seekable   = disk_file_is_seekable;
     newMXFFile->size          = disk_file_size;
+    newMXFFile->read_64       = disk_file_read_64;
+    newMXFFile->write_64      = disk_file_write_64;
     newMXFFile->free_sys_data = free_disk_file;
     newMXFFile->sysData       = newDiskFile;
 
@@ -254,6 +291,283 @@ fail:
 }
 
 
+
+#if !defined(_WIN32)
+
+static int direct_file_flush(DirectFile *direct)
+{
+    char errorBuf[128];
+    uint32_t start, end;
+    ssize_t result;
+
+    if (direct->dirtyEnd <= direct->dirtyStart)
+        return 1;
+
+    /* writes must start and end on the alignment boundaries. The last block may extend
+       beyond the logical file size and the file is truncated to the logical size when closed */
+    start = direct->dirtyStart - (direct->dirtyStart % direct->alignment);
+    end = direct->dirtyEnd;
+    if (end % direct->alignment)
+        end += direct->alignment - (end % direct->alignment);
+
+    while (start < end) {
+        result = pwrite(direct->fd, &direct->buffer[start], end - start, (off_t)(direct->bufferOffset + start));
+        if (result < 0) {
+            if (errno == EINTR)
+                continue;
+            mxf_log_error("Direct I/O pwrite failed: %s\n", mxf_strerror(errno, errorBuf, sizeof(errorBuf)));
+            return 0;
+        }
+        /* a write of nothing would repeat forever and a short write that is not aligned
+           would leave the remainder at an offset that O_DIRECT rejects */
+        if (result == 0 || ((uint32_t)result < end - start && (uint32_t)result % direct->alignment != 0)) {
+            mxf_log_error("Direct I/O pwrite wrote %u of %u bytes\n", (uint32_t)result, end - start);
+            return 0;
+        }
+        start += (uint32_t)result;
+    }
+
+    if (direct->bufferOffset + end > direct->diskSize)
+        direct->diskSize = direct->bufferOffset + end;
+    direct->dirtyStart = 0;
+    direct->dirtyEnd = 0;
+
+    return 1;
+}
+
+static int direct_file_load(DirectFile *direct, uint32_t newLen)
+{
+    char errorBuf[128];
+    uint32_t readEnd;
+    uint32_t pos;
+    ssize_t result;
+
+    /* existing data on disk is read in (aligned) and the remainder is zero filled */
+    readEnd = newLen;
+    if (direct->bufferOffset + readEnd > direct->diskSize) {
+        if (direct->diskSize > direct->bufferOffset + direct->bufferLen)
+            readEnd = (uint32_t)(direct->diskSize - direct->bufferOffset);
+        else
+            readEnd = direct->bufferLen;
+    }
+
+    pos = direct->bufferLen;
+    while (pos < readEnd) {
+        result = pread(direct->fd, &direct->buffer[pos], readEnd - pos, (off_t)(direct->bufferOffset + pos));
+        if (result < 0) {
+            if (errno == EINTR)
+                continue;
+            mxf_log_error("Direct I/O pread failed: %s\n", mxf_strerror(errno, errorBuf, sizeof(errorBuf)));
+            return 0;
+        }
+        if (result == 0)
+            break;
+        pos += (uint32_t)result;
+    }
+    if (pos < newLen)
+        memset(&direct->buffer[pos], 0, newLen - pos);
+
+    direct->bufferLen = newLen;
+
+    return 1;
+}
+
+static uint32_t direct_file_prepare(DirectFile *direct, uint32_t count)
+{
+    uint32_t cursor;
+    uint32_t avail;
+    uint32_t newLen;
+
+    /* move the buffer if the position is outside its range or if it would leave a gap */
+    if (direct->position < direct->bufferOffset ||
+        direct->position >= direct->bufferOffset + direct->bufferSize ||
+        direct->position > direct->bufferOffset + direct->bufferLen)
+    {
+        if (!direct_file_flush(direct))
+            return 0;
+        direct->bufferOffset = direct->position - (direct->position % direct->alignment);
+        direct->bufferLen = 0;
+    }
+
+    cursor = (uint32_t)(direct->position - direct->bufferOffset);
+    avail = direct->bufferSize - cursor;
+    if (avail > count)
+        avail = count;
+
+    if (cursor + avail > direct->bufferLen) {
+        newLen = cursor + avail;
+        if (newLen % direct->alignment)
+            newLen += direct->alignment - (newLen % direct->alignment);
+        if (!direct_file_load(direct, newLen))
+            return 0;
+    }
+
+    return avail;
+}
+
+static int direct_file_close_checked(MXFFileSysData *sysData)
+{
+    DirectFile *direct = sysData->direct;
+    char errorBuf[128];
+    int result = 1;
+
+    if (direct->fd < 0)
+        return 1;
+
+    if (!direct_file_flush(direct)) {
+        mxf_log_error("Failed to write buffered data when closing direct I/O file\n");
+        result = 0;
+    }
+    if (direct->diskSize > direct->fileSize && ftruncate(direct->fd, (off_t)direct->fileSize) != 0) {
+        mxf_log_error("Direct I/O ftruncate failed: %s\n", mxf_strerror(errno, errorBuf, sizeof(errorBuf)));
+        result = 0;
+    }
+    if (close(direct->fd) != 0) {
+        mxf_log_error("Direct I/O close failed: %s\n", mxf_strerror(errno, errorBuf, sizeof(errorBuf)));
+        result = 0;
+    }
+    direct->fd = -1;
+
+    return result;
+}
+
+static void direct_file_close(MXFFileSysData *sysData)
+{
+    direct_file_close_checked(sysData);
+}
+
+static uint32_t direct_file_read(MXFFileSysData *sysData, uint8_t *data, uint32_t count)
+{
+    DirectFile *direct = sysData->direct;
+    uint32_t totalRead = 0;
+    uint32_t numRead;
+
+    while (totalRead < count) {
+        if (direct->position >= direct->fileSize) {
+            direct->isEOF = 1;
+            break;
+        }
+
+        numRead = count - totalRead;
+        if (numRead > direct->fileSize - direct->position)
+            numRead = (uint32_t)(direct->fileSize - direct->position);
+        numRead = direct_file_prepare(direct, numRead);
+        if (numRead == 0)
+            break;
+
+        memcpy(&data[totalRead], &direct->buffer[direct->position - direct->bufferOffset], numRead);
+        totalRead += numRead;
+        direct->position += numRead;
+    }
+
+    return totalRead;
+}
+
+static uint32_t direct_file_write(MXFFileSysData *sysData, const uint8_t *data, uint32_t count)
+{
+    DirectFile *direct = sysData->direct;
+    uint32_t totalWritten = 0;
+    uint32_t numWrite;
+    uint32_t cursor;
+
+    while (totalWritten < count) {
+        numWrite = direct_file_prepare(direct, count - totalWritten);
+        if (numWrite == 0)
+            break;
+
+        cursor = (uint32_t)(direct->position - direct->bufferOffset);
+        memcpy(&direct->buffer[cursor], &data[totalWritten], numWrite);
+        if (direct->dirtyEnd <= direct->dirtyStart) {
+            direct->dirtyStart = cursor;
+            direct->dirtyEnd   = cursor + numWrite;
+        } else {
+            if (cursor < direct->dirtyStart)
+                direct->dirtyStart = cursor;
+            if (cursor + numWrite > direct->dirtyEnd)
+                direct->dirtyEnd = cursor + numWrite;
+        }
+
+        totalWritten += numWrite;
+        direct->position += numWrite;
+        if (direct->position > direct->fileSize)
+            direct->fileSize = direct->position;
+    }
+
+    return totalWritten;
+}
+
+static int direct_file_getchar(MXFFileSysData *sysData)
+{
+    uint8_t c;
+    if (direct_file_read(sysData, &c, 1) != 1)
+        return EOF;
+
+    return c;
+}
+
+static int direct_file_putchar(MXFFileSysData *sysData, int c)
+{
+    uint8_t byte = (uint8_t)c;
+    if (direct_file_write(sysData, &byte, 1) != 1)
+        return EOF;
+
+    return c;
+}
+
+static int direct_file_eof(MXFFileSysData *sysData)
+{
+    return sysData->direct->isEOF;
+}
+
+static int direct_file_seek(MXFFileSysData *sysData, int64_t offset, int whence)
+{
+    DirectFile *direct = sysData->direct;
+    int64_t newPosition;
+
+    switch (whence)
+    {
+        case SEEK_SET:
+            newPosition = offset;
+            break;
+        case SEEK_CUR:
+            newPosition = direct->position + offset;
+            break;
+        case SEEK_END:
+            newPosition = direct->fileSize + offset;
+            break;
+        default:
+            return 0;
+    }
+    if (newPosition < 0)
+        return 0;
+
+    direct->position = newPosition;
+    direct->isEOF = 0;
+
+    return 1;
+}
+
+static int64_t direct_file_tell(MXFFileSysData *sysData)
+{
+    return sysData->direct->position;
+}
+
+static int64_t direct_file_size(MXFFileSysData *sysData)
+{
+    return sysData->direct->fileSize;
+}
+
+static void free_direct_file(MXFFileSysData *sysData)
+{
+    if (sysData->direct)
+        free(sysData->direct->buffer);
+    free(sysData->direct);
+    free(sysData);
+}
+
+#endif
+
+
 int mxf_disk_file_open_new(const char *filename, MXFFile **mxfFile)
 {
     FILE *file = fopen(filename, "w+b");
@@ -263,6 +577,90 @@ int mxf_disk_file_open_new(const char *filename, MXFFile **mxfFile)
     return disk_file_open(file, NEW_MODE, mxfFile);
 }
 
+int mxf_disk_file_open_new_direct(const char *filename, MXFFile **mxfFile)
+{
+#if defined(_WIN32)
+    (void)filename;
+    (void)mxfFile;
+    mxf_log_error("Direct I/O disk file is not supported on Windows\n");
+    return 0;
+#else
+    MXFFile *newMXFFile = NULL;
+    MXFFileSysData *newDiskFile = NULL;
+    DirectFile *newDirectFile = NULL;
+    char errorBuf[128];
+    void *buffer = NULL;
+    uint32_t alignment;
+    int fd = -1;
+
+#if defined(O_DIRECT)
+    fd = open(filename, O_RDWR | O_CREAT | O_TRUNC | O_DIRECT, 0666);
+    if (fd < 0 && errno == EINVAL) {
+        /* some file systems, e.g. tmpfs, don't support O_DIRECT */
+        mxf_log_warn("O_DIRECT is not supported for '%s'; falling back to buffered I/O\n", filename);
+        fd = open(filename, O_RDWR | O_CREAT | O_TRUNC, 0666);
+    }
+#else
+    fd = open(filename, O_RDWR | O_CREAT | O_TRUNC, 0666);
+#if defined(F_NOCACHE)
+    if (fd >= 0)
+        fcntl(fd, F_NOCACHE, 1);
+#endif
+#endif
+    if (fd < 0)
+        return 0;
+
+    /* the page size alignment satisfies the logical block size alignment required by O_DIRECT */
+    alignment = mxf_get_system_page_size();
+    if (posix_memalign(&buffer, alignment, DIRECT_BUFFER_SIZE) != 0) {
+        mxf_log_error("Failed to allocate aligned direct I/O buffer: %s\n",
+                      mxf_strerror(errno, errorBuf, sizeof(errorBuf)));
+        goto fail;
+    }
+
+    CHK_MALLOC_OFAIL(newMXFFile, MXFFile);
+    memset(newMXFFile, 0, sizeof(MXFFile));
+    CHK_MALLOC_OFAIL(newDiskFile, MXFFileSysData);
+    memset(newDiskFile, 0, sizeof(MXFFileSysData));
+    CHK_MALLOC_OFAIL(newDirectFile, DirectFile);
+    memset(newDirectFile, 0, sizeof(DirectFile));
+
+    newDirectFile->fd         = fd;
+    newDirectFile->alignment  = alignment;
+    newDirectFile->buffer     = (uint8_t*)buffer;
+    newDirectFile->bufferSize = DIRECT_BUFFER_SIZE - (DIRECT_BUFFER_SIZE % alignment);
+
+    newDiskFile->isSeekable = 1;
+    newDiskFile->mode       = NEW_MODE;
+    newDiskFile->direct     = newDirectFile;
+
+    newMXFFile->close         = direct_file_close;
+    newMXFFile->read          = direct_file_read;
+    newMXFFile->write         = direct_file_write;
+    newMXFFile->get_char      = direct_file_getchar;
+    newMXFFile->put_char      = direct_file_putchar;
+    newMXFFile->eof           = direct_file_eof;
+    newMXFFile->seek          = direct_file_seek;
+    newMXFFile->tell          = direct_file_tell;
+    newMXFFile->is_seekable   = disk_file_is_seekable;
+    newMXFFile->size          = direct_file_size;
+    newMXFFile->free_sys_data = free_direct_file;
+    newMXFFile->close_checked = direct_file_close_checked;
+    newMXFFile->sysData       = newDiskFile;
+
+    *mxfFile = newMXFFile;
+    return 1;
+
+fail:
+    close(fd);
+    free(buffer);
+    SAFE_FREE(newMXFFile);
+    SAFE_FREE(newDiskFile);
+    SAFE_FREE(newDirectFile);
+    return 0;
+#endif
+}
+
 int mxf_disk_file_open_read(const char *filename, MXFFile **mxfFile)
 {
     FILE *file = fopen(filename, "rb");
@@ -311,26 +709,43 @@ int mxf_stdout_wrap_write(MXFFile **mxfFile)
 }
 
 
-void mxf_file_close(MXFFile **mxfFile)
+static int close_file(MXFFile **mxfFile, void (*free_func)(void*))
 {
-    mxf_file_close_2(mxfFile, free);
-}
+    int result = 1;
 
-void mxf_file_close_2(MXFFile **mxfFile, void (*free_func)(void*))
-{
     if (!(*mxfFile))
-        return;
+        return 1;
 
     free((*mxfFile)->zerosBuffer);
 
     if ((*mxfFile)->sysData) {
-        (*mxfFile)->close((*mxfFile)->sysData);
+        if ((*mxfFile)->close_checked)
+            result = (*mxfFile)->close_checked((*mxfFile)->sysData);
+        else
+            (*mxfFile)->close((*mxfFile)->sysData);
         if ((*mxfFile)->free_sys_data)
             (*mxfFile)->free_sys_data((*mxfFile)->sysData);
     }
 
     free_func(*mxfFile);
     *mxfFile = NULL;
+
+    return result;
+}
+
+void mxf_file_close(MXFFile **mxfFile)
+{
+    close_file(mxfFile, free);
+}
+
+void mxf_file_close_2(MXFFile **mxfFile, void (*free_func)(void*))
+{
+    close_file(mxfFile, free_func);
+}
+
+int mxf_file_close_checked(MXFFile **mxfFile)
+{
+    return close_file(mxfFile, free);
 }
 
 uint32_t mxf_file_read(MXFFile *mxfFile, uint8_t *data, uint32_t count)
@@ -343,6 +758,52 @@ uint32_t mxf_file_write(MXFFile *mxfFile, const uint8_t *data, uint32_t count)
     return mxfFile->write(mxfFile->sysData, data, count);
 }
 
+uint64_t mxf_file_read_64(MXFFile *mxfFile, uint8_t *data, uint64_t count)
+{
+    uint64_t totalRead = 0;
+    uint32_t numRead;
+    uint32_t readCount;
+
+    if (mxfFile->read_64)
+        return mxfFile->read_64(mxfFile->sysData, data, count);
+
+    while (totalRead < count) {
+        if (count - totalRead > UINT32_MAX)
+            readCount = UINT32_MAX;
+        else
+            readCount = (uint32_t)(count - totalRead);
+        numRead = mxfFile->read(mxfFile->sysData, &data[totalRead], readCount);
+        totalRead += numRead;
+        if (numRead != readCount)
+            break;
+    }
+
+    return totalRead;
+}
+
+uint64_t mxf_file_write_64(MXFFile *mxfFile, const uint8_t *data, uint64_t count)
+{
+    uint64_t totalWrite = 0;
+    uint32_t numWrite;
+    uint32_t writeCount;
+
+    if (mxfFile->write_64)
+        return mxfFile->write_64(mxfFile->sysData, data, count);
+
+    while (totalWrite < count) {
+        if (count - totalWrite > UINT32_MAX)
+            writeCount = UINT32_MAX;
+        else
+            writeCount = (uint32_t)(count - totalWrite);
+        numWrite = mxfFile->write(mxfFile->sysData, &data[totalWrite], writeCount);
+        totalWrite += numWrite;
+        if (numWrite != writeCount)
+            break;
+    }
+
+    return totalWrite;
+}
+
 int mxf_file_getc(MXFFile *mxfFile)
 {
     return mxfFile->get_char(mxfFile->sysData);
@@ -676,6 +1137,15 @@ int mxf_write_kl(MXFFile *mxfFile, const mxfKey *key, uint64_t len)
 int mxf_write_fixed_l(MXFFile *mxfFile, uint8_t llen, uint64_t len)
 {
     uint8_t buffer[9];
+
+    CHK_ORET(mxf_encode_fixed_l(llen, len, buffer));
+    CHK_ORET(mxf_file_write(mxfFile, buffer, llen) == llen);
+
+    return 1;
+}
+
+int mxf_encode_fixed_l(uint8_t llen, uint64_t len, uint8_t *buffer)
+{
     uint8_t i;
 
     assert(llen > 0 && llen <= 9);
@@ -686,8 +1156,7 @@ int mxf_write_fixed_l(MXFFile *mxfFile, uint8_t llen, uint64_t len)
             return 0;
         }
 
-        if (mxf_file_putc(mxfFile, (int)len) != (int)len)
-            return 0;
+        buffer[0] = (uint8_t)len;
     } else {
         if (llen != 9 && (len >> ((llen - 1) * 8)) > 0) {
             mxf_log_error("Could not write BER length %" PRIu64 " for llen equal %u"
@@ -695,11 +1164,9 @@ int mxf_write_fixed_l(MXFFile *mxfFile, uint8_t llen, uint64_t len)
             return 0;
         }
 
+        buffer[0] = 0x80 + llen - 1;
         for (i = 0; i < llen - 1; i++)
-            buffer[llen - 1 - i - 1] = (uint8_t)((len >> (i * 8)) & 0xff);
-
-        CHK_ORET(mxf_file_putc(mxfFile, 0x80 + llen - 1) == 0x80 + llen - 1);
-        CHK_ORET(mxf_file_write(mxfFile, buffer, llen - 1) == (uint8_t)(llen - 1));
+            buffer[llen - 1 - i] = (uint8_t)((len >> (i * 8)) & 0xff);
     }
 
     return 1;
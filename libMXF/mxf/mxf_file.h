@@ -69,6 +69,16 @@ typedef struct
     uint16_t runinLen;
     uint8_t *zerosBuffer;
     uint32_t zerosBufferSize;
+
+    /* MXF file implementations can optionally set these functions to support reads and writes of more than 4GB
+       in one call. mxf_file_read_64 and mxf_file_write_64 use multiple read and write calls if these are not set.
+       These are placed at the end to keep the layout of the members above unchanged */
+    uint64_t    (*read_64)      (MXFFileSysData *sysData, uint8_t *data, uint64_t count);
+    uint64_t    (*write_64)     (MXFFileSysData *sysData, const uint8_t *data, uint64_t count);
+
+    /* MXF file implementations that write buffered data when closing can optionally set this function to
+       report whether that succeeded. It is called instead of close by the close functions if it is set */
+    int         (*close_checked)(MXFFileSysData *sysData);
 } MXFFile;
 
 
@@ -77,14 +87,22 @@ int mxf_disk_file_open_new(const char *filename, MXFFile **mxfFile);
 int mxf_disk_file_open_read(const char *filename, MXFFile **mxfFile);
 int mxf_disk_file_open_modify(const char *filename, MXFFile **mxfFile);
 
+/* open a new file on disk that is written using direct I/O (O_DIRECT), bypassing the page cache.
+   Writes are staged in an aligned buffer and seeking back to update the file is supported */
+int mxf_disk_file_open_new_direct(const char *filename, MXFFile **mxfFile);
+
 /* wrap standard input and output in an MXF file */
 int mxf_stdin_wrap_read(MXFFile **mxfFile);
 int mxf_stdout_wrap_write(MXFFile **mxfFile);
 
 void mxf_file_close(MXFFile **mxfFile);
 void mxf_file_close_2(MXFFile **mxfFile, void (*free_func)(void*));
+/* returns 0 if the file implementation failed to complete the file when closing, e.g. to write buffered data */
+int mxf_file_close_checked(MXFFile **mxfFile);
 uint32_t mxf_file_read(MXFFile *mxfFile, uint8_t *data, uint32_t count);
 uint32_t mxf_file_write(MXFFile *mxfFile, const uint8_t *data, uint32_t count);
+uint64_t mxf_file_read_64(MXFFile *mxfFile, uint8_t *data, uint64_t count);
+uint64_t mxf_file_write_64(MXFFile *mxfFile, const uint8_t *data, uint64_t count);
 int mxf_file_getc(MXFFile *mxfFile);
 int mxf_file_putc(MXFFile *mxfFile, int c);
 int mxf_file_eof(MXFFile *mxfFile);
@@ -134,6 +152,7 @@ int mxf_write_k(MXFFile *mxfFile, const mxfKey *key);
 uint8_t mxf_write_l(MXFFile *mxfFile, uint64_t len);
 int mxf_write_kl(MXFFile *mxfFile, const mxfKey *key, uint64_t len);
 int mxf_write_fixed_l(MXFFile *mxfFile, uint8_t llen, uint64_t len);
+int mxf_encode_fixed_l(uint8_t llen, uint64_t len, uint8_t *buffer);
 int mxf_write_fixed_kl(MXFFile *mxfFile, const mxfKey *key, uint8_t llen, uint64_t len);
 int mxf_write_ul(MXFFile *mxfFile, const mxfUL *label);
 int mxf_write_uid(MXFFile *mxfFile, const mxfUID *uid);
@@ -48,10 +48,47 @@
 
 static void free_metadata_item_value(MXFMetadataItem *item)
 {
-    SAFE_FREE(item->value);
+    if (item->value != item->inlineValue && !item->isArenaValue)
+    {
+        SAFE_FREE(item->value);
+    }
+    item->value = NULL;
+    item->isArenaValue = 0;
     item->length = 0;
 }
 
+static int alloc_metadata_item_value(MXFMetadataItem *item, uint16_t len)
+{
+    int isRealloc = 0;
+
+    if (item->value && item->length != len)
+    {
+        free_metadata_item_value(item);
+        isRealloc = 1;
+    }
+    if (!item->value)
+    {
+        if (len <= MXF_ITEM_INLINE_VALUE_SIZE)
+        {
+            item->value = item->inlineValue;
+        }
+        /* only the first value comes from the arena because arena memory is not re-used, e.g. when
+           an array item is grown one element at a time */
+        else if (item->arena && !isRealloc)
+        {
+            CHK_ORET((item->value = (uint8_t*)mxf_arena_alloc(item->arena, len)) != NULL);
+            item->isArenaValue = 1;
+        }
+        else
+        {
+            CHK_MALLOC_ARRAY_ORET(item->value, uint8_t, len);
+        }
+    }
+    item->length = len;
+
+    return 1;
+}
+
 static void free_metadata_set_in_list(void *data)
 {
     MXFMetadataSet *set;
@@ -78,25 +115,297 @@ static void free_metadata_item_in_list(void *data)
     mxf_free_item(&item);
 }
 
-static int set_eq_instanceuid(void *data, void *info)
+static int eq_pointer(void *data, void *info)
 {
     assert(data != NULL && info != NULL);
 
-    return mxf_equals_uuid((mxfUUID*)info, &((MXFMetadataSet*)data)->instanceUID);
+    return data == info;
+}
+
+#define SET_INDEX_MIN_SIZE      64
+
+
+/* marks a set index slot whose set was removed; probing continues past it */
+static MXFMetadataSet g_removedSetIndexEntry;
+
+
+static size_t hash_instance_uid(const mxfUUID *uuid)
+{
+    const uint8_t *bytes = (const uint8_t*)uuid;
+    uint32_t hash = 2166136261U;
+    int i;
+
+    for (i = 0; i < mxfUUID_extlen; i++)
+    {
+        hash ^= bytes[i];
+        hash *= 16777619U;
+    }
+
+    return hash;
 }
 
-static int item_eq_key(void *data, void *info)
+/* Note: removed slots are not re-used when inserting. This ensures sets with the same instanceUID are found
+   in the order they were added, matching the order in the sets list */
+static void insert_set_index_entry(MXFHeaderMetadata *headerMetadata, MXFMetadataSet *set)
 {
-    assert(data != NULL && info != NULL);
+    size_t mask = headerMetadata->setIndexSize - 1;
+    size_t i = hash_instance_uid(&set->instanceUID) & mask;
 
-    return mxf_equals_key((mxfKey*)info, &((MXFMetadataItem*)data)->key);
+    while (headerMetadata->setIndex[i] != NULL)
+    {
+        i = (i + 1) & mask;
+    }
+
+    headerMetadata->setIndex[i] = set;
+    headerMetadata->setIndexUsed++;
 }
 
-static int eq_pointer(void *data, void *info)
+static int rebuild_set_index(MXFHeaderMetadata *headerMetadata, size_t minCount)
 {
-    assert(data != NULL && info != NULL);
+    MXFMetadataSet **newSetIndex;
+    MXFListIterator iter;
+    size_t newSize;
 
-    return data == info;
+    newSize = SET_INDEX_MIN_SIZE;
+    while (newSize - newSize / 4 <= minCount)
+    {
+        newSize *= 2;
+    }
+
+    CHK_MALLOC_ARRAY_ORET(newSetIndex, MXFMetadataSet*, newSize);
+    memset(newSetIndex, 0, newSize * sizeof(MXFMetadataSet*));
+
+    SAFE_FREE(headerMetadata->setIndex);
+    headerMetadata->setIndex     = newSetIndex;
+    headerMetadata->setIndexSize = newSize;
+    headerMetadata->setIndexUsed = 0;
+
+    /* insert in list order */
+    mxf_initialise_list_iter(&iter, &headerMetadata->sets);
+    while (mxf_next_list_iter_element(&iter))
+    {
+        insert_set_index_entry(headerMetadata, (MXFMetadataSet*)mxf_get_iter_element(&iter));
+    }
+
+    return 1;
+}
+
+static int add_set_index_entry(MXFHeaderMetadata *headerMetadata, MXFMetadataSet *set)
+{
+    /* keep the load, including removed slots, below 3/4 */
+    if (headerMetadata->setIndexUsed + 1 >= headerMetadata->setIndexSize - headerMetadata->setIndexSize / 4)
+    {
+        /* the set has already been appended to the list and is inserted by the rebuild */
+        return rebuild_set_index(headerMetadata, mxf_get_list_length(&headerMetadata->sets) * 2);
+    }
+
+    insert_set_index_entry(headerMetadata, set);
+    return 1;
+}
+
+static void remove_set_index_entry(MXFHeaderMetadata *headerMetadata, MXFMetadataSet *set)
+{
+    size_t mask = headerMetadata->setIndexSize - 1;
+    size_t i;
+
+    if (headerMetadata->setIndex == NULL)
+    {
+        return;
+    }
+
+    i = hash_instance_uid(&set->instanceUID) & mask;
+    while (headerMetadata->setIndex[i] != NULL)
+    {
+        if (headerMetadata->setIndex[i] == set)
+        {
+            headerMetadata->setIndex[i] = &g_removedSetIndexEntry;
+            return;
+        }
+        i = (i + 1) & mask;
+    }
+}
+
+static MXFMetadataSet* find_set_index_entry(MXFHeaderMetadata *headerMetadata, const mxfUUID *uuid)
+{
+    size_t mask = headerMetadata->setIndexSize - 1;
+    size_t i;
+
+    if (headerMetadata->setIndex == NULL)
+    {
+        return NULL;
+    }
+
+    i = hash_instance_uid(uuid) & mask;
+    while (headerMetadata->setIndex[i] != NULL)
+    {
+        if (headerMetadata->setIndex[i] != &g_removedSetIndexEntry &&
+            mxf_equals_uuid(uuid, &headerMetadata->setIndex[i]->instanceUID))
+        {
+            return headerMetadata->setIndex[i];
+        }
+        i = (i + 1) & mask;
+    }
+
+    return NULL;
+}
+
+#define ITEM_INDEX_MIN_ITEMS    8
+#define ITEM_INDEX_MIN_SIZE     16
+
+
+/* marks an item index slot whose item was removed; probing continues past it */
+static MXFMetadataItem g_removedItemIndexEntry;
+
+
+static uint32_t hash_item_key(const mxfKey *key)
+{
+    const uint8_t *bytes = (const uint8_t*)key;
+    uint32_t hash = 2166136261U;
+    int i;
+
+    for (i = 0; i < mxfKey_extlen; i++)
+    {
+        hash ^= bytes[i];
+        hash *= 16777619U;
+    }
+
+    return hash;
+}
+
+/* Note: removed slots are not re-used when inserting. This ensures items with the same key are found
+   in the order they were added, matching the order in the items list */
+static void insert_item_index_entry(MXFMetadataSet *set, MXFMetadataItem *item)
+{
+    uint32_t mask = set->itemIndexSize - 1;
+    uint32_t i = hash_item_key(&item->key) & mask;
+
+    while (set->itemIndex[i] != NULL)
+    {
+        i = (i + 1) & mask;
+    }
+
+    set->itemIndex[i] = item;
+    set->itemIndexUsed++;
+}
+
+static int rebuild_item_index(MXFMetadataSet *set, size_t minCount)
+{
+    MXFMetadataItem **newItemIndex;
+    MXFListIterator iter;
+    uint32_t newSize;
+
+    newSize = ITEM_INDEX_MIN_SIZE;
+    while (newSize - newSize / 4 <= minCount)
+    {
+        newSize *= 2;
+    }
+
+    CHK_MALLOC_ARRAY_ORET(newItemIndex, MXFMetadataItem*, newSize);
+    memset(newItemIndex, 0, newSize * sizeof(MXFMetadataItem*));
+
+    SAFE_FREE(set->itemIndex);
+    set->itemIndex     = newItemIndex;
+    set->itemIndexSize = newSize;
+    set->itemIndexUsed = 0;
+
+    /* insert in list order */
+    mxf_initialise_list_iter(&iter, &set->items);
+    while (mxf_next_list_iter_element(&iter))
+    {
+        insert_item_index_entry(set, (MXFMetadataItem*)mxf_get_iter_element(&iter));
+    }
+
+    return 1;
+}
+
+/* Note: call this after the item has been appended to the items list */
+static int add_item_index_entry(MXFMetadataSet *set, MXFMetadataItem *item)
+{
+    size_t numItems;
+
+    if (set->itemIndex == NULL)
+    {
+        /* small sets are searched using the items list */
+        numItems = mxf_get_list_length(&set->items);
+        if (numItems < ITEM_INDEX_MIN_ITEMS)
+        {
+            return 1;
+        }
+        return rebuild_item_index(set, numItems * 2);
+    }
+
+    /* keep the load, including removed slots, below 3/4 */
+    if (set->itemIndexUsed + 1 >= set->itemIndexSize - set->itemIndexSize / 4)
+    {
+        return rebuild_item_index(set, mxf_get_list_length(&set->items) * 2);
+    }
+
+    insert_item_index_entry(set, item);
+    return 1;
+}
+
+static void remove_item_index_entry(MXFMetadataSet *set, MXFMetadataItem *item)
+{
+    uint32_t mask = set->itemIndexSize - 1;
+    uint32_t i;
+
+    if (set->itemIndex == NULL)
+    {
+        return;
+    }
+
+    i = hash_item_key(&item->key) & mask;
+    while (set->itemIndex[i] != NULL)
+    {
+        if (set->itemIndex[i] == item)
+        {
+            set->itemIndex[i] = &g_removedItemIndexEntry;
+            return;
+        }
+        i = (i + 1) & mask;
+    }
+}
+
+static MXFMetadataItem* find_item(MXFMetadataSet *set, const mxfKey *key)
+{
+    MXFListIterator iter;
+    MXFMetadataItem *item;
+    uint32_t mask;
+    uint32_t i;
+
+    if (set->encodedItems && !mxf_decode_set_items(set))
+    {
+        return NULL;
+    }
+
+    if (set->itemIndex == NULL)
+    {
+        mxf_initialise_list_iter(&iter, &set->items);
+        while (mxf_next_list_iter_element(&iter))
+        {
+            item = (MXFMetadataItem*)mxf_get_iter_element(&iter);
+            if (mxf_equals_key(key, &item->key))
+            {
+                return item;
+            }
+        }
+
+        return NULL;
+    }
+
+    mask = set->itemIndexSize - 1;
+    i = hash_item_key(key) & mask;
+    while (set->itemIndex[i] != NULL)
+    {
+        if (set->itemIndex[i] != &g_removedItemIndexEntry &&
+            mxf_equals_key(key, &set->itemIndex[i]->key))
+        {
+            return set->itemIndex[i];
+        }
+        i = (i + 1) & mask;
+    }
+
+    return NULL;
 }
 
 static int get_or_create_set_item(MXFHeaderMetadata *headerMetadata, MXFMetadataSet *set,
@@ -125,12 +434,32 @@ static int get_or_create_set_item(MXFHeaderMetadata *headerMetadata, MXFMetadata
     return 1;
 }
 
-static int create_empty_set(const mxfKey *key, MXFMetadataSet **set)
+static int get_arena(MXFHeaderMetadata *headerMetadata, MXFArena **arena)
+{
+    if (headerMetadata->arena == NULL)
+    {
+        CHK_ORET(mxf_create_arena(&headerMetadata->arena, MXF_ARENA_DEFAULT_BLOCK_SIZE));
+    }
+
+    *arena = headerMetadata->arena;
+    return 1;
+}
+
+static int create_empty_set(const mxfKey *key, MXFArena *arena, MXFMetadataSet **set)
 {
     MXFMetadataSet *newSet;
 
-    CHK_MALLOC_ORET(newSet, MXFMetadataSet);
-    memset(newSet, 0, sizeof(MXFMetadataSet));
+    if (arena)
+    {
+        CHK_ORET((newSet = (MXFMetadataSet*)mxf_arena_alloc(arena, sizeof(MXFMetadataSet))) != NULL);
+        memset(newSet, 0, sizeof(MXFMetadataSet));
+        newSet->arena = mxf_ref_arena(arena);
+    }
+    else
+    {
+        CHK_MALLOC_ORET(newSet, MXFMetadataSet);
+        memset(newSet, 0, sizeof(MXFMetadataSet));
+    }
     newSet->key = *key;
     newSet->instanceUID = g_Null_UUID;
     mxf_initialise_list(&newSet->items, free_metadata_item_in_list);
@@ -139,10 +468,73 @@ static int create_empty_set(const mxfKey *key, MXFMetadataSet **set)
     return 1;
 }
 
+/* read the set bytes and only decode the InstanceUID. The items are decoded by mxf_decode_set_items */
+static int read_encoded_set(MXFFile *mxfFile, const mxfKey *key, uint64_t len, MXFHeaderMetadata *headerMetadata,
+                            MXFMetadataSet **set)
+{
+    MXFMetadataSet *newSet;
+    MXFArena *arena;
+    uint8_t *data;
+    mxfLocalTag instanceUIDTag;
+    int haveInstanceUIDTag;
+    int haveInstanceUID = 0;
+    mxfUUID instanceUID;
+    mxfLocalTag itemTag;
+    uint16_t itemLen;
+    uint32_t pos = 0;
+
+    CHK_ORET(len <= UINT32_MAX);
+    CHK_ORET(get_arena(headerMetadata, &arena));
+    CHK_ORET((data = (uint8_t*)mxf_arena_alloc(arena, (size_t)len)) != NULL);
+    CHK_ORET(mxf_file_read(mxfFile, data, (uint32_t)len) == len);
+
+    haveInstanceUIDTag = mxf_get_item_tag(headerMetadata->primerPack, &MXF_ITEM_K(InterchangeObject, InstanceUID),
+                                          &instanceUIDTag);
+    while (pos + 4 <= len)
+    {
+        mxf_get_uint16(&data[pos], &itemTag);
+        mxf_get_uint16(&data[pos + 2], &itemLen);
+        pos += 4;
+        if (pos + itemLen > len)
+        {
+            break;
+        }
+
+        if (haveInstanceUIDTag && itemTag == instanceUIDTag && itemLen == mxfUUID_extlen)
+        {
+            mxf_get_uuid(&data[pos], &instanceUID);
+            haveInstanceUID = 1;
+        }
+        pos += itemLen;
+    }
+
+    if (pos != len)
+    {
+        mxf_log_error("Incorrect metadata set length encountered" LOG_LOC_FORMAT, LOG_LOC_PARAMS);
+        return 0;
+    }
+    if (!haveInstanceUID)
+    {
+        mxf_log_error("Metadata set does not have InstanceUID item" LOG_LOC_FORMAT, LOG_LOC_PARAMS);
+        return 0;
+    }
+
+    CHK_ORET(create_empty_set(key, arena, &newSet));
+    newSet->instanceUID           = instanceUID;
+    newSet->encodedItems          = data;
+    newSet->encodedItemsLen       = (uint32_t)len;
+    newSet->encodedHeaderMetadata = headerMetadata;
+
+    *set = newSet;
+    return 1;
+}
+
 static int add_item(MXFMetadataSet *set, MXFMetadataItem *item)
 {
     MXFMetadataItem *removedItem;
 
+    CHK_ORET(mxf_decode_set_items(set));
+
     /* if item already attached to set, then removed it first */
     if (item->set != NULL)
     {
@@ -151,6 +543,13 @@ static int add_item(MXFMetadataSet *set, MXFMetadataItem *item)
 
     CHK_ORET(mxf_append_list_element(&set->items, (void*)item));
     item->set = set;
+    if (!add_item_index_entry(set, item))
+    {
+        mxf_remove_list_element(&set->items, (void*)item, eq_pointer);
+        item->set = NULL;
+        return 0;
+    }
+    set->itemsRevision++;
 
     return 1;
 }
@@ -397,6 +796,7 @@ int mxf_create_header_metadata(MXFHeaderMetadata **headerMetadata, MXFDataModel
     memset(newHeaderMetadata, 0, sizeof(MXFHeaderMetadata));
     newHeaderMetadata->dataModel = dataModel;
     mxf_initialise_list(&newHeaderMetadata->sets, free_metadata_set_in_list);
+    CHK_OFAIL(rebuild_set_index(newHeaderMetadata, 0));
     CHK_OFAIL(mxf_create_primer_pack(&newHeaderMetadata->primerPack));
 
     *headerMetadata = newHeaderMetadata;
@@ -407,12 +807,13 @@ fail:
     return 0;
 }
 
-int mxf_create_set(MXFHeaderMetadata *headerMetadata, const mxfKey *key, MXFMetadataSet **set)
+static int create_set(MXFHeaderMetadata *headerMetadata, const mxfKey *key, MXFArena *arena,
+                      MXFMetadataSet **set)
 {
     MXFMetadataSet *newSet;
     mxfUUID uuid;
 
-    CHK_ORET(create_empty_set(key, &newSet));
+    CHK_ORET(create_empty_set(key, arena, &newSet));
 
     mxf_generate_uuid(&uuid);
     newSet->instanceUID = uuid;
@@ -429,12 +830,27 @@ fail:
     return 0;
 }
 
+int mxf_create_set(MXFHeaderMetadata *headerMetadata, const mxfKey *key, MXFMetadataSet **set)
+{
+    return create_set(headerMetadata, key, NULL, set);
+}
+
 int mxf_create_item(MXFMetadataSet *set, const mxfKey *key, mxfLocalTag tag, MXFMetadataItem **item)
 {
     MXFMetadataItem *newItem;
 
-    CHK_MALLOC_ORET(newItem, MXFMetadataItem);
-    memset(newItem, 0, sizeof(MXFMetadataItem));
+    /* items in a set allocated from an arena are allocated from the same arena */
+    if (set->arena)
+    {
+        CHK_ORET((newItem = (MXFMetadataItem*)mxf_arena_alloc(set->arena, sizeof(MXFMetadataItem))) != NULL);
+        memset(newItem, 0, sizeof(MXFMetadataItem));
+        newItem->arena = mxf_ref_arena(set->arena);
+    }
+    else
+    {
+        CHK_MALLOC_ORET(newItem, MXFMetadataItem);
+        memset(newItem, 0, sizeof(MXFMetadataItem));
+    }
     newItem->tag = tag;
     newItem->isPersistent = 0;
     newItem->key = *key;
@@ -457,30 +873,60 @@ void mxf_free_header_metadata(MXFHeaderMetadata **headerMetadata)
     }
 
     mxf_clear_list(&(*headerMetadata)->sets);
+    SAFE_FREE((*headerMetadata)->setIndex);
+    SAFE_FREE((*headerMetadata)->writeBuffer);
     mxf_free_primer_pack(&(*headerMetadata)->primerPack);
+    mxf_unref_arena(&(*headerMetadata)->arena);
     SAFE_FREE(*headerMetadata);
 }
 
 void mxf_free_set(MXFMetadataSet **set)
 {
+    MXFArena *arena;
+
     if (*set == NULL)
     {
         return;
     }
 
     mxf_clear_list(&(*set)->items);
-    SAFE_FREE(*set);
+    SAFE_FREE((*set)->itemIndex);
+
+    /* the set memory is released with the arena */
+    arena = (*set)->arena;
+    if (arena)
+    {
+        *set = NULL;
+        mxf_unref_arena(&arena);
+    }
+    else
+    {
+        SAFE_FREE(*set);
+    }
 }
 
 void mxf_free_item(MXFMetadataItem **item)
 {
+    MXFArena *arena;
+
     if (*item == NULL)
     {
         return;
     }
 
     free_metadata_item_value(*item);
-    SAFE_FREE(*item);
+
+    /* the item memory is released with the arena */
+    arena = (*item)->arena;
+    if (arena)
+    {
+        *item = NULL;
+        mxf_unref_arena(&arena);
+    }
+    else
+    {
+        SAFE_FREE(*item);
+    }
 }
 
 
@@ -499,6 +945,11 @@ int mxf_add_set(MXFHeaderMetadata *headerMetadata, MXFMetadataSet *set)
 
     CHK_ORET(mxf_append_list_element(&headerMetadata->sets, (void*)set));
     set->headerMetadata = headerMetadata;
+    if (!add_set_index_entry(headerMetadata, set))
+    {
+        mxf_remove_set(headerMetadata, set);
+        return 0;
+    }
 
     return 1;
 }
@@ -509,6 +960,83 @@ void mxf_set_fixed_set_space_allocation(MXFMetadataSet *set, uint64_t size)
     set->fixedSpaceAllocation = size;
 }
 
+void mxf_set_lazy_header_metadata_read(MXFHeaderMetadata *headerMetadata, int enable)
+{
+    headerMetadata->lazyRead = enable;
+}
+
+int mxf_decode_set_items(MXFMetadataSet *set)
+{
+    MXFHeaderMetadata *headerMetadata = set->encodedHeaderMetadata;
+    uint8_t *data = (uint8_t*)set->encodedItems;
+    uint32_t len = set->encodedItemsLen;
+    MXFSetDef *setDef;
+    MXFItemDef *itemDef;
+    MXFMetadataItem *newItem;
+    mxfKey itemKey;
+    mxfLocalTag itemTag;
+    uint16_t itemLen;
+    uint32_t pos = 0;
+
+    if (data == NULL)
+    {
+        return 1;
+    }
+
+    /* reset first because creating items below requires the set to be decoded. The encoded items are
+       restored if decoding fails so that it can be tried again */
+    set->encodedItems          = NULL;
+    set->encodedItemsLen       = 0;
+    set->encodedHeaderMetadata = NULL;
+
+    CHK_OFAIL(mxf_find_set_def(headerMetadata->dataModel, &set->key, &setDef));
+
+    /* the item lengths were checked when the set was read */
+    while (pos < len)
+    {
+        mxf_get_uint16(&data[pos], &itemTag);
+        mxf_get_uint16(&data[pos + 2], &itemLen);
+        pos += 4;
+
+        /* check the item tag is registered in the primer */
+        if (mxf_get_item_key(headerMetadata->primerPack, itemTag, &itemKey))
+        {
+            /* only decode items with known definition */
+            if (mxf_find_item_def_in_set_def(&itemKey, setDef, &itemDef))
+            {
+                CHK_OFAIL(mxf_create_item(set, &itemKey, itemTag, &newItem));
+                newItem->isPersistent = 1;
+                /* the value references the set bytes in the arena, which the item holds a reference to */
+                newItem->value        = &data[pos];
+                newItem->length       = itemLen;
+                newItem->isArenaValue = 1;
+            }
+        }
+        else
+        {
+            mxf_log_warn("Encountered item with tag %d not registered in the primer"
+                         LOG_LOC_FORMAT, itemTag, LOG_LOC_PARAMS);
+        }
+
+        pos += itemLen;
+    }
+
+    return 1;
+
+fail:
+    /* the set had no items before decoding and so only the partially decoded items are removed */
+    mxf_clear_list(&set->items);
+    SAFE_FREE(set->itemIndex);
+    set->itemIndexSize = 0;
+    set->itemIndexUsed = 0;
+    set->itemsRevision++;
+
+    set->encodedItems          = data;
+    set->encodedItemsLen       = len;
+    set->encodedHeaderMetadata = headerMetadata;
+    return 0;
+}
+
 
 int mxf_register_item(MXFHeaderMetadata *headerMetadata, const mxfKey *key)
 {
@@ -554,8 +1082,12 @@ int mxf_remove_set(MXFHeaderMetadata *headerMetadata, MXFMetadataSet *set)
 {
     void *result;
 
+    /* decode whilst the primer pack used to read the set is still available */
+    CHK_ORET(mxf_decode_set_items(set));
+
     if ((result = mxf_remove_list_element(&headerMetadata->sets, (void*)set, eq_pointer)) != NULL)
     {
+        remove_set_index_entry(headerMetadata, set);
         set->headerMetadata = NULL;
         return 1;
     }
@@ -565,12 +1097,15 @@ int mxf_remove_set(MXFHeaderMetadata *headerMetadata, MXFMetadataSet *set)
 
 int mxf_remove_item(MXFMetadataSet *set, const mxfKey *itemKey, MXFMetadataItem **item)
 {
-    void *result;
+    MXFMetadataItem *result;
 
-    if ((result = mxf_remove_list_element(&set->items, (void*)itemKey, item_eq_key)) != NULL)
+    if ((result = find_item(set, itemKey)) != NULL)
     {
-        *item = (MXFMetadataItem*)result;
-        (*item)->set = NULL;
+        mxf_remove_list_element(&set->items, (void*)result, eq_pointer);
+        remove_item_index_entry(set, result);
+        set->itemsRevision++;
+        result->set = NULL;
+        *item = result;
         return 1;
     }
 
@@ -630,11 +1165,11 @@ fail:
 
 int mxf_get_item(MXFMetadataSet *set, const mxfKey *key, MXFMetadataItem **resultItem)
 {
-    void *result;
+    MXFMetadataItem *result;
 
-    if ((result = mxf_find_list_element(&set->items, (void*)key, item_eq_key)) != NULL)
+    if ((result = find_item(set, key)) != NULL)
     {
-        *resultItem = (MXFMetadataItem*)result;
+        *resultItem = result;
         return 1;
     }
 
@@ -643,8 +1178,7 @@ int mxf_get_item(MXFMetadataSet *set, const mxfKey *key, MXFMetadataItem **resul
 
 int mxf_have_item(MXFMetadataSet *set, const mxfKey *key)
 {
-    MXFMetadataItem *item;
-    return mxf_get_item(set, key, &item);
+    return find_item(set, key) != NULL;
 }
 
 
@@ -683,11 +1217,14 @@ int mxf_clone_set(MXFMetadataSet *fromSet, MXFHeaderMetadata *toHeaderMetadata,
     uint8_t *fromUUIDElement;
     uint32_t fromUUIDElementLen;
     MXFListIterator fromSetsIter;
+    MXFArena *arena;
 
+    CHK_ORET(mxf_decode_set_items(fromSet));
     CHK_ORET(mxf_find_set_def(fromSet->headerMetadata->dataModel, &fromSet->key, &fromSetDef));
     CHK_ORET(mxf_clone_set_def(fromSet->headerMetadata->dataModel, fromSetDef,
                                toHeaderMetadata->dataModel, &toSetDef));
-    CHK_ORET(mxf_create_set(toHeaderMetadata, &fromSet->key, &clonedSet));
+    CHK_ORET(get_arena(toHeaderMetadata, &arena));
+    CHK_ORET(create_set(toHeaderMetadata, &fromSet->key, arena, &clonedSet));
 
     mxf_initialise_list_iter(&fromSetsIter, &fromSet->headerMetadata->sets);
 
@@ -764,6 +1301,7 @@ int mxf_read_filtered_header_metadata(MXFFile *mxfFile, MXFReadFilter *filter,
     MXFMetadataSet *newSet = NULL;
     uint64_t count = 0;
     int result;
+    MXFListIterator setsIter;
 
     CHK_ORET(headerByteCount != 0);
 
@@ -773,6 +1311,13 @@ int mxf_read_filtered_header_metadata(MXFFile *mxfFile, MXFReadFilter *filter,
 
     if (headerMetadata->primerPack != NULL)
     {
+        /* lazily read sets must be decoded with the primer pack they were read with */
+        mxf_initialise_list_iter(&setsIter, &headerMetadata->sets);
+        while (mxf_next_list_iter_element(&setsIter))
+        {
+            CHK_ORET(mxf_decode_set_items((MXFMetadataSet*)mxf_get_iter_element(&setsIter)));
+        }
+
         mxf_free_primer_pack(&headerMetadata->primerPack);
     }
     CHK_ORET(mxf_read_primer_pack(mxfFile, &headerMetadata->primerPack));
@@ -861,13 +1406,27 @@ int mxf_read_and_return_set(MXFFile *mxfFile, const mxfKey *key, uint64_t len,
     mxfKey itemKey;
     MXFItemDef *itemDef = NULL;
     MXFMetadataItem *newItem;
+    MXFArena *arena;
 
     assert(headerMetadata->primerPack != NULL);
 
     /* only read sets with known definitions */
     if (mxf_find_set_def(headerMetadata->dataModel, key, &setDef))
     {
-        CHK_ORET(create_empty_set(key, &newSet));
+        if (headerMetadata->lazyRead)
+        {
+            CHK_ORET(read_encoded_set(mxfFile, key, len, headerMetadata, &newSet));
+            if (addToHeaderMetadata)
+            {
+                CHK_OFAIL(mxf_add_set(headerMetadata, newSet));
+            }
+
+            *set = newSet;
+            return 1;
+        }
+
+        CHK_ORET(get_arena(headerMetadata, &arena));
+        CHK_ORET(create_empty_set(key, arena, &newSet));
 
         /* read each item in the set*/
         haveInstanceUID = 0;
@@ -948,61 +1507,129 @@ int mxf_read_item_tl(MXFFile *mxfFile, mxfLocalTag *itemTag, uint16_t *itemLen)
 
 int mxf_read_item(MXFFile *mxfFile, MXFMetadataItem *item, uint16_t len)
 {
-    uint8_t buffer[65536];
+    CHK_ORET(alloc_metadata_item_value(item, len));
+    CHK_ORET(mxf_file_read(mxfFile, item->value, len) == len);
 
-    CHK_ORET(mxf_file_read(mxfFile, buffer, len) == len);
+    return 1;
+}
 
-    CHK_MALLOC_ARRAY_ORET(item->value, uint8_t, len);
-    memcpy(item->value, buffer, len);
-    item->length = len;
+#define WRITE_BUFFER_MIN_SIZE   4096
+
+typedef struct
+{
+    uint8_t *data;
+    size_t size;
+    size_t allocSize;
+} WriteBuffer;
+
+static void init_write_buffer(WriteBuffer *buffer, MXFHeaderMetadata *headerMetadata)
+{
+    if (headerMetadata)
+    {
+        buffer->data = headerMetadata->writeBuffer;
+        buffer->allocSize = headerMetadata->writeBufferSize;
+    }
+    else
+    {
+        buffer->data = NULL;
+        buffer->allocSize = 0;
+    }
+    buffer->size = 0;
+}
+
+static void release_write_buffer(WriteBuffer *buffer, MXFHeaderMetadata *headerMetadata)
+{
+    if (headerMetadata)
+    {
+        /* keep the buffer for when the header metadata is re-written */
+        headerMetadata->writeBuffer = buffer->data;
+        headerMetadata->writeBufferSize = buffer->allocSize;
+    }
+    else
+    {
+        SAFE_FREE(buffer->data);
+    }
+}
+
+static int extend_write_buffer(WriteBuffer *buffer, size_t size, uint8_t **bytes)
+{
+    if (buffer->size + size > buffer->allocSize)
+    {
+        size_t newAllocSize = (buffer->allocSize > 0 ? buffer->allocSize : WRITE_BUFFER_MIN_SIZE);
+        uint8_t *newData;
+
+        while (newAllocSize < buffer->size + size)
+        {
+            newAllocSize *= 2;
+        }
+        CHK_ORET((newData = (uint8_t*)realloc(buffer->data, newAllocSize)) != NULL);
+        buffer->data = newData;
+        buffer->allocSize = newAllocSize;
+    }
+
+    *bytes = &buffer->data[buffer->size];
+    buffer->size += size;
 
     return 1;
 }
 
-int mxf_write_header_metadata(MXFFile *mxfFile, MXFHeaderMetadata *headerMetadata)
+static int flush_write_buffer(MXFFile *mxfFile, WriteBuffer *buffer)
 {
-    CHK_ORET(mxf_write_header_primer_pack(mxfFile, headerMetadata));
-    CHK_ORET(mxf_write_header_sets(mxfFile, headerMetadata));
+    CHK_ORET(buffer->size <= UINT32_MAX);
+    CHK_ORET(mxf_file_write(mxfFile, buffer->data, (uint32_t)buffer->size) == (uint32_t)buffer->size);
 
     return 1;
 }
 
-int mxf_write_header_primer_pack(MXFFile *mxfFile, MXFHeaderMetadata *headerMetadata)
+static int serialise_kl(WriteBuffer *buffer, const mxfKey *key, uint8_t llen, uint64_t len)
 {
-    CHK_ORET(mxf_write_primer_pack(mxfFile, headerMetadata->primerPack));
+    uint8_t *bytes;
+
+    CHK_ORET(extend_write_buffer(buffer, mxfKey_extlen + llen, &bytes));
+    memcpy(bytes, key, mxfKey_extlen);
+    CHK_ORET(mxf_encode_fixed_l(llen, len, &bytes[mxfKey_extlen]));
 
     return 1;
 }
 
-int mxf_write_header_sets(MXFFile *mxfFile, MXFHeaderMetadata *headerMetadata)
+/* note: keep in sync with mxf_write_primer_pack */
+static int serialise_primer_pack(MXFFile *mxfFile, MXFPrimerPack *primerPack, WriteBuffer *buffer)
 {
     MXFListIterator iter;
-    MXFMetadataSet *prefaceSet;
+    uint32_t numberOfItems = (uint32_t)mxf_get_list_length(&primerPack->entries);
+    uint64_t len = 8 + 18 * (uint64_t)numberOfItems;
+    uint8_t *bytes;
 
-    /* must write the Preface set first (and there must be a Preface set) */
-    CHK_ORET(mxf_find_singular_set_by_key(headerMetadata, &MXF_SET_K(Preface), &prefaceSet));
-    CHK_ORET(mxf_write_set(mxfFile, prefaceSet));
+    CHK_ORET(serialise_kl(buffer, &g_PrimerPack_key, mxf_get_llen(mxfFile, len), len));
+    CHK_ORET(extend_write_buffer(buffer, (size_t)len, &bytes));
 
-    mxf_initialise_list_iter(&iter, &headerMetadata->sets);
+    mxf_set_uint32(numberOfItems, bytes);
+    mxf_set_uint32(18, &bytes[4]);
+    bytes += 8;
+
+    mxf_initialise_list_iter(&iter, &primerPack->entries);
     while (mxf_next_list_iter_element(&iter))
     {
-        MXFMetadataSet *set = (MXFMetadataSet*)mxf_get_iter_element(&iter);
+        MXFPrimerPackEntry *entry = (MXFPrimerPackEntry*)mxf_get_iter_element(&iter);
 
-        if (!mxf_equals_key(&set->key, &MXF_SET_K(Preface)))
-        {
-            CHK_ORET(mxf_write_set(mxfFile, set));
-        }
+        mxf_set_uint16(entry->localTag, bytes);
+        memcpy(&bytes[2], &entry->uid, 16);
+        bytes += 18;
     }
 
     return 1;
 }
 
-/* note: keep in sync with mxf_get_set_len */
-int mxf_write_set(MXFFile *mxfFile, MXFMetadataSet *set)
+/* note: keep in sync with mxf_get_set_size and mxf_allocate_space */
+static int serialise_set(MXFFile *mxfFile, MXFMetadataSet *set, WriteBuffer *buffer)
 {
     MXFListIterator iter;
     uint64_t setLen = 0;
-    uint64_t setSize = 0;
+    uint64_t setSize;
+    uint8_t llen;
+    uint8_t *bytes;
+
+    CHK_ORET(mxf_decode_set_items(set));
 
     mxf_initialise_list_iter(&iter, &set->items);
     while (mxf_next_list_iter_element(&iter))
@@ -1010,41 +1637,140 @@ int mxf_write_set(MXFFile *mxfFile, MXFMetadataSet *set)
         setLen += ((MXFMetadataItem*)mxf_get_iter_element(&iter))->length + 4;
     }
 
-    if (mxf_get_llen(mxfFile, setLen) <= 4)
+    /* spec says preferred 4-byte BER encoded len for sets */
+    llen = mxf_get_llen(mxfFile, setLen);
+    if (llen < 4)
     {
-        /* spec says preferred 4-byte BER encoded len for sets */
-        CHK_ORET(mxf_write_fixed_kl(mxfFile, &set->key, 4, setLen));
-        setSize = mxfKey_extlen + 4 + setLen;
+        llen = 4;
     }
-    else
+    setSize = mxfKey_extlen + llen + setLen;
+
+    if (set->fixedSpaceAllocation > 0)
     {
-        CHK_ORET(mxf_write_kl(mxfFile, &set->key, setLen));
-        setSize = mxfKey_extlen + mxf_get_llen(mxfFile, setLen) + setLen;
+        /* check that we can achieve the fixed size, possibly using a filler */
+        CHK_ORET(setSize == set->fixedSpaceAllocation ||
+                 (setSize < set->fixedSpaceAllocation &&
+                     setSize + mxf_get_min_llen(mxfFile) + mxfKey_extlen <= set->fixedSpaceAllocation));
     }
 
+    CHK_ORET(serialise_kl(buffer, &set->key, llen, setLen));
+    CHK_ORET(extend_write_buffer(buffer, (size_t)setLen, &bytes));
+
     mxf_initialise_list_iter(&iter, &set->items);
     while (mxf_next_list_iter_element(&iter))
     {
-        CHK_ORET(mxf_write_item(mxfFile, (MXFMetadataItem*)mxf_get_iter_element(&iter)));
+        MXFMetadataItem *item = (MXFMetadataItem*)mxf_get_iter_element(&iter);
+
+        mxf_set_uint16(item->tag, bytes);
+        mxf_set_uint16(item->length, &bytes[2]);
+        memcpy(&bytes[4], item->value, item->length);
+        bytes += 4 + item->length;
+        item->isPersistent = 1;
     }
 
-    if (set->fixedSpaceAllocation > 0)
+    if (setSize < set->fixedSpaceAllocation)
     {
-        /* check that we can achieve the fixed size, possibly using a filler */
-        CHK_ORET(setSize == set->fixedSpaceAllocation ||
-                 (setSize < set->fixedSpaceAllocation &&
-                     setSize + mxf_get_min_llen(mxfFile) + mxfKey_extlen <= set->fixedSpaceAllocation));
+        /* add filler */
+        uint64_t fillSize = set->fixedSpaceAllocation - setSize - mxfKey_extlen;
+        fillSize -= mxf_get_llen(mxfFile, fillSize);
+
+        CHK_ORET(serialise_kl(buffer, &g_KLVFill_key, mxf_get_llen(mxfFile, fillSize), fillSize));
+        CHK_ORET(extend_write_buffer(buffer, (size_t)fillSize, &bytes));
+        memset(bytes, 0, (size_t)fillSize);
+    }
+
+    return 1;
+}
+
+static int serialise_header_sets(MXFFile *mxfFile, MXFHeaderMetadata *headerMetadata, WriteBuffer *buffer)
+{
+    MXFListIterator iter;
+    MXFMetadataSet *prefaceSet;
+
+    /* must write the Preface set first (and there must be a Preface set) */
+    CHK_ORET(mxf_find_singular_set_by_key(headerMetadata, &MXF_SET_K(Preface), &prefaceSet));
+    CHK_ORET(serialise_set(mxfFile, prefaceSet, buffer));
+
+    mxf_initialise_list_iter(&iter, &headerMetadata->sets);
+    while (mxf_next_list_iter_element(&iter))
+    {
+        MXFMetadataSet *set = (MXFMetadataSet*)mxf_get_iter_element(&iter);
 
-        if (setSize < set->fixedSpaceAllocation)
+        if (!mxf_equals_key(&set->key, &MXF_SET_K(Preface)))
         {
-            /* add filler */
-            CHK_ORET(mxf_write_fill(mxfFile, (uint32_t)(set->fixedSpaceAllocation - setSize)));
+            CHK_ORET(serialise_set(mxfFile, set, buffer));
         }
     }
 
     return 1;
 }
 
+/* the header metadata is serialised into a single buffer and written using one mxf_file_write call */
+int mxf_write_header_metadata(MXFFile *mxfFile, MXFHeaderMetadata *headerMetadata)
+{
+    WriteBuffer buffer;
+
+    init_write_buffer(&buffer, headerMetadata);
+    CHK_OFAIL(serialise_primer_pack(mxfFile, headerMetadata->primerPack, &buffer));
+    CHK_OFAIL(serialise_header_sets(mxfFile, headerMetadata, &buffer));
+    CHK_OFAIL(flush_write_buffer(mxfFile, &buffer));
+    release_write_buffer(&buffer, headerMetadata);
+
+    return 1;
+
+fail:
+    release_write_buffer(&buffer, headerMetadata);
+    return 0;
+}
+
+int mxf_write_header_primer_pack(MXFFile *mxfFile, MXFHeaderMetadata *headerMetadata)
+{
+    WriteBuffer buffer;
+
+    init_write_buffer(&buffer, headerMetadata);
+    CHK_OFAIL(serialise_primer_pack(mxfFile, headerMetadata->primerPack, &buffer));
+    CHK_OFAIL(flush_write_buffer(mxfFile, &buffer));
+    release_write_buffer(&buffer, headerMetadata);
+
+    return 1;
+
+fail:
+    release_write_buffer(&buffer, headerMetadata);
+    return 0;
+}
+
+int mxf_write_header_sets(MXFFile *mxfFile, MXFHeaderMetadata *headerMetadata)
+{
+    WriteBuffer buffer;
+
+    init_write_buffer(&buffer, headerMetadata);
+    CHK_OFAIL(serialise_header_sets(mxfFile, headerMetadata, &buffer));
+    CHK_OFAIL(flush_write_buffer(mxfFile, &buffer));
+    release_write_buffer(&buffer, headerMetadata);
+
+    return 1;
+
+fail:
+    release_write_buffer(&buffer, headerMetadata);
+    return 0;
+}
+
+int mxf_write_set(MXFFile *mxfFile, MXFMetadataSet *set)
+{
+    WriteBuffer buffer;
+
+    init_write_buffer(&buffer, set->headerMetadata);
+    CHK_OFAIL(serialise_set(mxfFile, set, &buffer));
+    CHK_OFAIL(flush_write_buffer(mxfFile, &buffer));
+    release_write_buffer(&buffer, set->headerMetadata);
+
+    return 1;
+
+fail:
+    release_write_buffer(&buffer, set->headerMetadata);
+    return 0;
+}
+
 int mxf_write_item(MXFFile *mxfFile, MXFMetadataItem *item)
 {
     CHK_ORET(mxf_write_local_tag(mxfFile, item->tag));
@@ -1070,7 +1796,7 @@ void mxf_get_header_metadata_size(MXFFile *mxfFile, MXFHeaderMetadata *headerMet
     }
 }
 
-/* note: keep in sync with mxf_write_set */
+/* note: keep in sync with serialise_set */
 uint64_t mxf_get_set_size(MXFFile *mxfFile, MXFMetadataSet *set)
 {
     MXFListIterator iter;
@@ -1082,6 +1808,9 @@ uint64_t mxf_get_set_size(MXFFile *mxfFile, MXFMetadataSet *set)
         return set->fixedSpaceAllocation;
     }
 
+    /* errors are logged by the decode function */
+    mxf_decode_set_items(set);
+
     len = 0;
     mxf_initialise_list_iter(&iter, &set->items);
     while (mxf_next_list_iter_element(&iter))
@@ -1355,14 +2084,14 @@ int mxf_get_weakref(MXFHeaderMetadata *headerMetadata, const uint8_t *value, MXF
 
 int mxf_dereference(MXFHeaderMetadata *headerMetadata, const mxfUUID *uuid, MXFMetadataSet **set)
 {
-    void *result;
+    MXFMetadataSet *result;
 
-    if ((result = mxf_find_list_element(&headerMetadata->sets, (void*)uuid, set_eq_instanceuid)) == NULL)
+    if ((result = find_set_index_entry(headerMetadata, uuid)) == NULL)
     {
         return 0;
     }
 
-    *set = (MXFMetadataSet*)result;
+    *set = result;
     return 1;
 }
 
@@ -1390,53 +2119,13 @@ int mxf_get_weakref_s(MXFHeaderMetadata *headerMetadata, MXFListIterator *setsIt
     return mxf_dereference_s(headerMetadata, setsIter, &uuid, set);
 }
 
-/* this will be faster is we de-reference multiple sets in the same order as they were written */
+/* the sets iterator is no longer used because mxf_dereference uses the instanceUID index */
 int mxf_dereference_s(MXFHeaderMetadata *headerMetadata, MXFListIterator *setsIter, const mxfUUID *uuid,
                       MXFMetadataSet **set)
 {
-    MXFMetadataSet *setInList;
-    size_t startIndex = mxf_get_list_iter_index(setsIter);
+    (void)setsIter;
 
-    /* try find it at the previous position in the list */
-    if (startIndex != MXF_LIST_NPOS)
-    {
-        setInList = (MXFMetadataSet*)mxf_get_iter_element(setsIter);
-        if (mxf_equals_uuid(uuid, &setInList->instanceUID))
-        {
-            *set = setInList;
-            return 1;
-        }
-    }
-
-    /* try find it starting from the previous position in the list */
-    while (mxf_next_list_iter_element(setsIter))
-    {
-        setInList = (MXFMetadataSet*)mxf_get_iter_element(setsIter);
-
-        if (mxf_equals_uuid(uuid, &setInList->instanceUID))
-        {
-            *set = setInList;
-            return 1;
-        }
-    }
-
-    /* go back to beginning and try find it before the previous position in the list */
-    if (startIndex != MXF_LIST_NPOS)
-    {
-        mxf_initialise_sets_iter(headerMetadata, setsIter);
-        while (mxf_next_list_iter_element(setsIter) && mxf_get_list_iter_index(setsIter) < startIndex)
-        {
-            setInList = (MXFMetadataSet*)mxf_get_iter_element(setsIter);
-
-            if (mxf_equals_uuid(uuid, &setInList->instanceUID))
-            {
-                *set = setInList;
-                return 1;
-            }
-        }
-    }
-
-    return 0;
+    return mxf_dereference(headerMetadata, uuid, set);
 }
 
 
@@ -1689,16 +2378,8 @@ void mxf_set_array_header(uint32_t arrayLen, uint32_t arrayElementLen, uint8_t *
 
 int mxf_alloc_item_value(MXFMetadataItem *item, uint16_t len, uint8_t **value)
 {
-    if (item->value && item->length != len)
-    {
-        free_metadata_item_value(item);
-    }
-    if (!item->value)
-    {
-        CHK_MALLOC_ARRAY_ORET(item->value, uint8_t, len);
-    }
+    CHK_ORET(alloc_metadata_item_value(item, len));
     item->isPersistent = 0;
-    item->length = len;
 
     *value = item->value;
     return 1;
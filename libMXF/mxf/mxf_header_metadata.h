@@ -41,6 +41,8 @@ extern "C"
 #endif
 
 
+#define MXF_ITEM_INLINE_VALUE_SIZE      32
+
 typedef struct
 {
     mxfKey key;
@@ -49,6 +51,11 @@ typedef struct
     uint16_t length;
     uint8_t *value;
     struct MXFMetadataSet *set;
+    /* value points to this buffer if the value fits, avoiding a separate allocation */
+    uint8_t inlineValue[MXF_ITEM_INLINE_VALUE_SIZE];
+    /* set if the item was allocated from an arena, which is then referenced by the item */
+    MXFArena *arena;
+    int isArenaValue;
 } MXFMetadataItem;
 
 typedef struct MXFMetadataSet
@@ -58,6 +65,18 @@ typedef struct MXFMetadataSet
     MXFList items;
     struct MXFHeaderMetadata *headerMetadata;
     uint64_t fixedSpaceAllocation;
+    /* set if the set was allocated from an arena, which is then referenced by the set */
+    MXFArena *arena;
+    /* open-addressing hash table of items keyed by item key, created once the set has several items */
+    MXFMetadataItem **itemIndex;
+    uint32_t itemIndexSize;
+    uint32_t itemIndexUsed;
+    /* incremented whenever an item is added to or removed from the set, allowing item lookups to be cached */
+    uint32_t itemsRevision;
+    /* set if the set was read lazily and the encoded items have not yet been decoded */
+    const uint8_t *encodedItems;
+    uint32_t encodedItemsLen;
+    struct MXFHeaderMetadata *encodedHeaderMetadata;
 } MXFMetadataSet;
 
 typedef struct MXFHeaderMetadata
@@ -65,6 +84,16 @@ typedef struct MXFHeaderMetadata
     MXFDataModel *dataModel;
     MXFPrimerPack *primerPack;
     MXFList sets;
+    /* open-addressing hash table of sets keyed by instanceUID, used by mxf_dereference */
+    MXFMetadataSet **setIndex;
+    size_t setIndexSize;
+    size_t setIndexUsed;
+    /* sets and items read or cloned into the header metadata are allocated from this arena */
+    MXFArena *arena;
+    int lazyRead;
+    /* buffer the header metadata is serialised into before it is written, kept for re-writes */
+    uint8_t *writeBuffer;
+    size_t writeBufferSize;
 } MXFHeaderMetadata;
 
 typedef struct
@@ -97,6 +126,14 @@ void mxf_free_item(MXFMetadataItem **item);
 
 void mxf_set_fixed_set_space_allocation(MXFMetadataSet *set, uint64_t size);
 
+/* Lazy read mode: sets are read with only their key and InstanceUID decoded and the items are decoded
+   from the set's bytes the first time they are accessed. Accessing items therefore modifies the set */
+void mxf_set_lazy_header_metadata_read(MXFHeaderMetadata *headerMetadata, int enable);
+/* decodes the items of a lazily read set. This is done automatically when items are accessed using
+   the functions below and must be called before accessing the set's items list directly. The set is
+   left undecoded if decoding fails */
+int mxf_decode_set_items(MXFMetadataSet *set);
+
 int mxf_add_set(MXFHeaderMetadata *headerMetadata, MXFMetadataSet *set);
 
 int mxf_register_item(MXFHeaderMetadata *headerMetadata, const mxfKey *key);
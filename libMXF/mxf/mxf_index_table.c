@@ -395,10 +395,11 @@ int mxf_write_index_table_segment(MXFFile *mxfFile, const MXFIndexTableSegment *
     return 1;
 }
 
-int mxf_read_index_table_segment_2(MXFFile *mxfFile, uint64_t segmentLen,
-                                   mxf_add_delta_entry *addDeltaEntry, void *addDeltaEntryData,
-                                   mxf_add_index_entry *addIndexEntry, void *addIndexEntryData,
-                                   MXFIndexTableSegment **segment)
+static int read_index_table_segment(MXFFile *mxfFile, uint64_t segmentLen,
+                                    mxf_add_delta_entry *addDeltaEntry, void *addDeltaEntryData,
+                                    mxf_add_index_entry *addIndexEntry, void *addIndexEntryData,
+                                    mxf_get_index_entry_arrays *getIndexEntryArrays, void *getIndexEntryArraysData,
+                                    MXFIndexTableSegment **segment)
 {
     MXFIndexTableSegment *newSegment = NULL;
     mxfLocalTag localTag;
@@ -532,7 +533,16 @@ int mxf_read_index_table_segment_2(MXFFile *mxfFile, uint64_t segmentLen,
                                  (uint32_t)11 + newSegment->sliceCount * 4 + newSegment->posTableCount * 8);
                 }
                 CHK_OFAIL(localLen == 8 + indexEntryArrayLen * indexEntryLen);
-                entry = indexEntryArrayLen;
+                if (getIndexEntryArrays != NULL)
+                {
+                    CHK_OFAIL(mxf_read_index_entry_array(mxfFile, newSegment, indexEntryArrayLen, indexEntryLen,
+                                                         getIndexEntryArrays, getIndexEntryArraysData));
+                    entry = 0;
+                }
+                else
+                {
+                    entry = indexEntryArrayLen;
+                }
                 for (; entry > 0; entry--)
                 {
                     actualEntryLen = 0;
@@ -585,6 +595,84 @@ fail:
     return 0;
 }
 
+int mxf_read_index_table_segment_2(MXFFile *mxfFile, uint64_t segmentLen,
+                                   mxf_add_delta_entry *addDeltaEntry, void *addDeltaEntryData,
+                                   mxf_add_index_entry *addIndexEntry, void *addIndexEntryData,
+                                   MXFIndexTableSegment **segment)
+{
+    return read_index_table_segment(mxfFile, segmentLen, addDeltaEntry, addDeltaEntryData,
+                                    addIndexEntry, addIndexEntryData, NULL, NULL, segment);
+}
+
+int mxf_read_index_table_segment_3(MXFFile *mxfFile, uint64_t segmentLen,
+                                   mxf_add_delta_entry *addDeltaEntry, void *addDeltaEntryData,
+                                   mxf_get_index_entry_arrays *getIndexEntryArrays, void *getIndexEntryArraysData,
+                                   MXFIndexTableSegment **segment)
+{
+    return read_index_table_segment(mxfFile, segmentLen, addDeltaEntry, addDeltaEntryData,
+                                    NULL, NULL, getIndexEntryArrays, getIndexEntryArraysData, segment);
+}
+
+int mxf_read_index_entry_array(MXFFile *mxfFile, MXFIndexTableSegment *segment, uint32_t numEntries,
+                               uint32_t entryLen, mxf_get_index_entry_arrays *getIndexEntryArrays, void *data)
+{
+    MXFIndexEntryArrays arrays;
+    uint64_t bufferSize;
+    uint8_t *buffer = NULL;
+    const uint8_t *entryData;
+    uint32_t i;
+
+    if (numEntries == 0)
+    {
+        return 1;
+    }
+
+    /* the slice offsets and pos table that follow the first 11 bytes are skipped */
+    CHK_ORET(entryLen >= 11);
+    bufferSize = (uint64_t)numEntries * entryLen;
+    CHK_ORET((size_t)bufferSize == bufferSize);
+
+    memset(&arrays, 0, sizeof(arrays));
+    CHK_ORET((*getIndexEntryArrays)(data, numEntries, segment, &arrays));
+    CHK_ORET(arrays.temporalOffsets != NULL && arrays.keyFrameOffsets != NULL &&
+             arrays.flags != NULL && arrays.streamOffsets != NULL);
+
+    CHK_MALLOC_ARRAY_ORET(buffer, uint8_t, (size_t)bufferSize);
+    CHK_OFAIL(mxf_file_read_64(mxfFile, buffer, bufferSize) == bufferSize);
+
+    /* each field is decoded in a separate loop to keep the loops simple enough to be vectorised */
+    entryData = buffer;
+    for (i = 0; i < numEntries; i++, entryData += entryLen)
+    {
+        arrays.temporalOffsets[i] = (int8_t)entryData[0];
+    }
+    entryData = buffer;
+    for (i = 0; i < numEntries; i++, entryData += entryLen)
+    {
+        arrays.keyFrameOffsets[i] = (int8_t)entryData[1];
+    }
+    entryData = buffer;
+    for (i = 0; i < numEntries; i++, entryData += entryLen)
+    {
+        arrays.flags[i] = entryData[2];
+    }
+    entryData = buffer;
+    for (i = 0; i < numEntries; i++, entryData += entryLen)
+    {
+        arrays.streamOffsets[i] = ((uint64_t)entryData[3] << 56) | ((uint64_t)entryData[4] << 48) |
+                                  ((uint64_t)entryData[5] << 40) | ((uint64_t)entryData[6] << 32) |
+                                  ((uint64_t)entryData[7] << 24) | ((uint64_t)entryData[8] << 16) |
+                                  ((uint64_t)entryData[9] << 8)  |  (uint64_t)entryData[10];
+    }
+
+    SAFE_FREE(buffer);
+    return 1;
+
+fail:
+    SAFE_FREE(buffer);
+    return 0;
+}
+
 int mxf_read_index_table_segment(MXFFile *mxfFile, uint64_t segmentLen, MXFIndexTableSegment **segment)
 {
     CHK_ORET(mxf_read_index_table_segment_2(mxfFile, segmentLen, mxf_default_add_delta_entry, NULL,
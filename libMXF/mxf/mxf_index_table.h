@@ -97,6 +97,18 @@ typedef int (mxf_add_index_entry)(void *data, uint32_t numEntries, MXFIndexTable
                                   uint32_t *sliceOffset /* assumes sliceCount set in segment */,
                                   mxfRational *posTable /* assumes posTableCount set in segment */);
 
+/* contiguous arrays, each holding numEntries values, that are filled in by mxf_read_index_entry_array */
+typedef struct
+{
+    int8_t *temporalOffsets;
+    int8_t *keyFrameOffsets;
+    uint8_t *flags;
+    uint64_t *streamOffsets;
+} MXFIndexEntryArrays;
+
+typedef int (mxf_get_index_entry_arrays)(void *data, uint32_t numEntries, MXFIndexTableSegment *segment,
+                                         MXFIndexEntryArrays *arrays);
+
 
 int mxf_is_index_table_segment(const mxfKey *key);
 
@@ -117,6 +129,13 @@ int mxf_read_index_table_segment_2(MXFFile *mxfFile, uint64_t segmentLen,
                                    mxf_add_delta_entry *addDeltaEntry, void *addDeltaEntryData,
                                    mxf_add_index_entry *addIndexEntry, void *addIndexEntryData,
                                    MXFIndexTableSegment **segment);
+int mxf_read_index_table_segment_3(MXFFile *mxfFile, uint64_t segmentLen,
+                                   mxf_add_delta_entry *addDeltaEntry, void *addDeltaEntryData,
+                                   mxf_get_index_entry_arrays *getIndexEntryArrays, void *getIndexEntryArraysData,
+                                   MXFIndexTableSegment **segment);
+
+int mxf_read_index_entry_array(MXFFile *mxfFile, MXFIndexTableSegment *segment, uint32_t numEntries,
+                               uint32_t entryLen, mxf_get_index_entry_arrays *getIndexEntryArrays, void *data);
 
 int mxf_write_index_table_segment_header(MXFFile *mxfFile, const MXFIndexTableSegment *segment,
                                          uint32_t numDeltaEntries, uint32_t numIndexEntries);
@@ -101,11 +101,11 @@ static int get_chunk_pos(MXFFileSysData *sysData, size_t *posChunkIndex, int64_t
     return 1;
 }
 
-static int extend_mem_file(MXFFileSysData *sysData, uint32_t minSize)
+static int extend_mem_file(MXFFileSysData *sysData, uint64_t minSize)
 {
-    uint32_t i;
+    size_t i;
     Chunk *newChunks;
-    uint32_t numExtendChunks;
+    size_t numExtendChunks;
     int64_t chunkRemainder;
 
     assert(!sysData->readOnly);
@@ -116,10 +116,10 @@ static int extend_mem_file(MXFFileSysData *sysData, uint32_t minSize)
         chunkRemainder = sysData->chunks[sysData->numChunks - 1].allocSize -
                             sysData->chunks[sysData->numChunks - 1].size;
     }
-    if (minSize <= chunkRemainder)
+    if (minSize <= (uint64_t)chunkRemainder)
         return 1;
 
-    numExtendChunks = (uint32_t)((minSize - chunkRemainder + sysData->chunkSize - 1) / sysData->chunkSize);
+    numExtendChunks = (size_t)((minSize - chunkRemainder + sysData->chunkSize - 1) / sysData->chunkSize);
     newChunks = (Chunk*)realloc(sysData->chunks, (sysData->numChunks + numExtendChunks) * sizeof(Chunk));
     if (!newChunks) {
         mxf_log_error("Failed to reallocate memory file chunks" LOG_LOC_FORMAT, LOG_LOC_PARAMS);
@@ -161,9 +161,9 @@ static int64_t mem_file_size(MXFFileSysData *sysData)
     return sysData->virtualStartPos + mxf_mem_file_get_size(&sysData->mxfMemFile);
 }
 
-static uint32_t mem_file_read(MXFFileSysData *sysData, uint8_t *data, uint32_t count)
+static uint64_t mem_file_read_64(MXFFileSysData *sysData, uint8_t *data, uint64_t count)
 {
-    uint32_t totalRead = 0;
+    uint64_t totalRead = 0;
     size_t posChunkIndex;
     int64_t posChunkPos;
     int64_t numRead;
@@ -178,10 +178,10 @@ static uint32_t mem_file_read(MXFFileSysData *sysData, uint8_t *data, uint32_t c
     while (totalRead < count) {
         numRead = sysData->chunks[posChunkIndex].size - posChunkPos;
         if (numRead > 0) {
-            if (numRead > count - totalRead)
-                numRead = count - totalRead;
-            memcpy(&data[totalRead], &sysData->chunks[posChunkIndex].data[posChunkPos], (uint32_t)numRead);
-            totalRead += (uint32_t)numRead;
+            if ((uint64_t)numRead > count - totalRead)
+                numRead = (int64_t)(count - totalRead);
+            memcpy(&data[totalRead], &sysData->chunks[posChunkIndex].data[posChunkPos], (size_t)numRead);
+            totalRead += numRead;
             sysData->position += numRead;
             posChunkPos += numRead;
         }
@@ -199,9 +199,9 @@ static uint32_t mem_file_read(MXFFileSysData *sysData, uint8_t *data, uint32_t c
     return totalRead;
 }
 
-static uint32_t mem_file_write(MXFFileSysData *sysData, const uint8_t *data, uint32_t count)
+static uint64_t mem_file_write_64(MXFFileSysData *sysData, const uint8_t *data, uint64_t count)
 {
-    uint32_t totalWrite = 0;
+    uint64_t totalWrite = 0;
     size_t posChunkIndex;
     int64_t posChunkPos;
     int64_t numWrite;
@@ -211,12 +211,9 @@ static uint32_t mem_file_write(MXFFileSysData *sysData, const uint8_t *data, uin
         return 0;
 
     fileSize = mxf_mem_file_get_size(&sysData->mxfMemFile);
-    if (sysData->position + count > fileSize) {
-        if (sysData->position + count - fileSize > UINT32_MAX ||
-            !extend_mem_file(sysData, (uint32_t)(sysData->position + count - fileSize)))
-        {
+    if (sysData->position + count > (uint64_t)fileSize) {
+        if (!extend_mem_file(sysData, sysData->position + count - fileSize))
             return 0;
-        }
 
         /* add data from fileSize to sysData->position */
         if (sysData->position > fileSize) {
@@ -250,10 +247,10 @@ static uint32_t mem_file_write(MXFFileSysData *sysData, const uint8_t *data, uin
     while (totalWrite < count) {
         numWrite = sysData->chunks[posChunkIndex].allocSize - posChunkPos;
         if (numWrite > 0) {
-            if (numWrite > count - totalWrite)
-                numWrite = count - totalWrite;
-            memcpy(&sysData->chunks[posChunkIndex].data[posChunkPos], &data[totalWrite], (uint32_t)numWrite);
-            totalWrite += (uint32_t)numWrite;
+            if ((uint64_t)numWrite > count - totalWrite)
+                numWrite = (int64_t)(count - totalWrite);
+            memcpy(&sysData->chunks[posChunkIndex].data[posChunkPos], &data[totalWrite], (size_t)numWrite);
+            totalWrite += numWrite;
             sysData->position += numWrite;
             posChunkPos += numWrite;
             if (posChunkPos > sysData->chunks[posChunkIndex].size)
@@ -269,6 +266,16 @@ static uint32_t mem_file_write(MXFFileSysData *sysData, const uint8_t *data, uin
     return totalWrite;
 }
 
+static uint32_t mem_file_read(MXFFileSysData *sysData, uint8_t *data, uint32_t count)
+{
+    return (uint32_t)mem_file_read_64(sysData, data, count);
+}
+
+static uint32_t mem_file_write(MXFFileSysData *sysData, const uint8_t *data, uint32_t count)
+{
+    return (uint32_t)mem_file_write_64(sysData, data, count);
+}
+
 static int mem_file_getchar(MXFFileSysData *sysData)
 {
     unsigned char data;
@@ -354,6 +361,8 @@ int mxf_mem_file_open_new(uint32_t chunkSize, int64_t virtualStartPos, MXFMemory
     newMXFFile->tell            = mem_file_tell;
     newMXFFile->is_seekable     = mem_file_is_seekable;
     newMXFFile->size            = mem_file_size;
+    newMXFFile->read_64         = mem_file_read_64;
+    newMXFFile->write_64        = mem_file_write_64;
     newMXFFile->free_sys_data   = free_mem_file;
 
 
@@ -391,6 +400,8 @@ int mxf_mem_file_open_read(const unsigned char *data, int64_t size, int64_t virt
     newMXFFile->tell            = mem_file_tell;
     newMXFFile->is_seekable     = mem_file_is_seekable;
     newMXFFile->size            = mem_file_size;
+    newMXFFile->read_64         = mem_file_read_64;
+    newMXFFile->write_64        = mem_file_write_64;
     newMXFFile->free_sys_data   = free_mem_file;
 
 
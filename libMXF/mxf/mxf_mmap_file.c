@@ -0,0 +1,398 @@
+/*
+ * Copyright (C) 2017, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Author: Philip de Nier
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <errno.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <mxf/mxf.h>
+#include <mxf/mxf_mmap_file.h>
+#include <mxf/mxf_macros.h>
+
+
+#define DEFAULT_WINDOW_SIZE     (64 * 1024 * 1024)
+
+
+
+struct MXFMMapRegion
+{
+    uint8_t *data;      /* memory mapped window */
+    int64_t offset;     /* file offset of data; a multiple of the page size */
+    uint32_t size;      /* number of mapped bytes in data */
+    int refCount;
+};
+
+struct MXFFileSysData
+{
+    int fd;
+    int flags;
+    int isSeekable;
+
+    int64_t fileSize;
+    int64_t position;
+    int isEOF;
+
+    uint32_t pageSize;
+    uint32_t windowSize;
+
+    MXFMMapRegion *window;  /* current window; the file holds a reference */
+};
+
+
+static void unmap_window(MXFFileSysData *sysData)
+{
+    mxf_mmap_region_unref(&sysData->window);
+}
+
+static int update_file_size(MXFFileSysData *sysData)
+{
+    struct stat statBuf;
+
+    if (fstat(sysData->fd, &statBuf) != 0)
+        return 0;
+
+    sysData->fileSize = statBuf.st_size;
+    return 1;
+}
+
+static int map_window(MXFFileSysData *sysData, int64_t position, uint32_t minSize)
+{
+    char errorBuf[128];
+    MXFMMapRegion *newWindow;
+    int64_t offset;
+    int64_t size;
+    int advice;
+    void *data;
+
+    unmap_window(sysData);
+
+    offset = position - (position % sysData->pageSize);
+    size = sysData->windowSize;
+    if (offset + size < position + minSize) {
+        size = position + minSize - offset;
+        if (size % sysData->pageSize)
+            size += sysData->pageSize - (size % sysData->pageSize);
+    }
+    if (offset + size > sysData->fileSize)
+        size = sysData->fileSize - offset;
+    if (size <= 0 || size > UINT32_MAX)
+        return 0;
+
+    data = mmap(NULL, (size_t)size, PROT_READ, MAP_SHARED, sysData->fd, (off_t)offset);
+    if (data == MAP_FAILED) {
+        mxf_log_error("mmap failed: %s\n", mxf_strerror(errno, errorBuf, sizeof(errorBuf)));
+        return 0;
+    }
+
+    if (sysData->flags & MXF_MMAP_FLAG_RANDOM_ACCESS)
+        advice = MADV_RANDOM;
+    else if (sysData->flags & MXF_MMAP_FLAG_SEQUENTIAL_SCAN)
+        advice = MADV_SEQUENTIAL;
+    else
+        advice = MADV_NORMAL;
+    if (advice != MADV_NORMAL && madvise(data, (size_t)size, advice) != 0)
+        mxf_log_warn("madvise failed: %s\n", mxf_strerror(errno, errorBuf, sizeof(errorBuf)));
+
+    newWindow = malloc(sizeof(MXFMMapRegion));
+    if (!newWindow) {
+        mxf_log_error("Failed to allocate memory-mapped region\n");
+        munmap(data, (size_t)size);
+        return 0;
+    }
+    newWindow->data     = (uint8_t*)data;
+    newWindow->offset   = offset;
+    newWindow->size     = (uint32_t)size;
+    newWindow->refCount = 1;
+
+    sysData->window = newWindow;
+
+    return 1;
+}
+
+static int position_in_window(MXFFileSysData *sysData, uint32_t count)
+{
+    return sysData->window &&
+           sysData->position >= sysData->window->offset &&
+           sysData->position + count <= sysData->window->offset + sysData->window->size;
+}
+
+static int check_available(MXFFileSysData *sysData, uint32_t count)
+{
+    /* the file could be growing and so check the size before concluding that the end has been reached */
+    if (sysData->position + count > sysData->fileSize &&
+        (!update_file_size(sysData) || sysData->position + count > sysData->fileSize))
+    {
+        if (sysData->position >= sysData->fileSize)
+            sysData->isEOF = 1;
+        return 0;
+    }
+
+    return 1;
+}
+
+
+static void mmap_file_close(MXFFileSysData *sysData)
+{
+    unmap_window(sysData);
+    if (sysData->fd >= 0) {
+        close(sysData->fd);
+        sysData->fd = -1;
+    }
+}
+
+static uint32_t mmap_file_read(MXFFileSysData *sysData, uint8_t *data, uint32_t count)
+{
+    uint32_t totalRead = 0;
+    uint32_t numRead;
+    uint32_t cursor;
+
+    while (totalRead < count) {
+        if (!position_in_window(sysData, 1)) {
+            if (!check_available(sysData, 1) || !map_window(sysData, sysData->position, 0))
+                break;
+        }
+
+        cursor = (uint32_t)(sysData->position - sysData->window->offset);
+        numRead = sysData->window->size - cursor;
+        if (numRead > count - totalRead)
+            numRead = count - totalRead;
+
+        memcpy(&data[totalRead], &sysData->window->data[cursor], numRead);
+        totalRead += numRead;
+        sysData->position += numRead;
+    }
+
+    return totalRead;
+}
+
+static uint32_t mmap_file_write(MXFFileSysData *sysData, const uint8_t *data, uint32_t count)
+{
+    (void)sysData;
+    (void)data;
+    (void)count;
+
+    return 0;
+}
+
+static int mmap_file_getchar(MXFFileSysData *sysData)
+{
+    uint8_t c;
+    if (mmap_file_read(sysData, &c, 1) != 1)
+        return EOF;
+
+    return c;
+}
+
+static int mmap_file_putchar(MXFFileSysData *sysData, int c)
+{
+    (void)sysData;
+    (void)c;
+
+    return EOF;
+}
+
+static int mmap_file_eof(MXFFileSysData *sysData)
+{
+    return sysData->isEOF;
+}
+
+static int mmap_file_seek(MXFFileSysData *sysData, int64_t offset, int whence)
+{
+    int64_t newPosition;
+
+    switch (whence)
+    {
+        case SEEK_SET:
+            newPosition = offset;
+            break;
+        case SEEK_CUR:
+            newPosition = sysData->position + offset;
+            break;
+        case SEEK_END:
+            if (!update_file_size(sysData))
+                return 0;
+            newPosition = sysData->fileSize + offset;
+            break;
+        default:
+            return 0;
+    }
+    if (newPosition < 0)
+        return 0;
+
+    sysData->position = newPosition;
+    sysData->isEOF = 0;
+
+    return 1;
+}
+
+static int64_t mmap_file_tell(MXFFileSysData *sysData)
+{
+    return sysData->position;
+}
+
+static int mmap_file_is_seekable(MXFFileSysData *sysData)
+{
+    return sysData->isSeekable;
+}
+
+static int64_t mmap_file_size(MXFFileSysData *sysData)
+{
+    if (!update_file_size(sysData))
+        return -1;
+
+    return sysData->fileSize;
+}
+
+static void free_mmap_file(MXFFileSysData *sysData)
+{
+    free(sysData);
+}
+
+
+int mxf_mmap_file_open_read(const char *filename, int flags, uint32_t windowSize, MXFFile **mxfFile)
+{
+    MXFFile *newMXFFile = NULL;
+    MXFFileSysData *newMMapFile = NULL;
+    struct stat statBuf;
+    char errorBuf[128];
+    uint32_t pageSize;
+    int fd;
+
+    fd = open(filename, O_RDONLY);
+    if (fd < 0)
+        return 0;
+
+    if (fstat(fd, &statBuf) != 0) {
+        mxf_log_error("fstat failed: %s\n", mxf_strerror(errno, errorBuf, sizeof(errorBuf)));
+        goto fail;
+    }
+    if (!S_ISREG(statBuf.st_mode)) {
+        mxf_log_error("Memory-mapped file access requires a regular file\n");
+        goto fail;
+    }
+
+    CHK_MALLOC_OFAIL(newMXFFile, MXFFile);
+    memset(newMXFFile, 0, sizeof(MXFFile));
+    CHK_MALLOC_OFAIL(newMMapFile, MXFFileSysData);
+    memset(newMMapFile, 0, sizeof(MXFFileSysData));
+
+    pageSize = mxf_get_system_page_size();
+    if (windowSize == 0)
+        windowSize = DEFAULT_WINDOW_SIZE;
+    if (windowSize < pageSize)
+        windowSize = pageSize;
+
+    newMMapFile->fd         = fd;
+    newMMapFile->flags      = flags;
+    newMMapFile->isSeekable = 1;
+    newMMapFile->fileSize   = statBuf.st_size;
+    newMMapFile->pageSize   = pageSize;
+    newMMapFile->windowSize = windowSize - (windowSize % pageSize);
+
+    newMXFFile->close         = mmap_file_close;
+    newMXFFile->read          = mmap_file_read;
+    newMXFFile->write         = mmap_file_write;
+    newMXFFile->get_char      = mmap_file_getchar;
+    newMXFFile->put_char      = mmap_file_putchar;
+    newMXFFile->eof           = mmap_file_eof;
+    newMXFFile->seek          = mmap_file_seek;
+    newMXFFile->tell          = mmap_file_tell;
+    newMXFFile->is_seekable   = mmap_file_is_seekable;
+    newMXFFile->size          = mmap_file_size;
+    newMXFFile->free_sys_data = free_mmap_file;
+    newMXFFile->sysData       = newMMapFile;
+
+    *mxfFile = newMXFFile;
+    return 1;
+
+fail:
+    close(fd);
+    SAFE_FREE(newMXFFile);
+    SAFE_FREE(newMMapFile);
+    return 0;
+}
+
+
+int mxf_mmap_file_is_mmap_file(MXFFile *mxfFile)
+{
+    return mxfFile->close == mmap_file_close;
+}
+
+int mxf_mmap_file_read_region(MXFFile *mxfFile, uint32_t count, MXFMMapRegion **region, const uint8_t **data)
+{
+    MXFFileSysData *sysData;
+
+    if (!mxf_mmap_file_is_mmap_file(mxfFile) || count == 0)
+        return 0;
+    sysData = mxfFile->sysData;
+
+    if (!position_in_window(sysData, count)) {
+        if (!check_available(sysData, count) || !map_window(sysData, sysData->position, count))
+            return 0;
+    }
+
+    *data = &sysData->window->data[sysData->position - sysData->window->offset];
+    *region = mxf_mmap_region_ref(sysData->window);
+    sysData->position += count;
+
+    return 1;
+}
+
+MXFMMapRegion* mxf_mmap_region_ref(MXFMMapRegion *region)
+{
+    if (region)
+        region->refCount++;
+
+    return region;
+}
+
+void mxf_mmap_region_unref(MXFMMapRegion **region)
+{
+    if (!(*region))
+        return;
+
+    (*region)->refCount--;
+    if ((*region)->refCount <= 0) {
+        munmap((*region)->data, (*region)->size);
+        free(*region);
+    }
+    *region = NULL;
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2017, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Author: Philip de Nier
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef MXF_MMAP_FILE_H_
+#define MXF_MMAP_FILE_H_
+
+
+#include <mxf/mxf_file.h>
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+
+#define MXF_MMAP_FLAG_DEFAULT               0x00
+#define MXF_MMAP_FLAG_SEQUENTIAL_SCAN       0x01
+#define MXF_MMAP_FLAG_RANDOM_ACCESS         0x02
+
+
+
+/* Read-only file accessed through memory-mapped windows (POSIX mmap).
+   windowSize is rounded down to a multiple of the system page size; set it to 0 to use the default (64 MB) */
+
+int mxf_mmap_file_open_read(const char *filename, int flags, uint32_t windowSize, MXFFile **mxfFile);
+
+int mxf_mmap_file_is_mmap_file(MXFFile *mxfFile);
+
+
+/* Zero-copy read: returns a pointer to the next count bytes in the mapping and advances the file position.
+   The region holds a reference to the mapping that keeps data valid until the reference is released,
+   including after the file has been closed. The reference counting is not thread-safe */
+
+typedef struct MXFMMapRegion MXFMMapRegion;
+
+int mxf_mmap_file_read_region(MXFFile *mxfFile, uint32_t count, MXFMMapRegion **region, const uint8_t **data);
+
+MXFMMapRegion* mxf_mmap_region_ref(MXFMMapRegion *region);
+void mxf_mmap_region_unref(MXFMMapRegion **region);
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif
@@ -44,6 +44,8 @@
 #include <sys/stat.h>
 #else
 #include <unistd.h>
+#include <fcntl.h>
+#include <pthread.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #endif
@@ -62,6 +64,9 @@
 
 #define PAGE_ALLOC_INCR             64
 
+#define STRIPE_WRITE_SIZE           (1024 * 1024)
+#define MAX_STRIPE_QUEUED_SIZE      (16 * 1024 * 1024)
+
 
 typedef enum
 {
@@ -92,6 +97,44 @@ typedef struct Page
     int64_t offset;
 } Page;
 
+#if !defined(_WIN32)
+typedef struct StripeWrite
+{
+    struct StripeWrite *next;
+
+    int pageIndex;
+    int create;
+    int64_t offset;
+    uint32_t size;
+    uint8_t *data;
+} StripeWrite;
+
+typedef struct
+{
+    const char *filenameTemplate;
+
+    pthread_t thread;
+    int threadStarted;
+    pthread_mutex_t mutex;          /* protects the queue state below */
+    pthread_cond_t queueCond;       /* signals the writer thread that writes are queued or it must stop */
+    pthread_cond_t doneCond;        /* signals that queued writes have completed */
+
+    StripeWrite *queueHead;
+    StripeWrite *queueTail;
+    StripeWrite *freeWrites;
+    uint32_t queuedSize;
+    int busy;
+    int stop;
+    int error;
+
+    StripeWrite *pending;           /* write being accumulated by the caller's thread */
+
+    /* writer thread only */
+    int fd;
+    int fdPageIndex;
+} Stripe;
+#endif
+
 struct MXFPageFile
 {
     MXFFile *mxfFile;
@@ -103,7 +146,8 @@ struct MXFFileSysData
 
     int64_t pageSize;
     FileMode mode;
-    char *filenameTemplate;
+    char **filenameTemplates;       /* page i is stored in a file using template i % numTemplates */
+    int numTemplates;
 
     int64_t position;
 
@@ -114,6 +158,11 @@ struct MXFFileSysData
     FileDescriptor *fileDescriptorHead;
     FileDescriptor *fileDescriptorTail;
     int numFileDescriptors;
+
+#if !defined(_WIN32)
+    Stripe *stripes;                /* a writer thread per template in striped write mode */
+    int numStripes;
+#endif
 };
 
 
@@ -169,6 +218,312 @@ static int64_t disk_file_size(const char *filename)
     return statBuf.st_size;
 }
 
+static void get_page_filename(char * const *filenameTemplates, int numTemplates, int index,
+                              char *filename, size_t filenameSize)
+{
+    mxf_snprintf(filename, filenameSize, filenameTemplates[index % numTemplates], index);
+}
+
+static int set_filename_templates(MXFFileSysData *sysData, const char * const *filenameTemplates, int numTemplates)
+{
+    int i;
+
+    CHK_ORET(numTemplates > 0);
+    for (i = 0; i < numTemplates; i++)
+    {
+        if (strstr(filenameTemplates[i], "%d") == NULL)
+        {
+            mxf_log_error("Filename template '%s' doesn't contain %%d\n", filenameTemplates[i]);
+            return 0;
+        }
+    }
+
+    CHK_MALLOC_ARRAY_ORET(sysData->filenameTemplates, char*, numTemplates);
+    memset(sysData->filenameTemplates, 0, numTemplates * sizeof(char*));
+    sysData->numTemplates = numTemplates;
+    for (i = 0; i < numTemplates; i++)
+        CHK_ORET((sysData->filenameTemplates[i] = strdup(filenameTemplates[i])) != NULL);
+
+    return 1;
+}
+
+static int count_page_files(const char * const *filenameTemplates, int numTemplates)
+{
+    char filename[4096];
+    FILE *file;
+    int pageCount = 0;
+
+    for(;;)
+    {
+        get_page_filename((char * const *)filenameTemplates, numTemplates, pageCount, filename, sizeof(filename));
+        if ((file = fopen(filename, "rb")) == NULL)
+        {
+            break;
+        }
+        fclose(file);
+        pageCount++;
+    }
+
+    return pageCount;
+}
+
+
+
+#if !defined(_WIN32)
+
+static int stripe_write(Stripe *stripe, StripeWrite *write)
+{
+    char filename[4096];
+    char errorBuf[128];
+    uint32_t totalWrite = 0;
+    ssize_t numWrite;
+
+    if (stripe->fd < 0 || stripe->fdPageIndex != write->pageIndex)
+    {
+        if (stripe->fd >= 0)
+        {
+            close(stripe->fd);
+            stripe->fd = -1;
+        }
+
+        mxf_snprintf(filename, sizeof(filename), stripe->filenameTemplate, write->pageIndex);
+        stripe->fd = open(filename, O_WRONLY | O_CREAT | (write->create ? O_TRUNC : 0), 0666);
+        if (stripe->fd < 0)
+        {
+            mxf_log_error("Failed to open striped mxf page file '%s': %s\n",
+                          filename, mxf_strerror(errno, errorBuf, sizeof(errorBuf)));
+            return 0;
+        }
+        stripe->fdPageIndex = write->pageIndex;
+    }
+
+    while (totalWrite < write->size)
+    {
+        numWrite = pwrite(stripe->fd, &write->data[totalWrite], write->size - totalWrite,
+                          (off_t)(write->offset + totalWrite));
+        if (numWrite < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            mxf_log_error("pwrite failed: %s\n", mxf_strerror(errno, errorBuf, sizeof(errorBuf)));
+            return 0;
+        }
+        totalWrite += (uint32_t)numWrite;
+    }
+
+    return 1;
+}
+
+static void* stripe_thread(void *arg)
+{
+    Stripe *stripe = (Stripe*)arg;
+    StripeWrite *write;
+    int result;
+
+    pthread_mutex_lock(&stripe->mutex);
+    for (;;)
+    {
+        while (!stripe->queueHead && !stripe->stop)
+            pthread_cond_wait(&stripe->queueCond, &stripe->mutex);
+        if (!stripe->queueHead)
+            break;
+
+        write = stripe->queueHead;
+        stripe->queueHead = write->next;
+        if (!stripe->queueHead)
+            stripe->queueTail = NULL;
+        stripe->busy = 1;
+        pthread_mutex_unlock(&stripe->mutex);
+
+        result = stripe_write(stripe, write);
+
+        pthread_mutex_lock(&stripe->mutex);
+        if (!result)
+            stripe->error = 1;
+        stripe->busy = 0;
+        stripe->queuedSize -= write->size;
+        write->next = stripe->freeWrites;
+        stripe->freeWrites = write;
+        pthread_cond_broadcast(&stripe->doneCond);
+    }
+    pthread_mutex_unlock(&stripe->mutex);
+
+    return NULL;
+}
+
+static int submit_stripe_write(Stripe *stripe)
+{
+    StripeWrite *write = stripe->pending;
+    int result;
+
+    if (!write)
+        return 1;
+    stripe->pending = NULL;
+
+    pthread_mutex_lock(&stripe->mutex);
+    while (stripe->queueHead && stripe->queuedSize + write->size > MAX_STRIPE_QUEUED_SIZE && !stripe->error)
+        pthread_cond_wait(&stripe->doneCond, &stripe->mutex);
+    result = !stripe->error;
+    if (result)
+    {
+        write->next = NULL;
+        if (stripe->queueTail)
+            stripe->queueTail->next = write;
+        else
+            stripe->queueHead = write;
+        stripe->queueTail = write;
+        stripe->queuedSize += write->size;
+        pthread_cond_signal(&stripe->queueCond);
+    }
+    else
+    {
+        write->next = stripe->freeWrites;
+        stripe->freeWrites = write;
+    }
+    pthread_mutex_unlock(&stripe->mutex);
+
+    return result;
+}
+
+static StripeWrite* get_stripe_write(Stripe *stripe)
+{
+    StripeWrite *write;
+
+    pthread_mutex_lock(&stripe->mutex);
+    write = stripe->freeWrites;
+    if (write)
+        stripe->freeWrites = write->next;
+    pthread_mutex_unlock(&stripe->mutex);
+
+    if (!write)
+    {
+        CHK_MALLOC_ORET(write, StripeWrite);
+        if ((write->data = malloc(STRIPE_WRITE_SIZE)) == NULL)
+        {
+            mxf_log_error("Failed to allocate memory for striped mxf page file write\n");
+            free(write);
+            return NULL;
+        }
+    }
+    write->next = NULL;
+
+    return write;
+}
+
+/* wait for all queued writes to complete so that the page files can be read or truncated */
+static int sync_stripes(MXFFileSysData *sysData)
+{
+    int result = 1;
+    int i;
+
+    for (i = 0; i < sysData->numStripes; i++)
+    {
+        if (!submit_stripe_write(&sysData->stripes[i]))
+            result = 0;
+    }
+
+    for (i = 0; i < sysData->numStripes; i++)
+    {
+        Stripe *stripe = &sysData->stripes[i];
+
+        pthread_mutex_lock(&stripe->mutex);
+        while (stripe->queueHead || stripe->busy)
+            pthread_cond_wait(&stripe->doneCond, &stripe->mutex);
+        if (stripe->error)
+            result = 0;
+        pthread_mutex_unlock(&stripe->mutex);
+    }
+
+    return result;
+}
+
+static void free_stripe_writes(StripeWrite *write)
+{
+    StripeWrite *next;
+
+    while (write)
+    {
+        next = write->next;
+        free(write->data);
+        free(write);
+        write = next;
+    }
+}
+
+static void close_stripes(MXFFileSysData *sysData)
+{
+    int i;
+
+    if (!sysData->stripes)
+        return;
+
+    if (!sync_stripes(sysData))
+        mxf_log_error("Failed to write striped mxf page files\n");
+
+    for (i = 0; i < sysData->numStripes; i++)
+    {
+        Stripe *stripe = &sysData->stripes[i];
+
+        if (stripe->threadStarted)
+        {
+            pthread_mutex_lock(&stripe->mutex);
+            stripe->stop = 1;
+            pthread_cond_signal(&stripe->queueCond);
+            pthread_mutex_unlock(&stripe->mutex);
+            pthread_join(stripe->thread, NULL);
+        }
+        if (stripe->fd >= 0)
+            close(stripe->fd);
+
+        free_stripe_writes(stripe->pending);
+        free_stripe_writes(stripe->queueHead);
+        free_stripe_writes(stripe->freeWrites);
+
+        pthread_cond_destroy(&stripe->doneCond);
+        pthread_cond_destroy(&stripe->queueCond);
+        pthread_mutex_destroy(&stripe->mutex);
+    }
+
+    SAFE_FREE(sysData->stripes);
+    sysData->numStripes = 0;
+}
+
+static int open_stripes(MXFFileSysData *sysData)
+{
+    char errorBuf[128];
+    int result;
+    int i;
+
+    CHK_MALLOC_ARRAY_ORET(sysData->stripes, Stripe, sysData->numTemplates);
+    memset(sysData->stripes, 0, sysData->numTemplates * sizeof(Stripe));
+
+    for (i = 0; i < sysData->numTemplates; i++)
+    {
+        Stripe *stripe = &sysData->stripes[i];
+
+        stripe->filenameTemplate = sysData->filenameTemplates[i];
+        stripe->fd = -1;
+        stripe->fdPageIndex = -1;
+        pthread_mutex_init(&stripe->mutex, NULL);
+        pthread_cond_init(&stripe->queueCond, NULL);
+        pthread_cond_init(&stripe->doneCond, NULL);
+        sysData->numStripes++;
+
+        result = pthread_create(&stripe->thread, NULL, stripe_thread, stripe);
+        if (result != 0)
+        {
+            mxf_log_error("Failed to create striped mxf page file writer thread: %s\n",
+                          mxf_strerror(result, errorBuf, sizeof(errorBuf)));
+            return 0;
+        }
+        stripe->threadStarted = 1;
+    }
+
+    return 1;
+}
+
+#endif
+
 
 
 static int open_file(MXFFileSysData *sysData, Page *page)
@@ -251,7 +606,7 @@ static int open_file(MXFFileSysData *sysData, Page *page)
     }
 
     /* open the file */
-    mxf_snprintf(filename, sizeof(filename), sysData->filenameTemplate, page->index);
+    get_page_filename(sysData->filenameTemplates, sysData->numTemplates, page->index, filename, sizeof(filename));
     switch (sysData->mode)
     {
         case READ_MODE:
@@ -282,6 +637,14 @@ static int open_file(MXFFileSysData *sysData, Page *page)
         return 0;
     }
 
+#if !defined(_WIN32)
+    /* the page files are written by the stripe writer threads and so the data can't be buffered here */
+    if (sysData->stripes)
+    {
+        setvbuf(newFile, NULL, _IONBF, 0);
+    }
+#endif
+
     /* create the new file descriptor */
     CHK_MALLOC_OFAIL(newFileDescriptor, FileDescriptor);
     memset(newFileDescriptor, 0, sizeof(*newFileDescriptor));
@@ -316,7 +679,7 @@ fail:
     return 0;
 }
 
-static Page* open_page(MXFFileSysData *sysData, int64_t position)
+static Page* get_page(MXFFileSysData *sysData, int64_t position)
 {
     int i;
     int page;
@@ -364,13 +727,26 @@ static Page* open_page(MXFFileSysData *sysData, int64_t position)
         sysData->numPages++;
     }
 
+    return &sysData->pages[page];
+}
+
+static Page* open_page(MXFFileSysData *sysData, int64_t position)
+{
+    Page *page;
+
+    page = get_page(sysData, position);
+    if (page == 0)
+    {
+        return 0;
+    }
+
     /* open the file */
-    if (!open_file(sysData, &sysData->pages[page]))
+    if (!open_file(sysData, page))
     {
         return 0;
     }
 
-    return &sysData->pages[page];
+    return page;
 }
 
 static uint32_t read_from_page(MXFFileSysData *sysData, uint8_t *data, uint32_t count)
@@ -378,6 +754,13 @@ static uint32_t read_from_page(MXFFileSysData *sysData, uint8_t *data, uint32_t
     uint32_t numRead;
     Page *page;
 
+#if !defined(_WIN32)
+    if (sysData->stripes && !sync_stripes(sysData))
+    {
+        return 0;
+    }
+#endif
+
     page = open_page(sysData, sysData->position);
     if (page == 0)
     {
@@ -418,11 +801,89 @@ static uint32_t read_from_page(MXFFileSysData *sysData, uint8_t *data, uint32_t
     return numRead;
 }
 
+#if !defined(_WIN32)
+static uint32_t write_to_stripe(MXFFileSysData *sysData, const uint8_t *data, uint32_t count)
+{
+    uint32_t numWrite;
+    int64_t offset;
+    Stripe *stripe;
+    StripeWrite *write;
+    Page *page;
+
+    page = get_page(sysData, sysData->position);
+    if (page == 0)
+    {
+        return 0;
+    }
+
+    if (sysData->position > sysData->pageSize * page->index + page->size)
+    {
+        /* can't write from beyond the end of the data in the page */
+        return 0;
+    }
+
+    offset = sysData->position - sysData->pageSize * page->index;
+    numWrite = (count > (uint32_t)(sysData->pageSize - offset)) ?
+        (uint32_t)(sysData->pageSize - offset) : count;
+    if (numWrite > STRIPE_WRITE_SIZE)
+    {
+        numWrite = STRIPE_WRITE_SIZE;
+    }
+
+    /* append to the pending write if the data follows on, otherwise queue it and start a new one */
+    stripe = &sysData->stripes[page->index % sysData->numStripes];
+    write = stripe->pending;
+    if (write &&
+        (write->pageIndex != page->index ||
+            write->offset + write->size != offset ||
+            write->size + numWrite > STRIPE_WRITE_SIZE))
+    {
+        if (!submit_stripe_write(stripe))
+        {
+            return 0;
+        }
+        write = NULL;
+    }
+    if (!write)
+    {
+        write = get_stripe_write(stripe);
+        if (!write)
+        {
+            return 0;
+        }
+        write->pageIndex = page->index;
+        write->create    = !page->wasOpenedBefore;
+        write->offset    = offset;
+        write->size      = 0;
+        stripe->pending  = write;
+
+        page->wasOpenedBefore = 1;
+    }
+
+    memcpy(&write->data[write->size], data, numWrite);
+    write->size += numWrite;
+
+    page->offset = -1; /* invalidate the position of any file descriptor used for reading */
+    page->size = (offset + numWrite > page->size) ? offset + numWrite : page->size;
+
+    sysData->position += numWrite;
+
+    return numWrite;
+}
+#endif
+
 static uint32_t write_to_page(MXFFileSysData *sysData, const uint8_t *data, uint32_t count)
 {
     uint32_t numWrite;
     Page *page;
 
+#if !defined(_WIN32)
+    if (sysData->stripes)
+    {
+        return write_to_stripe(sysData, data, count);
+    }
+#endif
+
     page = open_page(sysData, sysData->position);
     if (page == 0)
     {
@@ -477,8 +938,21 @@ static void page_file_close(MXFFileSysData *sysData)
 {
     FileDescriptor *fd;
     FileDescriptor *nextFd;
+    int i;
+
+#if !defined(_WIN32)
+    close_stripes(sysData);
+#endif
 
-    SAFE_FREE(sysData->filenameTemplate);
+    if (sysData->filenameTemplates)
+    {
+        for (i = 0; i < sysData->numTemplates; i++)
+        {
+            SAFE_FREE(sysData->filenameTemplates[i]);
+        }
+        SAFE_FREE(sysData->filenameTemplates);
+    }
+    sysData->numTemplates = 0;
 
     SAFE_FREE(sysData->pages);
     sysData->numPages = 0;
@@ -509,13 +983,14 @@ static int64_t page_file_size(MXFFileSysData *sysData)
     return sysData->pageSize * (sysData->numPages - 1) + sysData->pages[sysData->numPages - 1].size;
 }
 
-static uint32_t page_file_read(MXFFileSysData *sysData, uint8_t *data, uint32_t count)
+static uint64_t page_file_read_64(MXFFileSysData *sysData, uint8_t *data, uint64_t count)
 {
     uint32_t numRead = 0;
-    uint32_t totalRead = 0;
+    uint64_t totalRead = 0;
     while (totalRead < count)
     {
-        numRead = read_from_page(sysData, &data[totalRead], count - totalRead);
+        numRead = read_from_page(sysData, &data[totalRead],
+                                 (count - totalRead > UINT32_MAX) ? UINT32_MAX : (uint32_t)(count - totalRead));
         totalRead += numRead;
 
         if (numRead == 0)
@@ -527,13 +1002,14 @@ static uint32_t page_file_read(MXFFileSysData *sysData, uint8_t *data, uint32_t
     return totalRead;
 }
 
-static uint32_t page_file_write(MXFFileSysData *sysData, const uint8_t *data, uint32_t count)
+static uint64_t page_file_write_64(MXFFileSysData *sysData, const uint8_t *data, uint64_t count)
 {
     uint32_t numWrite = 0;
-    uint32_t totalWrite = 0;
+    uint64_t totalWrite = 0;
     while (totalWrite < count)
     {
-        numWrite = write_to_page(sysData, &data[totalWrite], count - totalWrite);
+        numWrite = write_to_page(sysData, &data[totalWrite],
+                                 (count - totalWrite > UINT32_MAX) ? UINT32_MAX : (uint32_t)(count - totalWrite));
         totalWrite += numWrite;
 
         if (numWrite == 0)
@@ -545,6 +1021,16 @@ static uint32_t page_file_write(MXFFileSysData *sysData, const uint8_t *data, ui
     return totalWrite;
 }
 
+static uint32_t page_file_read(MXFFileSysData *sysData, uint8_t *data, uint32_t count)
+{
+    return (uint32_t)page_file_read_64(sysData, data, count);
+}
+
+static uint32_t page_file_write(MXFFileSysData *sysData, const uint8_t *data, uint32_t count)
+{
+    return (uint32_t)page_file_write_64(sysData, data, count);
+}
+
 static int page_file_getchar(MXFFileSysData *sysData)
 {
     uint8_t data;
@@ -628,16 +1114,11 @@ static int page_file_is_seekable(MXFFileSysData *sysData)
 
 
 
-int mxf_page_file_open_new(const char *filenameTemplate, int64_t pageSize, MXFPageFile **mxfPageFile)
+static int open_new(const char * const *filenameTemplates, int numTemplates, int striped, int64_t pageSize,
+                    MXFPageFile **mxfPageFile)
 {
     MXFFile *newMXFFile = NULL;
 
-    if (strstr(filenameTemplate, "%d") == NULL)
-    {
-        mxf_log_error("Filename template '%s' doesn't contain %%d\n", filenameTemplate);
-        return 0;
-    }
-
     CHK_MALLOC_ORET(newMXFFile, MXFFile);
     memset(newMXFFile, 0, sizeof(*newMXFFile));
 
@@ -651,17 +1132,28 @@ int mxf_page_file_open_new(const char *filenameTemplate, int64_t pageSize, MXFPa
     newMXFFile->tell            = page_file_tell;
     newMXFFile->is_seekable     = page_file_is_seekable;
     newMXFFile->size            = page_file_size;
+    newMXFFile->read_64         = page_file_read_64;
+    newMXFFile->write_64        = page_file_write_64;
     newMXFFile->free_sys_data   = free_page_file;
 
 
     CHK_MALLOC_OFAIL(newMXFFile->sysData, MXFFileSysData);
     memset(newMXFFile->sysData, 0, sizeof(*newMXFFile->sysData));
 
-    CHK_OFAIL((newMXFFile->sysData->filenameTemplate = strdup(filenameTemplate)) != NULL);
+    CHK_OFAIL(set_filename_templates(newMXFFile->sysData, filenameTemplates, numTemplates));
     newMXFFile->sysData->pageSize = pageSize;
     newMXFFile->sysData->mode = WRITE_MODE;
     newMXFFile->sysData->mxfPageFile.mxfFile = newMXFFile;
 
+#if !defined(_WIN32)
+    if (striped)
+    {
+        CHK_OFAIL(open_stripes(newMXFFile->sysData));
+    }
+#else
+    (void)striped;
+#endif
+
 
     *mxfPageFile = &newMXFFile->sysData->mxfPageFile;
     return 1;
@@ -674,36 +1166,29 @@ fail:
     return 0;
 }
 
-int mxf_page_file_open_read(const char *filenameTemplate, MXFPageFile **mxfPageFile)
+static int open_read(const char * const *filenameTemplates, int numTemplates, MXFPageFile **mxfPageFile)
 {
     MXFFile *newMXFFile = NULL;
     int pageCount;
     int allocatedPages;
     char filename[4096];
-    FILE *file;
     struct stat st;
     char errorBuf[128];
+    int i;
 
 
-    if (strstr(filenameTemplate, "%d") == NULL)
+    for (i = 0; i < numTemplates; i++)
     {
-        mxf_log_error("Filename template '%s' doesn't contain %%d\n", filenameTemplate);
-        return 0;
-    }
-
-    /* count number of page files */
-    pageCount = 0;
-    for(;;)
-    {
-        mxf_snprintf(filename, sizeof(filename), filenameTemplate, pageCount);
-        if ((file = fopen(filename, "rb")) == NULL)
+        if (strstr(filenameTemplates[i], "%d") == NULL)
         {
-            break;
+            mxf_log_error("Filename template '%s' doesn't contain %%d\n", filenameTemplates[i]);
+            return 0;
         }
-        fclose(file);
-        pageCount++;
     }
 
+    /* count number of page files */
+    pageCount = count_page_files(filenameTemplates, numTemplates);
+
     if (pageCount == 0)
     {
         /* file not found */
@@ -724,20 +1209,22 @@ int mxf_page_file_open_read(const char *filenameTemplate, MXFPageFile **mxfPageF
     newMXFFile->tell            = page_file_tell;
     newMXFFile->is_seekable     = page_file_is_seekable;
     newMXFFile->size            = page_file_size;
+    newMXFFile->read_64         = page_file_read_64;
+    newMXFFile->write_64        = page_file_write_64;
     newMXFFile->free_sys_data   = free_page_file;
 
 
     CHK_MALLOC_OFAIL(newMXFFile->sysData, MXFFileSysData);
     memset(newMXFFile->sysData, 0, sizeof(*newMXFFile->sysData));
 
-    CHK_OFAIL((newMXFFile->sysData->filenameTemplate = strdup(filenameTemplate)) != NULL);
+    CHK_OFAIL(set_filename_templates(newMXFFile->sysData, filenameTemplates, numTemplates));
     newMXFFile->sysData->mode = READ_MODE;
     newMXFFile->sysData->mxfPageFile.mxfFile = newMXFFile;
 
 
 
     /* get the page size from the first file */
-    mxf_snprintf(filename, sizeof(filename), filenameTemplate, 0);
+    get_page_filename(newMXFFile->sysData->filenameTemplates, numTemplates, 0, filename, sizeof(filename));
     if (stat(filename, &st) != 0)
     {
         mxf_log_error("Failed to stat file '%s': %s\n", filename, mxf_strerror(errno, errorBuf, sizeof(errorBuf)));
@@ -747,7 +1234,7 @@ int mxf_page_file_open_read(const char *filenameTemplate, MXFPageFile **mxfPageF
 
     /* allocate pages */
     allocatedPages = (pageCount < PAGE_ALLOC_INCR) ? PAGE_ALLOC_INCR : pageCount;
-    CHK_MALLOC_ARRAY_ORET(newMXFFile->sysData->pages, Page, allocatedPages);
+    CHK_MALLOC_ARRAY_OFAIL(newMXFFile->sysData->pages, Page, allocatedPages);
     memset(newMXFFile->sysData->pages, 0, allocatedPages * sizeof(Page));
     newMXFFile->sysData->numPages = pageCount;
     newMXFFile->sysData->numPagesAllocated = allocatedPages;
@@ -758,7 +1245,8 @@ int mxf_page_file_open_read(const char *filenameTemplate, MXFPageFile **mxfPageF
     }
 
     /* set the file size of the last file, which could be less than newMXFFile->sysData->pageSize */
-    mxf_snprintf(filename, sizeof(filename), filenameTemplate, newMXFFile->sysData->numPages - 1);
+    get_page_filename(newMXFFile->sysData->filenameTemplates, numTemplates, newMXFFile->sysData->numPages - 1,
+                      filename, sizeof(filename));
     if (stat(filename, &st) != 0)
     {
         mxf_log_error("Failed to stat file '%s': %s\n", filename, mxf_strerror(errno, errorBuf, sizeof(errorBuf)));
@@ -778,6 +1266,41 @@ fail:
     return 0;
 }
 
+
+
+int mxf_page_file_open_new(const char *filenameTemplate, int64_t pageSize, MXFPageFile **mxfPageFile)
+{
+    return open_new(&filenameTemplate, 1, 0, pageSize, mxfPageFile);
+}
+
+int mxf_page_file_open_new_striped(const char * const *filenameTemplates, int numTemplates, int64_t pageSize,
+                                   MXFPageFile **mxfPageFile)
+{
+#if defined(_WIN32)
+    (void)filenameTemplates;
+    (void)numTemplates;
+    (void)pageSize;
+    (void)mxfPageFile;
+    mxf_log_error("Striped mxf page file writing is not supported on Windows\n");
+    return 0;
+#else
+    return open_new(filenameTemplates, numTemplates, 1, pageSize, mxfPageFile);
+#endif
+}
+
+int mxf_page_file_open_read(const char *filenameTemplate, MXFPageFile **mxfPageFile)
+{
+    return open_read(&filenameTemplate, 1, mxfPageFile);
+}
+
+int mxf_page_file_open_read_striped(const char * const *filenameTemplates, int numTemplates,
+                                    MXFPageFile **mxfPageFile)
+{
+    CHK_ORET(numTemplates > 0);
+
+    return open_read(filenameTemplates, numTemplates, mxfPageFile);
+}
+
 int mxf_page_file_open_modify(const char *filenameTemplate, int64_t pageSize, MXFPageFile **mxfPageFile)
 {
     MXFFile *newMXFFile = NULL;
@@ -845,13 +1368,15 @@ int mxf_page_file_open_modify(const char *filenameTemplate, int64_t pageSize, MX
     newMXFFile->tell            = page_file_tell;
     newMXFFile->is_seekable     = page_file_is_seekable;
     newMXFFile->size            = page_file_size;
+    newMXFFile->read_64         = page_file_read_64;
+    newMXFFile->write_64        = page_file_write_64;
     newMXFFile->free_sys_data   = free_page_file;
 
 
     CHK_MALLOC_OFAIL(newMXFFile->sysData, MXFFileSysData);
     memset(newMXFFile->sysData, 0, sizeof(*newMXFFile->sysData));
 
-    CHK_OFAIL((newMXFFile->sysData->filenameTemplate = strdup(filenameTemplate)) != NULL);
+    CHK_OFAIL(set_filename_templates(newMXFFile->sysData, &filenameTemplate, 1));
     newMXFFile->sysData->pageSize = pageSize;
     newMXFFile->sysData->mode = MODIFY_MODE;
     newMXFFile->sysData->mxfPageFile.mxfFile = newMXFFile;
@@ -870,7 +1395,8 @@ int mxf_page_file_open_modify(const char *filenameTemplate, int64_t pageSize, MX
     }
 
     /* set the files size of the last file, which could have size < pageSize */
-    mxf_snprintf(filename, sizeof(filename), filenameTemplate, newMXFFile->sysData->numPages - 1);
+    get_page_filename(newMXFFile->sysData->filenameTemplates, 1, newMXFFile->sysData->numPages - 1,
+                      filename, sizeof(filename));
     fileSize = disk_file_size(filename);
     if (fileSize < 0)
     {
@@ -923,6 +1449,13 @@ int mxf_page_file_forward_truncate(MXFPageFile *mxfPageFile)
         return 0;
     }
 
+#if !defined(_WIN32)
+    if (sysData->stripes && !sync_stripes(sysData))
+    {
+        return 0;
+    }
+#endif
+
     /* close and truncate to zero length page files before the current one */
     for (i = 0; i < page; i++)
     {
@@ -957,7 +1490,8 @@ int mxf_page_file_forward_truncate(MXFPageFile *mxfPageFile)
         }
 
         /* truncate the file to zero length */
-        mxf_snprintf(filename, sizeof(filename), sysData->filenameTemplate, sysData->pages[i].index);
+        get_page_filename(sysData->filenameTemplates, sysData->numTemplates, sysData->pages[i].index,
+                          filename, sizeof(filename));
 
 #if defined(_WIN32)
         /* WIN32 does not have truncate() so open the file with _O_TRUNC then close it */
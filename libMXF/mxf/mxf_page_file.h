@@ -48,6 +48,13 @@ int mxf_page_file_open_new(const char *filenameTemplate, int64_t pageSize, MXFPa
 int mxf_page_file_open_read(const char *filenameTemplate, MXFPageFile **mxfPageFile);
 int mxf_page_file_open_modify(const char *filenameTemplate, int64_t pageSize, MXFPageFile **mxfPageFile);
 
+/* page i is stored in a file using filenameTemplates[i % numTemplates], e.g. to spread the pages over multiple
+   disks. The pages are written by a separate thread for each template. Reads wait for queued writes to complete */
+int mxf_page_file_open_new_striped(const char * const *filenameTemplates, int numTemplates, int64_t pageSize,
+                                   MXFPageFile **mxfPageFile);
+int mxf_page_file_open_read_striped(const char * const *filenameTemplates, int numTemplates,
+                                    MXFPageFile **mxfPageFile);
+
 MXFFile* mxf_page_file_get_file(MXFPageFile *mxfPageFile);
 
 int64_t mxf_page_file_get_page_size(MXFPageFile *mxfPageFile);
@@ -45,11 +45,13 @@
 
 
 
+#define UID_INDEX_MIN_SIZE      128
+
+
+
 static void free_primer_pack_entry_in_list(void *data);
-static int entry_eq_uid(void *data, void *info);
-static int entry_eq_tag(void *data, void *info);
 static int add_primer_pack_entry(MXFPrimerPack *primerPack, MXFPrimerPackEntry *entry);
-static int create_primer_pack_entry(MXFPrimerPack *primerPack, MXFPrimerPackEntry **entry);
+static int create_primer_pack_entry(MXFPrimerPack *primerPack, mxfLocalTag localTag, const mxfUID *uid);
 static void free_primer_pack_entry(MXFPrimerPackEntry **entry);
 
 
@@ -66,37 +68,143 @@ static void free_primer_pack_entry_in_list(void *data)
     free_primer_pack_entry(&entry);
 }
 
-static int entry_eq_uid(void *data, void *info)
+static MXFPrimerPackEntry* find_tag_entry(MXFPrimerPack *primerPack, mxfLocalTag localTag)
+{
+    if (primerPack->tagIndex[localTag >> 8] == NULL)
+    {
+        return NULL;
+    }
+
+    return primerPack->tagIndex[localTag >> 8][localTag & 0xff];
+}
+
+static size_t hash_uid(const mxfUID *uid)
 {
-    assert(data != NULL && info != NULL);
+    const uint8_t *bytes = (const uint8_t*)uid;
+    uint32_t hash = 2166136261U;
+    int i;
+
+    for (i = 0; i < mxfUID_extlen; i++)
+    {
+        hash ^= bytes[i];
+        hash *= 16777619U;
+    }
+
+    return hash;
+}
+
+static MXFPrimerPackEntry* find_uid_entry(MXFPrimerPack *primerPack, const mxfUID *uid)
+{
+    size_t mask = primerPack->uidIndexSize - 1;
+    size_t i;
+
+    if (primerPack->uidIndex == NULL)
+    {
+        return NULL;
+    }
 
-    return mxf_equals_uid((mxfUID*)info, &((MXFPrimerPackEntry*)data)->uid);
+    i = hash_uid(uid) & mask;
+    while (primerPack->uidIndex[i] != NULL)
+    {
+        if (mxf_equals_uid(uid, &primerPack->uidIndex[i]->uid))
+        {
+            return primerPack->uidIndex[i];
+        }
+        i = (i + 1) & mask;
+    }
+
+    return NULL;
 }
 
-static int entry_eq_tag(void *data, void *info)
+/* Note: the first entry for a UID is kept if the primer has duplicates, matching a search of the entries list */
+static void insert_uid_entry(MXFPrimerPack *primerPack, MXFPrimerPackEntry *entry)
 {
-    assert(data != NULL && info != NULL);
+    size_t mask = primerPack->uidIndexSize - 1;
+    size_t i = hash_uid(&entry->uid) & mask;
 
-    return *(mxfLocalTag*)info == ((MXFPrimerPackEntry*)data)->localTag;
+    while (primerPack->uidIndex[i] != NULL)
+    {
+        if (mxf_equals_uid(&entry->uid, &primerPack->uidIndex[i]->uid))
+        {
+            return;
+        }
+        i = (i + 1) & mask;
+    }
+
+    primerPack->uidIndex[i] = entry;
+}
+
+static int rebuild_uid_index(MXFPrimerPack *primerPack, size_t minCount)
+{
+    MXFPrimerPackEntry **newUIDIndex;
+    MXFListIterator iter;
+    size_t newSize;
+
+    newSize = UID_INDEX_MIN_SIZE;
+    while (newSize - newSize / 4 <= minCount)
+    {
+        newSize *= 2;
+    }
+
+    CHK_MALLOC_ARRAY_ORET(newUIDIndex, MXFPrimerPackEntry*, newSize);
+    memset(newUIDIndex, 0, newSize * sizeof(MXFPrimerPackEntry*));
+
+    SAFE_FREE(primerPack->uidIndex);
+    primerPack->uidIndex     = newUIDIndex;
+    primerPack->uidIndexSize = newSize;
+
+    mxf_initialise_list_iter(&iter, &primerPack->entries);
+    while (mxf_next_list_iter_element(&iter))
+    {
+        insert_uid_entry(primerPack, (MXFPrimerPackEntry*)mxf_get_iter_element(&iter));
+    }
+
+    return 1;
 }
 
 static int add_primer_pack_entry(MXFPrimerPack *primerPack, MXFPrimerPackEntry *entry)
 {
+    size_t numEntries = mxf_get_list_length(&primerPack->entries) + 1;
+    mxfLocalTag tag = entry->localTag;
+
+    /* allocate index space before adding to the list so that the indexes stay in sync */
+    if (numEntries >= primerPack->uidIndexSize - primerPack->uidIndexSize / 4)
+    {
+        CHK_ORET(rebuild_uid_index(primerPack, numEntries * 2));
+    }
+    if (primerPack->tagIndex[tag >> 8] == NULL)
+    {
+        CHK_MALLOC_ARRAY_ORET(primerPack->tagIndex[tag >> 8], MXFPrimerPackEntry*, 256);
+        memset(primerPack->tagIndex[tag >> 8], 0, 256 * sizeof(MXFPrimerPackEntry*));
+    }
+
     CHK_ORET(mxf_append_list_element(&primerPack->entries, (void*)entry));
 
+    insert_uid_entry(primerPack, entry);
+    /* the first entry for a tag is kept if the primer has duplicates */
+    if (primerPack->tagIndex[tag >> 8][tag & 0xff] == NULL)
+    {
+        primerPack->tagIndex[tag >> 8][tag & 0xff] = entry;
+    }
+    if (tag >= 0x8000)
+    {
+        primerPack->usedDynamicTags[(tag - 0x8000) >> 5] |= 1U << (tag & 0x1f);
+    }
+
     return 1;
 }
 
-static int create_primer_pack_entry(MXFPrimerPack *primerPack, MXFPrimerPackEntry **entry)
+static int create_primer_pack_entry(MXFPrimerPack *primerPack, mxfLocalTag localTag, const mxfUID *uid)
 {
     MXFPrimerPackEntry *newEntry;
 
     CHK_MALLOC_ORET(newEntry, MXFPrimerPackEntry);
     memset(newEntry, 0, sizeof(MXFPrimerPackEntry));
+    newEntry->localTag = localTag;
+    newEntry->uid = *uid;
 
     CHK_OFAIL(add_primer_pack_entry(primerPack, newEntry));
 
-    *entry = newEntry;
     return 1;
 
 fail:
@@ -136,48 +244,50 @@ int mxf_create_primer_pack(MXFPrimerPack **primerPack)
 
 void mxf_free_primer_pack(MXFPrimerPack **primerPack)
 {
+    int i;
+
     if (*primerPack == NULL)
     {
         return;
     }
 
     mxf_clear_list(&(*primerPack)->entries);
+    for (i = 0; i < 256; i++)
+    {
+        SAFE_FREE((*primerPack)->tagIndex[i]);
+    }
+    SAFE_FREE((*primerPack)->uidIndex);
     SAFE_FREE(*primerPack);
 }
 
 int mxf_register_primer_entry(MXFPrimerPack *primerPack, const mxfUID *itemUID, mxfLocalTag newTag,
                               mxfLocalTag *assignedTag)
 {
-    MXFPrimerPackEntry *newEntry;
+    MXFPrimerPackEntry *entry;
     mxfLocalTag tag;
-    void *result;
 
     /* if already exists, then return already assigned tag */
-    if ((result = mxf_find_list_element(&primerPack->entries, (void*)itemUID, entry_eq_uid)) != NULL)
+    if ((entry = find_uid_entry(primerPack, itemUID)) != NULL)
     {
-        *assignedTag = ((MXFPrimerPackEntry*)result)->localTag;
+        *assignedTag = entry->localTag;
     }
     /* use the tag */
     else if (newTag != g_Null_LocalTag)
     {
-        if (mxf_find_list_element(&primerPack->entries, (void*)&newTag, entry_eq_tag) != NULL)
+        if (find_tag_entry(primerPack, newTag) != NULL)
         {
             mxf_log_error("Local tag %x already in use" LOG_LOC_FORMAT, newTag, LOG_LOC_PARAMS);
             return 0;
         }
 
-        CHK_ORET(create_primer_pack_entry(primerPack, &newEntry));
-        newEntry->localTag = newTag;
-        newEntry->uid = *itemUID;
+        CHK_ORET(create_primer_pack_entry(primerPack, newTag, itemUID));
         *assignedTag = newTag;
     }
     /* create a new entry with new tag */
     else
     {
         CHK_ORET(mxf_create_item_tag(primerPack, &tag));
-        CHK_ORET(create_primer_pack_entry(primerPack, &newEntry));
-        newEntry->localTag = tag;
-        newEntry->uid = *itemUID;
+        CHK_ORET(create_primer_pack_entry(primerPack, tag, itemUID));
         *assignedTag = tag;
     }
 
@@ -187,11 +297,11 @@ int mxf_register_primer_entry(MXFPrimerPack *primerPack, const mxfUID *itemUID,
 
 int mxf_get_item_key(MXFPrimerPack *primerPack, mxfLocalTag localTag, mxfKey *key)
 {
-    void *result;
+    MXFPrimerPackEntry *entry;
 
-    if ((result = mxf_find_list_element(&primerPack->entries, (void*)&localTag, entry_eq_tag)) != NULL)
+    if ((entry = find_tag_entry(primerPack, localTag)) != NULL)
     {
-        *key = ((MXFPrimerPackEntry*)result)->uid;
+        *key = entry->uid;
         return 1;
     }
 
@@ -200,11 +310,11 @@ int mxf_get_item_key(MXFPrimerPack *primerPack, mxfLocalTag localTag, mxfKey *ke
 
 int mxf_get_item_tag(MXFPrimerPack *primerPack, const mxfKey *key, mxfLocalTag *localTag)
 {
-    void *result;
+    MXFPrimerPackEntry *entry;
 
-    if ((result = mxf_find_list_element(&primerPack->entries, (void*)(const mxfUID*)key, entry_eq_uid)) != NULL)
+    if ((entry = find_uid_entry(primerPack, (const mxfUID*)key)) != NULL)
     {
-        *localTag = ((MXFPrimerPackEntry*)result)->localTag;
+        *localTag = entry->localTag;
         return 1;
     }
 
@@ -214,17 +324,28 @@ int mxf_get_item_tag(MXFPrimerPack *primerPack, const mxfKey *key, mxfLocalTag *
 int mxf_create_item_tag(MXFPrimerPack *primerPack, mxfLocalTag *localTag)
 {
     mxfLocalTag tag;
+    uint32_t usedTags;
 
     for(;;)
     {
-        tag = primerPack->nextTag--;
+        tag = primerPack->nextTag;
         if (tag < 0x8000)
         {
             mxf_log_error("Could not create a unique tag - reached the end of the allowed dynamic tag values"
                           LOG_LOC_FORMAT, LOG_LOC_PARAMS);
             return 0;
         }
-        if (mxf_find_list_element(&primerPack->entries, (void*)&tag, entry_eq_tag) == NULL)
+
+        /* skip blocks of 32 tags that are all in use */
+        usedTags = primerPack->usedDynamicTags[(tag - 0x8000) >> 5];
+        if (usedTags == 0xffffffff)
+        {
+            primerPack->nextTag = (mxfLocalTag)((tag & ~0x1f) - 1);
+            continue;
+        }
+
+        primerPack->nextTag--;
+        if (!(usedTags & (1U << (tag & 0x1f))))
         {
             break;
         }
@@ -240,7 +361,6 @@ int mxf_read_primer_pack(MXFFile *mxfFile, MXFPrimerPack **primerPack)
     MXFPrimerPack *newPrimerPack = NULL;
     uint32_t itemLength;
     uint32_t numberOfItems;
-    MXFPrimerPackEntry *newEntry = NULL;
     mxfLocalTag localTag;
     mxfUID uid;
     uint32_t i;
@@ -254,9 +374,7 @@ int mxf_read_primer_pack(MXFFile *mxfFile, MXFPrimerPack **primerPack)
         CHK_OFAIL(mxf_read_local_tag(mxfFile, &localTag));
         CHK_OFAIL(mxf_read_uid(mxfFile, &uid));
 
-        CHK_OFAIL(create_primer_pack_entry(newPrimerPack, &newEntry));
-        newEntry->localTag = localTag;
-        newEntry->uid = uid;
+        CHK_OFAIL(create_primer_pack_entry(newPrimerPack, localTag, &uid));
     }
 
     *primerPack = newPrimerPack;
@@ -52,6 +52,11 @@ typedef struct
 {
     mxfLocalTag nextTag;
     MXFList entries;
+    /* lookup tables built alongside the entries list */
+    MXFPrimerPackEntry **tagIndex[256];     /* indexed by the tag high byte, pages allocated on demand */
+    MXFPrimerPackEntry **uidIndex;          /* open-addressing hash table keyed by UID */
+    size_t uidIndexSize;
+    uint32_t usedDynamicTags[1024];         /* bitmap of dynamic tags 0x8000 - 0xffff in use */
 } MXFPrimerPack;
 
 
@@ -0,0 +1,381 @@
+/*
+ * Copyright (C) 2017, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Author: Philip de Nier
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <pthread.h>
+
+#include <mxf/mxf.h>
+#include <mxf/mxf_readahead_file.h>
+#include <mxf/mxf_macros.h>
+
+
+
+typedef struct
+{
+    uint8_t *data;
+    int64_t offset;
+    uint32_t size;
+} ReadAheadBuffer;
+
+struct MXFFileSysData
+{
+    MXFFile *target;
+    int isSeekable;
+
+    pthread_t thread;
+    int threadStarted;
+    pthread_mutex_t mutex;          /* protects the state below */
+    pthread_cond_t fillCond;        /* signals the I/O thread that there is work or it must stop */
+    pthread_cond_t readyCond;       /* signals the reader that a buffer has been filled */
+    pthread_mutex_t targetMutex;    /* serializes access to the target file */
+
+    ReadAheadBuffer *buffers;
+    uint32_t numBuffers;
+    uint32_t bufferSize;
+    uint32_t first;                 /* ring index of the first filled buffer */
+    uint32_t numFilled;
+    int64_t fillPosition;           /* target file position for the next buffer fill */
+    int fillEOF;                    /* cleared on seek or when the target has grown, e.g. for growing files */
+    uint32_t generation;            /* incremented when the buffers are discarded */
+    int stop;
+
+    int64_t position;
+    int isEOF;
+};
+
+
+static void* readahead_thread(void *arg)
+{
+    MXFFileSysData *sysData = (MXFFileSysData*)arg;
+    ReadAheadBuffer *buffer;
+    uint32_t generation;
+    int64_t offset;
+    uint32_t numRead;
+
+    pthread_mutex_lock(&sysData->mutex);
+    while (!sysData->stop) {
+        if (sysData->fillEOF || sysData->numFilled == sysData->numBuffers) {
+            pthread_cond_wait(&sysData->fillCond, &sysData->mutex);
+            continue;
+        }
+
+        /* the buffer following the filled buffers is not accessed by the reader */
+        buffer = &sysData->buffers[(sysData->first + sysData->numFilled) % sysData->numBuffers];
+        generation = sysData->generation;
+        offset = sysData->fillPosition;
+        pthread_mutex_unlock(&sysData->mutex);
+
+        /* the target is seeked after reaching its end to retry reading when the file is growing */
+        pthread_mutex_lock(&sysData->targetMutex);
+        if ((mxf_file_tell(sysData->target) != offset || mxf_file_eof(sysData->target)) &&
+            !mxf_file_seek(sysData->target, offset, SEEK_SET))
+            numRead = 0;
+        else
+            numRead = mxf_file_read(sysData->target, buffer->data, sysData->bufferSize);
+        pthread_mutex_unlock(&sysData->targetMutex);
+
+        pthread_mutex_lock(&sysData->mutex);
+        if (generation == sysData->generation) {
+            buffer->offset = offset;
+            buffer->size   = numRead;
+            if (numRead > 0)
+                sysData->numFilled++;
+            sysData->fillPosition += numRead;
+            if (numRead < sysData->bufferSize)
+                sysData->fillEOF = 1;
+            pthread_cond_signal(&sysData->readyCond);
+        }
+    }
+    pthread_mutex_unlock(&sysData->mutex);
+
+    return NULL;
+}
+
+static int in_window(MXFFileSysData *sysData, int64_t position)
+{
+    int64_t windowStart;
+
+    if (sysData->numFilled > 0)
+        windowStart = sysData->buffers[sysData->first].offset;
+    else
+        windowStart = sysData->fillPosition;
+
+    /* positions up to a buffer beyond the fill position are reached by reading ahead */
+    return position >= windowStart && position < sysData->fillPosition + sysData->bufferSize;
+}
+
+static void discard_buffers(MXFFileSysData *sysData, int64_t position)
+{
+    sysData->generation++;
+    sysData->numFilled    = 0;
+    sysData->fillPosition = position;
+    sysData->fillEOF      = 0;
+    pthread_cond_signal(&sysData->fillCond);
+}
+
+
+static void readahead_file_close(MXFFileSysData *sysData)
+{
+    if (sysData->threadStarted) {
+        pthread_mutex_lock(&sysData->mutex);
+        sysData->stop = 1;
+        pthread_cond_signal(&sysData->fillCond);
+        pthread_mutex_unlock(&sysData->mutex);
+
+        pthread_join(sysData->thread, NULL);
+        sysData->threadStarted = 0;
+    }
+
+    mxf_file_close(&sysData->target);
+}
+
+static uint32_t readahead_file_read(MXFFileSysData *sysData, uint8_t *data, uint32_t count)
+{
+    ReadAheadBuffer *buffer;
+    uint32_t totalRead = 0;
+    uint32_t numRead;
+
+    pthread_mutex_lock(&sysData->mutex);
+    while (totalRead < count) {
+        if (!in_window(sysData, sysData->position)) {
+            discard_buffers(sysData, sysData->position);
+            continue;
+        }
+
+        if (sysData->numFilled > 0) {
+            buffer = &sysData->buffers[sysData->first];
+            if (sysData->position >= buffer->offset + buffer->size) {
+                /* release the buffer for the I/O thread */
+                sysData->first = (sysData->first + 1) % sysData->numBuffers;
+                sysData->numFilled--;
+                pthread_cond_signal(&sysData->fillCond);
+                continue;
+            }
+
+            numRead = (uint32_t)(buffer->offset + buffer->size - sysData->position);
+            if (numRead > count - totalRead)
+                numRead = count - totalRead;
+            memcpy(&data[totalRead], &buffer->data[sysData->position - buffer->offset], numRead);
+            totalRead += numRead;
+            sysData->position += numRead;
+        } else if (sysData->fillEOF) {
+            /* read again if the target file has grown since the end was reached */
+            pthread_mutex_lock(&sysData->targetMutex);
+            if (mxf_file_size(sysData->target) > sysData->fillPosition) {
+                pthread_mutex_unlock(&sysData->targetMutex);
+                sysData->fillEOF = 0;
+                pthread_cond_signal(&sysData->fillCond);
+                continue;
+            }
+            pthread_mutex_unlock(&sysData->targetMutex);
+            sysData->isEOF = 1;
+            break;
+        } else {
+            pthread_cond_wait(&sysData->readyCond, &sysData->mutex);
+        }
+    }
+    pthread_mutex_unlock(&sysData->mutex);
+
+    return totalRead;
+}
+
+static uint32_t readahead_file_write(MXFFileSysData *sysData, const uint8_t *data, uint32_t count)
+{
+    (void)sysData;
+    (void)data;
+    (void)count;
+    return 0;
+}
+
+static int readahead_file_getchar(MXFFileSysData *sysData)
+{
+    uint8_t c;
+    if (readahead_file_read(sysData, &c, 1) != 1)
+        return EOF;
+
+    return c;
+}
+
+static int readahead_file_putchar(MXFFileSysData *sysData, int c)
+{
+    (void)sysData;
+    (void)c;
+    return EOF;
+}
+
+static int readahead_file_eof(MXFFileSysData *sysData)
+{
+    return sysData->isEOF;
+}
+
+static int readahead_file_seek(MXFFileSysData *sysData, int64_t offset, int whence)
+{
+    int64_t newPosition;
+
+    if (whence == SEEK_SET) {
+        newPosition = offset;
+    } else if (whence == SEEK_CUR) {
+        newPosition = sysData->position + offset;
+    } else if (whence == SEEK_END) {
+        pthread_mutex_lock(&sysData->targetMutex);
+        newPosition = mxf_file_size(sysData->target) + offset;
+        pthread_mutex_unlock(&sysData->targetMutex);
+    } else {
+        return 0;
+    }
+
+    if (newPosition < 0 || (!sysData->isSeekable && newPosition < sysData->position))
+        return 0;
+
+    pthread_mutex_lock(&sysData->mutex);
+    sysData->position = newPosition;
+    sysData->isEOF = 0;
+    /* discard early to allow the I/O thread to start reading at the new position */
+    if (!in_window(sysData, newPosition)) {
+        discard_buffers(sysData, newPosition);
+    } else if (sysData->fillEOF) {
+        sysData->fillEOF = 0;
+        pthread_cond_signal(&sysData->fillCond);
+    }
+    pthread_mutex_unlock(&sysData->mutex);
+
+    return 1;
+}
+
+static int64_t readahead_file_tell(MXFFileSysData *sysData)
+{
+    return sysData->position;
+}
+
+static int readahead_file_is_seekable(MXFFileSysData *sysData)
+{
+    return sysData->isSeekable;
+}
+
+static int64_t readahead_file_size(MXFFileSysData *sysData)
+{
+    int64_t size;
+
+    pthread_mutex_lock(&sysData->targetMutex);
+    size = mxf_file_size(sysData->target);
+    pthread_mutex_unlock(&sysData->targetMutex);
+
+    return size;
+}
+
+static void free_readahead_file(MXFFileSysData *sysData)
+{
+    uint32_t i;
+
+    if (!sysData)
+        return;
+
+    if (sysData->buffers) {
+        for (i = 0; i < sysData->numBuffers; i++)
+            free(sysData->buffers[i].data);
+        free(sysData->buffers);
+    }
+    pthread_mutex_destroy(&sysData->mutex);
+    pthread_cond_destroy(&sysData->fillCond);
+    pthread_cond_destroy(&sysData->readyCond);
+    pthread_mutex_destroy(&sysData->targetMutex);
+
+    free(sysData);
+}
+
+
+int mxf_readahead_file_wrap(MXFFile *target, uint32_t bufferSize, uint32_t numBuffers, MXFFile **mxfFile)
+{
+    MXFFile *newMXFFile = NULL;
+    MXFFileSysData *newReadAheadFile = NULL;
+    uint32_t i;
+
+    if (bufferSize == 0)
+        bufferSize = MXF_READAHEAD_DEFAULT_BUFFER_SIZE;
+    if (numBuffers == 0)
+        numBuffers = MXF_READAHEAD_DEFAULT_NUM_BUFFERS;
+
+    CHK_MALLOC_ORET(newMXFFile, MXFFile);
+    memset(newMXFFile, 0, sizeof(MXFFile));
+    CHK_MALLOC_OFAIL(newReadAheadFile, MXFFileSysData);
+    memset(newReadAheadFile, 0, sizeof(MXFFileSysData));
+
+    pthread_mutex_init(&newReadAheadFile->mutex, NULL);
+    pthread_cond_init(&newReadAheadFile->fillCond, NULL);
+    pthread_cond_init(&newReadAheadFile->readyCond, NULL);
+    pthread_mutex_init(&newReadAheadFile->targetMutex, NULL);
+
+    CHK_MALLOC_ARRAY_OFAIL(newReadAheadFile->buffers, ReadAheadBuffer, numBuffers);
+    memset(newReadAheadFile->buffers, 0, numBuffers * sizeof(ReadAheadBuffer));
+    newReadAheadFile->numBuffers = numBuffers;
+    for (i = 0; i < numBuffers; i++)
+        CHK_MALLOC_ARRAY_OFAIL(newReadAheadFile->buffers[i].data, uint8_t, bufferSize);
+
+    newReadAheadFile->target       = target;
+    newReadAheadFile->isSeekable   = mxf_file_is_seekable(target);
+    newReadAheadFile->bufferSize   = bufferSize;
+    newReadAheadFile->position     = mxf_file_tell(target);
+    newReadAheadFile->fillPosition = newReadAheadFile->position;
+
+    CHK_OFAIL(pthread_create(&newReadAheadFile->thread, NULL, readahead_thread, newReadAheadFile) == 0);
+    newReadAheadFile->threadStarted = 1;
+
+    newMXFFile->close         = readahead_file_close;
+    newMXFFile->read          = readahead_file_read;
+    newMXFFile->write         = readahead_file_write;
+    newMXFFile->get_char      = readahead_file_getchar;
+    newMXFFile->put_char      = readahead_file_putchar;
+    newMXFFile->eof           = readahead_file_eof;
+    newMXFFile->seek          = readahead_file_seek;
+    newMXFFile->tell          = readahead_file_tell;
+    newMXFFile->is_seekable   = readahead_file_is_seekable;
+    newMXFFile->size          = readahead_file_size;
+    newMXFFile->free_sys_data = free_readahead_file;
+    newMXFFile->sysData       = newReadAheadFile;
+    newMXFFile->minLLen       = target->minLLen;
+    newMXFFile->runinLen      = target->runinLen;
+
+
+    *mxfFile = newMXFFile;
+    return 1;
+
+fail:
+    free_readahead_file(newReadAheadFile);
+    SAFE_FREE(newMXFFile);
+    return 0;
+}
+
@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2017, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Author: Philip de Nier
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef MXF_READAHEAD_FILE_H_
+#define MXF_READAHEAD_FILE_H_
+
+
+#include <mxf/mxf_file.h>
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+
+/* default size and number of buffers used when the values passed to mxf_readahead_file_wrap are 0 */
+#define MXF_READAHEAD_DEFAULT_BUFFER_SIZE    (4 * 1024 * 1024)
+#define MXF_READAHEAD_DEFAULT_NUM_BUFFERS    4
+
+
+/* wrap a file opened for reading with a file that reads ahead of the current position in a separate
+   I/O thread, filling a ring of numBuffers buffers of size bufferSize.
+   A seek outside the buffered window discards the buffers and reading restarts at the new position.
+   The target file is owned by the wrapper and is closed when the wrapper is closed */
+int mxf_readahead_file_wrap(MXFFile *target, uint32_t bufferSize, uint32_t numBuffers, MXFFile **mxfFile);
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif
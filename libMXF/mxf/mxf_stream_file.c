@@ -86,9 +86,9 @@ static void stream_file_close(MXFFileSysData *sysData)
         mxf_file_close(&sysData->target);
 }
 
-static uint32_t stream_file_read(MXFFileSysData *sysData, uint8_t *data, uint32_t count)
+static uint64_t stream_file_read_64(MXFFileSysData *sysData, uint8_t *data, uint64_t count)
 {
-    uint32_t result;
+    uint64_t result;
 
     if (!sysData->readOnly)
         return 0;
@@ -96,16 +96,16 @@ static uint32_t stream_file_read(MXFFileSysData *sysData, uint8_t *data, uint32_
     if (sysData->position > sysData->headPosition && !read_skip(sysData))
         return 0;
 
-    result = mxf_file_read(sysData->target, data, count);
+    result = mxf_file_read_64(sysData->target, data, count);
     sysData->headPosition += result;
     sysData->position = sysData->headPosition;
 
     return result;
 }
 
-static uint32_t stream_file_write(MXFFileSysData *sysData, const uint8_t *data, uint32_t count)
+static uint64_t stream_file_write_64(MXFFileSysData *sysData, const uint8_t *data, uint64_t count)
 {
-    uint32_t result;
+    uint64_t result;
 
     if (sysData->readOnly)
         return 0;
@@ -113,13 +113,23 @@ static uint32_t stream_file_write(MXFFileSysData *sysData, const uint8_t *data,
     if (sysData->position > sysData->headPosition && !write_skip(sysData))
         return 0;
 
-    result = mxf_file_write(sysData->target, data, count);
+    result = mxf_file_write_64(sysData->target, data, count);
     sysData->headPosition += result;
     sysData->position = sysData->headPosition;
 
     return result;
 }
 
+static uint32_t stream_file_read(MXFFileSysData *sysData, uint8_t *data, uint32_t count)
+{
+    return (uint32_t)stream_file_read_64(sysData, data, count);
+}
+
+static uint32_t stream_file_write(MXFFileSysData *sysData, const uint8_t *data, uint32_t count)
+{
+    return (uint32_t)stream_file_write_64(sysData, data, count);
+}
+
 static int stream_file_getchar(MXFFileSysData *sysData)
 {
     int result;
@@ -229,6 +239,8 @@ int mxf_stream_file_wrap(MXFFile *target, int readOnly, MXFFile **streamMXFFile)
     newMXFFile->tell          = stream_file_tell;
     newMXFFile->is_seekable   = stream_file_is_seekable;
     newMXFFile->size          = stream_file_size;
+    newMXFFile->read_64       = stream_file_read_64;
+    newMXFFile->write_64      = stream_file_write_64;
     newMXFFile->free_sys_data = free_stream_file;
     newMXFFile->sysData       = newStreamFile;
     newMXFFile->minLLen       = target->minLLen;
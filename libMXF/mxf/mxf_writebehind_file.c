@@ -0,0 +1,498 @@
+/*
+ * Copyright (C) 2017, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Author: Philip de Nier
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <limits.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <pthread.h>
+
+#include <mxf/mxf.h>
+#include <mxf/mxf_writebehind_file.h>
+#include <mxf/mxf_macros.h>
+
+
+#if defined(IOV_MAX)
+#define MAX_IOVECS      IOV_MAX
+#else
+#define MAX_IOVECS      16
+#endif
+
+
+
+typedef struct
+{
+    uint8_t *data;
+    int64_t offset;
+    uint32_t size;
+} WriteBuffer;
+
+struct MXFFileSysData
+{
+    int fd;
+
+    pthread_t thread;
+    int threadStarted;
+    pthread_mutex_t mutex;          /* protects the queue state below */
+    pthread_cond_t queueCond;       /* signals the I/O thread that buffers are queued or it must stop */
+    pthread_cond_t spaceCond;       /* signals the writer that queued buffers have been written */
+
+    WriteBuffer *buffers;
+    uint32_t numBuffers;
+    uint32_t bufferSize;
+    uint32_t first;                 /* ring index of the first queued buffer */
+    uint32_t numQueued;
+    int writeError;
+    int stop;
+    int64_t numStalls;
+
+    uint32_t fill;                  /* ring index of the buffer filled by the writer, which follows the queued buffers */
+    int64_t position;
+    int64_t fileSize;
+    int isEOF;
+};
+
+
+static int write_iovecs(int fd, struct iovec *iov, int iovcnt, int64_t offset)
+{
+    char errorBuf[128];
+    ssize_t result;
+
+    while (iovcnt > 0) {
+#if defined(HAVE_PWRITEV)
+        result = pwritev(fd, iov, iovcnt, (off_t)offset);
+#else
+        result = pwrite(fd, iov->iov_base, iov->iov_len, (off_t)offset);
+#endif
+        if (result < 0) {
+            if (errno == EINTR)
+                continue;
+            mxf_log_error("Write-behind file write failed: %s\n", mxf_strerror(errno, errorBuf, sizeof(errorBuf)));
+            return 0;
+        }
+
+        offset += result;
+        while (iovcnt > 0 && (size_t)result >= iov->iov_len) {
+            result -= iov->iov_len;
+            iov++;
+            iovcnt--;
+        }
+        if (iovcnt > 0) {
+            iov->iov_base = (uint8_t*)iov->iov_base + result;
+            iov->iov_len -= result;
+        }
+    }
+
+    return 1;
+}
+
+static int write_buffers(MXFFileSysData *sysData, uint32_t first, uint32_t count)
+{
+    struct iovec iov[MAX_IOVECS];
+    WriteBuffer *buffer;
+    int64_t runOffset = 0;
+    int64_t runEnd = 0;
+    int iovcnt = 0;
+    uint32_t i;
+
+    /* buffers are written in queue order and contiguous buffers are combined into a single write */
+    for (i = 0; i < count; i++) {
+        buffer = &sysData->buffers[(first + i) % sysData->numBuffers];
+        if (iovcnt > 0 && (buffer->offset != runEnd || iovcnt == MAX_IOVECS)) {
+            if (!write_iovecs(sysData->fd, iov, iovcnt, runOffset))
+                return 0;
+            iovcnt = 0;
+        }
+        if (iovcnt == 0)
+            runOffset = buffer->offset;
+        iov[iovcnt].iov_base = buffer->data;
+        iov[iovcnt].iov_len  = buffer->size;
+        iovcnt++;
+        runEnd = buffer->offset + buffer->size;
+    }
+    if (iovcnt > 0 && !write_iovecs(sysData->fd, iov, iovcnt, runOffset))
+        return 0;
+
+    return 1;
+}
+
+static void* writebehind_thread(void *arg)
+{
+    MXFFileSysData *sysData = (MXFFileSysData*)arg;
+    uint32_t first;
+    uint32_t count;
+    int result;
+
+    pthread_mutex_lock(&sysData->mutex);
+    while (1) {
+        if (sysData->numQueued == 0) {
+            if (sysData->stop)
+                break;
+            pthread_cond_wait(&sysData->queueCond, &sysData->mutex);
+            continue;
+        }
+
+        first = sysData->first;
+        count = sysData->numQueued;
+        pthread_mutex_unlock(&sysData->mutex);
+
+        result = sysData->writeError ? 0 : write_buffers(sysData, first, count);
+
+        pthread_mutex_lock(&sysData->mutex);
+        if (!result)
+            sysData->writeError = 1;
+        sysData->first = (sysData->first + count) % sysData->numBuffers;
+        sysData->numQueued -= count;
+        pthread_cond_signal(&sysData->spaceCond);
+    }
+    pthread_mutex_unlock(&sysData->mutex);
+
+    return NULL;
+}
+
+static WriteBuffer* get_write_buffer(MXFFileSysData *sysData)
+{
+    return &sysData->buffers[sysData->fill];
+}
+
+static int queue_write_buffer(MXFFileSysData *sysData)
+{
+    WriteBuffer *buffer;
+    int result;
+
+    pthread_mutex_lock(&sysData->mutex);
+
+    buffer = get_write_buffer(sysData);
+    if (buffer->size > 0) {
+        sysData->numQueued++;
+        sysData->fill = (sysData->fill + 1) % sysData->numBuffers;
+        pthread_cond_signal(&sysData->queueCond);
+
+        /* the next buffer is only free once it is no longer queued */
+        if (sysData->numQueued == sysData->numBuffers) {
+            sysData->numStalls++;
+            while (sysData->numQueued == sysData->numBuffers)
+                pthread_cond_wait(&sysData->spaceCond, &sysData->mutex);
+        }
+
+        buffer = get_write_buffer(sysData);
+        buffer->size = 0;
+    }
+    result = !sysData->writeError;
+
+    pthread_mutex_unlock(&sysData->mutex);
+
+    return result;
+}
+
+static int flush_buffers(MXFFileSysData *sysData)
+{
+    int result;
+
+    if (!queue_write_buffer(sysData))
+        return 0;
+
+    pthread_mutex_lock(&sysData->mutex);
+    while (sysData->numQueued > 0)
+        pthread_cond_wait(&sysData->spaceCond, &sysData->mutex);
+    result = !sysData->writeError;
+    pthread_mutex_unlock(&sysData->mutex);
+
+    return result;
+}
+
+
+static void writebehind_file_close(MXFFileSysData *sysData)
+{
+    char errorBuf[128];
+
+    if (sysData->threadStarted) {
+        flush_buffers(sysData);
+
+        pthread_mutex_lock(&sysData->mutex);
+        sysData->stop = 1;
+        pthread_cond_signal(&sysData->queueCond);
+        pthread_mutex_unlock(&sysData->mutex);
+
+        pthread_join(sysData->thread, NULL);
+        sysData->threadStarted = 0;
+
+        if (sysData->numStalls > 0) {
+            mxf_log_debug("Write-behind file writes were blocked %" PRId64 " times waiting for buffers to be written\n",
+                          sysData->numStalls);
+        }
+    }
+
+    if (sysData->fd >= 0) {
+        if (close(sysData->fd) != 0)
+            mxf_log_error("Write-behind file close failed: %s\n", mxf_strerror(errno, errorBuf, sizeof(errorBuf)));
+        sysData->fd = -1;
+    }
+}
+
+static uint32_t writebehind_file_read(MXFFileSysData *sysData, uint8_t *data, uint32_t count)
+{
+    char errorBuf[128];
+    uint32_t totalRead = 0;
+    ssize_t result;
+
+    if (!flush_buffers(sysData))
+        return 0;
+
+    while (totalRead < count) {
+        result = pread(sysData->fd, &data[totalRead], count - totalRead, (off_t)sysData->position);
+        if (result < 0) {
+            if (errno == EINTR)
+                continue;
+            mxf_log_error("Write-behind file read failed: %s\n", mxf_strerror(errno, errorBuf, sizeof(errorBuf)));
+            break;
+        }
+        if (result == 0) {
+            sysData->isEOF = 1;
+            break;
+        }
+        totalRead += (uint32_t)result;
+        sysData->position += result;
+    }
+
+    return totalRead;
+}
+
+static uint32_t writebehind_file_write(MXFFileSysData *sysData, const uint8_t *data, uint32_t count)
+{
+    WriteBuffer *buffer;
+    uint32_t totalWritten = 0;
+    uint32_t numWrite;
+
+    /* the fill buffer is owned by the writer and is accessed without locking. The queue state shared with the
+       I/O thread is only accessed in queue_write_buffer whilst holding the mutex */
+    buffer = get_write_buffer(sysData);
+    if (buffer->size > 0 && buffer->offset + buffer->size != sysData->position) {
+        if (!queue_write_buffer(sysData))
+            return 0;
+        buffer = get_write_buffer(sysData);
+    }
+
+    while (totalWritten < count) {
+        if (buffer->size == sysData->bufferSize) {
+            if (!queue_write_buffer(sysData))
+                break;
+            buffer = get_write_buffer(sysData);
+        }
+        if (buffer->size == 0)
+            buffer->offset = sysData->position;
+
+        numWrite = sysData->bufferSize - buffer->size;
+        if (numWrite > count - totalWritten)
+            numWrite = count - totalWritten;
+        memcpy(&buffer->data[buffer->size], &data[totalWritten], numWrite);
+        buffer->size += numWrite;
+        totalWritten += numWrite;
+        sysData->position += numWrite;
+    }
+
+    if (sysData->position > sysData->fileSize)
+        sysData->fileSize = sysData->position;
+
+    return totalWritten;
+}
+
+static int writebehind_file_getchar(MXFFileSysData *sysData)
+{
+    uint8_t c;
+    if (writebehind_file_read(sysData, &c, 1) != 1)
+        return EOF;
+
+    return c;
+}
+
+static int writebehind_file_putchar(MXFFileSysData *sysData, int c)
+{
+    uint8_t byte = (uint8_t)c;
+    if (writebehind_file_write(sysData, &byte, 1) != 1)
+        return EOF;
+
+    return c;
+}
+
+static int writebehind_file_eof(MXFFileSysData *sysData)
+{
+    return sysData->isEOF;
+}
+
+static int writebehind_file_seek(MXFFileSysData *sysData, int64_t offset, int whence)
+{
+    int64_t newPosition;
+
+    if (whence == SEEK_SET)
+        newPosition = offset;
+    else if (whence == SEEK_CUR)
+        newPosition = sysData->position + offset;
+    else if (whence == SEEK_END)
+        newPosition = sysData->fileSize + offset;
+    else
+        return 0;
+
+    if (newPosition < 0)
+        return 0;
+
+    sysData->position = newPosition;
+    sysData->isEOF = 0;
+
+    return 1;
+}
+
+static int64_t writebehind_file_tell(MXFFileSysData *sysData)
+{
+    return sysData->position;
+}
+
+static int writebehind_file_is_seekable(MXFFileSysData *sysData)
+{
+    (void)sysData;
+    return 1;
+}
+
+static int64_t writebehind_file_size(MXFFileSysData *sysData)
+{
+    return sysData->fileSize;
+}
+
+static void free_writebehind_file(MXFFileSysData *sysData)
+{
+    uint32_t i;
+
+    if (!sysData)
+        return;
+
+    if (sysData->buffers) {
+        for (i = 0; i < sysData->numBuffers; i++)
+            free(sysData->buffers[i].data);
+        free(sysData->buffers);
+    }
+    pthread_mutex_destroy(&sysData->mutex);
+    pthread_cond_destroy(&sysData->queueCond);
+    pthread_cond_destroy(&sysData->spaceCond);
+
+    free(sysData);
+}
+
+
+int mxf_writebehind_file_open_new(const char *filename, uint32_t bufferSize, uint32_t numBuffers, MXFFile **mxfFile)
+{
+    MXFFile *newMXFFile = NULL;
+    MXFFileSysData *newWriteBehindFile = NULL;
+    uint32_t i;
+    int fd;
+
+    if (bufferSize == 0)
+        bufferSize = MXF_WRITEBEHIND_DEFAULT_BUFFER_SIZE;
+    if (numBuffers < 2)
+        numBuffers = (numBuffers == 0 ? MXF_WRITEBEHIND_DEFAULT_NUM_BUFFERS : 2);
+
+    fd = open(filename, O_RDWR | O_CREAT | O_TRUNC, 0666);
+    if (fd < 0)
+        return 0;
+
+    CHK_MALLOC_OFAIL(newMXFFile, MXFFile);
+    memset(newMXFFile, 0, sizeof(MXFFile));
+    CHK_MALLOC_OFAIL(newWriteBehindFile, MXFFileSysData);
+    memset(newWriteBehindFile, 0, sizeof(MXFFileSysData));
+    newWriteBehindFile->fd = fd;
+
+    pthread_mutex_init(&newWriteBehindFile->mutex, NULL);
+    pthread_cond_init(&newWriteBehindFile->queueCond, NULL);
+    pthread_cond_init(&newWriteBehindFile->spaceCond, NULL);
+
+    CHK_MALLOC_ARRAY_OFAIL(newWriteBehindFile->buffers, WriteBuffer, numBuffers);
+    memset(newWriteBehindFile->buffers, 0, numBuffers * sizeof(WriteBuffer));
+    newWriteBehindFile->numBuffers = numBuffers;
+    for (i = 0; i < numBuffers; i++)
+        CHK_MALLOC_ARRAY_OFAIL(newWriteBehindFile->buffers[i].data, uint8_t, bufferSize);
+    newWriteBehindFile->bufferSize = bufferSize;
+
+    CHK_OFAIL(pthread_create(&newWriteBehindFile->thread, NULL, writebehind_thread, newWriteBehindFile) == 0);
+    newWriteBehindFile->threadStarted = 1;
+
+    newMXFFile->close         = writebehind_file_close;
+    newMXFFile->read          = writebehind_file_read;
+    newMXFFile->write         = writebehind_file_write;
+    newMXFFile->get_char      = writebehind_file_getchar;
+    newMXFFile->put_char      = writebehind_file_putchar;
+    newMXFFile->eof           = writebehind_file_eof;
+    newMXFFile->seek          = writebehind_file_seek;
+    newMXFFile->tell          = writebehind_file_tell;
+    newMXFFile->is_seekable   = writebehind_file_is_seekable;
+    newMXFFile->size          = writebehind_file_size;
+    newMXFFile->free_sys_data = free_writebehind_file;
+    newMXFFile->sysData       = newWriteBehindFile;
+
+
+    *mxfFile = newMXFFile;
+    return 1;
+
+fail:
+    close(fd);
+    if (newWriteBehindFile)
+        newWriteBehindFile->fd = -1;
+    free_writebehind_file(newWriteBehindFile);
+    SAFE_FREE(newMXFFile);
+    return 0;
+}
+
+int mxf_writebehind_file_is_writebehind_file(MXFFile *mxfFile)
+{
+    return mxfFile->close == writebehind_file_close;
+}
+
+int64_t mxf_writebehind_file_get_num_stalls(MXFFile *mxfFile)
+{
+    int64_t numStalls;
+
+    if (!mxf_writebehind_file_is_writebehind_file(mxfFile))
+        return 0;
+
+    pthread_mutex_lock(&mxfFile->sysData->mutex);
+    numStalls = mxfFile->sysData->numStalls;
+    pthread_mutex_unlock(&mxfFile->sysData->mutex);
+
+    return numStalls;
+}
+
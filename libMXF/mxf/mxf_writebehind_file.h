@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2017, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Author: Philip de Nier
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef MXF_WRITEBEHIND_FILE_H_
+#define MXF_WRITEBEHIND_FILE_H_
+
+
+#include <mxf/mxf_file.h>
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+
+/* default size and number of buffers used when the values passed to mxf_writebehind_file_open_new are 0 */
+#define MXF_WRITEBEHIND_DEFAULT_BUFFER_SIZE    (1024 * 1024)
+#define MXF_WRITEBEHIND_DEFAULT_NUM_BUFFERS    8
+
+
+/* open a new file on disk that coalesces writes into numBuffers buffers of size bufferSize.
+   Filled buffers are written in a separate I/O thread, using pwritev for contiguous buffers.
+   A write blocks when all buffers are waiting to be written, i.e. the caller is subjected to back-pressure
+   from the disk. Seeking back and rewriting data is supported; a read waits for all pending writes to complete.
+   A failed background write causes subsequent writes to fail */
+int mxf_writebehind_file_open_new(const char *filename, uint32_t bufferSize, uint32_t numBuffers, MXFFile **mxfFile);
+
+int mxf_writebehind_file_is_writebehind_file(MXFFile *mxfFile);
+
+/* returns the number of times a write was blocked waiting for a buffer to be written */
+int64_t mxf_writebehind_file_get_num_stalls(MXFFile *mxfFile);
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif
@@ -130,6 +130,13 @@ static int test_model(MXFDataModel *dataModel)
     CHK_ORET(mxf_find_item_def_in_set_def(&MXF_ITEM_K(TestSet1, TestItem1), setDef, &itemDef));
 
     CHK_ORET(mxf_is_subclass_of(dataModel, &MXF_SET_K(TestSet4), &MXF_SET_K(TestSet1)));
+    CHK_ORET(mxf_is_subclass_of(dataModel, &MXF_SET_K(TestSet4), &MXF_SET_K(InterchangeObject)));
+    CHK_ORET(mxf_is_subclass_of(dataModel, &MXF_SET_K(TestSet1), &MXF_SET_K(TestSet1)));
+    CHK_ORET(mxf_is_subclass_of(dataModel, &MXF_SET_K(TestSet2), &MXF_SET_K(GenericPackage)));
+    CHK_ORET(mxf_is_subclass_of(dataModel, &MXF_SET_K(SourcePackage), &MXF_SET_K(GenericPackage)));
+    CHK_ORET(!mxf_is_subclass_of(dataModel, &MXF_SET_K(GenericPackage), &MXF_SET_K(SourcePackage)));
+    CHK_ORET(!mxf_is_subclass_of(dataModel, &MXF_SET_K(TestSet3), &MXF_SET_K(TestSet4)));
+    CHK_ORET(!mxf_is_subclass_of(dataModel, &MXF_SET_K(TestSet2), &MXF_SET_K(TestSet1)));
 
     return 1;
 }
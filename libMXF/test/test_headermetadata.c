@@ -23,6 +23,8 @@ static const mxfUMID someUMID =
     0xff, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa};
 static const mxfRational someRational =
     {20, -10};
+static const mxfKey unknownSetKey =
+    {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x7f, 0x7f, 0x00};
 
 #define ITEM_DEF(count, typeId) \
     MXF_ITEM_DEFINITION(TestSet1, TestItem##count, \
@@ -190,7 +192,7 @@ static int after_set_read(void *privateData, MXFHeaderMetadata *headerMetadata,
 
 
 
-int test_read(const char *filename)
+int test_read(const char *filename, int lazyRead)
 {
     MXFFile *mxfFile = NULL;
     MXFFilePartitions partitions;
@@ -274,6 +276,7 @@ int test_read(const char *filename)
     CHK_OFAIL(load_extensions(srcDataModel));
     CHK_OFAIL(mxf_finalise_data_model(srcDataModel));
     CHK_OFAIL(mxf_create_header_metadata(&srcHeaderMetadata, srcDataModel));
+    mxf_set_lazy_header_metadata_read(srcHeaderMetadata, lazyRead);
 
 
     /* TEST */
@@ -300,6 +303,20 @@ int test_read(const char *filename)
     CHK_OFAIL(mxf_find_singular_set_by_key(srcHeaderMetadata, &MXF_SET_K(TestSet6), &srcSet6));
     CHK_OFAIL(mxf_find_singular_set_by_key(srcHeaderMetadata, &MXF_SET_K(TestSet7), &srcSet7));
 
+    /* lazily read sets hold their encoded items until first accessed */
+    CHK_OFAIL((srcSet1->encodedItems != NULL) == (lazyRead != 0));
+    if (lazyRead)
+    {
+        /* a failed decode leaves the encoded items in place */
+        srcSet1->key = unknownSetKey;
+        CHK_OFAIL(!mxf_decode_set_items(srcSet1));
+        srcSet1->key = MXF_SET_K(TestSet1);
+        CHK_OFAIL(srcSet1->encodedItems != NULL);
+        CHK_OFAIL(mxf_get_list_length(&srcSet1->items) == 0);
+    }
+    CHK_OFAIL(mxf_decode_set_items(srcSet1));
+    CHK_OFAIL(srcSet1->encodedItems == NULL);
+
     /* test cloning by checking using a clone */
     CHK_OFAIL(mxf_clone_set(srcPrefaceSet, headerMetadata, &prefaceSet));
     CHK_OFAIL(mxf_clone_set(srcSet1, headerMetadata, &set1));
@@ -611,6 +628,197 @@ fail:
 }
 
 
+int test_items(void)
+{
+    MXFDataModel *dataModel = NULL;
+    MXFHeaderMetadata *headerMetadata = NULL;
+    MXFMetadataSet *set;
+    MXFMetadataItem *item = NULL;
+    mxfUTF16Char longName[64];
+    mxfUUID uuid;
+    int i;
+
+    CHK_OFAIL(mxf_load_data_model(&dataModel));
+    CHK_OFAIL(mxf_finalise_data_model(dataModel));
+    CHK_OFAIL(mxf_create_header_metadata(&headerMetadata, dataModel));
+
+
+    /* TEST */
+
+    /* enough items for the set to use an item index */
+    CHK_OFAIL(mxf_create_set(headerMetadata, &MXF_SET_K(Identification), &set));
+    CHK_OFAIL(mxf_set_uuid_item(set, &MXF_ITEM_K(Identification, ThisGenerationUID), &someUUID));
+    CHK_OFAIL(mxf_set_utf16string_item(set, &MXF_ITEM_K(Identification, CompanyName), L"Company"));
+    CHK_OFAIL(mxf_set_utf16string_item(set, &MXF_ITEM_K(Identification, ProductName), L"Product"));
+    CHK_OFAIL(mxf_set_product_version_item(set, &MXF_ITEM_K(Identification, ProductVersion), mxf_get_version()));
+    CHK_OFAIL(mxf_set_utf16string_item(set, &MXF_ITEM_K(Identification, VersionString), L"Version"));
+    CHK_OFAIL(mxf_set_uuid_item(set, &MXF_ITEM_K(Identification, ProductUID), &someUUID));
+    CHK_OFAIL(mxf_set_timestamp_item(set, &MXF_ITEM_K(Identification, ModificationDate), &someTimestamp));
+    CHK_OFAIL(mxf_set_product_version_item(set, &MXF_ITEM_K(Identification, ToolkitVersion), mxf_get_version()));
+    CHK_OFAIL(mxf_set_utf16string_item(set, &MXF_ITEM_K(Identification, Platform), L"Platform"));
+    CHK_OFAIL(set->itemIndex != NULL);
+
+    CHK_OFAIL(mxf_have_item(set, &MXF_ITEM_K(InterchangeObject, InstanceUID)));
+    CHK_OFAIL(mxf_get_uuid_item(set, &MXF_ITEM_K(Identification, ProductUID), &uuid));
+    CHK_OFAIL(mxf_equals_uuid(&uuid, &someUUID));
+    CHK_OFAIL(!mxf_have_item(set, &MXF_ITEM_K(Preface, Identifications)));
+
+    /* removed items are no longer found and the remaining items are */
+    CHK_OFAIL(mxf_remove_item(set, &MXF_ITEM_K(Identification, ProductUID), &item));
+    mxf_free_item(&item);
+    CHK_OFAIL(!mxf_have_item(set, &MXF_ITEM_K(Identification, ProductUID)));
+    CHK_OFAIL(mxf_have_item(set, &MXF_ITEM_K(Identification, Platform)));
+    CHK_OFAIL(mxf_set_uuid_item(set, &MXF_ITEM_K(Identification, ProductUID), &someUUID));
+    CHK_OFAIL(mxf_get_uuid_item(set, &MXF_ITEM_K(Identification, ProductUID), &uuid));
+    CHK_OFAIL(mxf_equals_uuid(&uuid, &someUUID));
+
+    /* values move between inline and allocated storage */
+    for (i = 0; i < 63; i++)
+    {
+        longName[i] = L'a';
+    }
+    longName[63] = 0;
+    CHK_OFAIL(mxf_set_utf16string_item(set, &MXF_ITEM_K(Identification, Platform), longName));
+    CHK_OFAIL(mxf_get_item(set, &MXF_ITEM_K(Identification, Platform), &item));
+    CHK_OFAIL(item->value != item->inlineValue && item->length > MXF_ITEM_INLINE_VALUE_SIZE);
+    CHK_OFAIL(mxf_set_utf16string_item(set, &MXF_ITEM_K(Identification, Platform), L"Platform"));
+    CHK_OFAIL(item->value == item->inlineValue && item->length <= MXF_ITEM_INLINE_VALUE_SIZE);
+
+
+    mxf_free_header_metadata(&headerMetadata);
+    mxf_free_data_model(&dataModel);
+    return 1;
+
+fail:
+    mxf_free_header_metadata(&headerMetadata);
+    mxf_free_data_model(&dataModel);
+    return 0;
+}
+
+int test_arena(void)
+{
+    MXFDataModel *dataModel = NULL;
+    MXFHeaderMetadata *headerMetadata = NULL;
+    MXFHeaderMetadata *toHeaderMetadata = NULL;
+    MXFMetadataSet *set;
+    MXFMetadataSet *clonedSet = NULL;
+    MXFArena *arena = NULL;
+    uint8_t *data;
+    mxfUUID uuid;
+    uint16_t size;
+    int i;
+
+    CHK_OFAIL(mxf_load_data_model(&dataModel));
+    CHK_OFAIL(mxf_finalise_data_model(dataModel));
+    CHK_OFAIL(mxf_create_header_metadata(&headerMetadata, dataModel));
+    CHK_OFAIL(mxf_create_header_metadata(&toHeaderMetadata, dataModel));
+
+
+    /* TEST */
+
+    /* allocations are aligned and large allocations succeed */
+    CHK_OFAIL(mxf_create_arena(&arena, 1024));
+    for (i = 0; i < 100; i++)
+    {
+        data = (uint8_t*)mxf_arena_alloc(arena, (i % 7) * 100 + 1);
+        CHK_OFAIL(data != NULL && ((size_t)data % 8) == 0);
+        memset(data, 0xff, (i % 7) * 100 + 1);
+    }
+    mxf_unref_arena(&arena);
+    CHK_OFAIL(arena == NULL);
+
+    /* cloned sets are allocated from the arena and remain valid after the header metadata is freed */
+    CHK_OFAIL(mxf_create_set(headerMetadata, &MXF_SET_K(Identification), &set));
+    CHK_OFAIL(mxf_set_uuid_item(set, &MXF_ITEM_K(Identification, ProductUID), &someUUID));
+    CHK_OFAIL(mxf_set_utf16string_item(set, &MXF_ITEM_K(Identification, ProductName),
+                                       L"A product name that does not fit inline"));
+    CHK_OFAIL(mxf_clone_set(set, toHeaderMetadata, &clonedSet));
+    CHK_OFAIL(clonedSet->arena != NULL && clonedSet->arena == toHeaderMetadata->arena);
+
+    CHK_OFAIL(mxf_remove_set(toHeaderMetadata, clonedSet));
+    mxf_free_header_metadata(&toHeaderMetadata);
+    CHK_OFAIL(mxf_get_uuid_item(clonedSet, &MXF_ITEM_K(Identification, ProductUID), &uuid));
+    CHK_OFAIL(mxf_equals_uuid(&uuid, &someUUID));
+    CHK_OFAIL(mxf_get_utf16string_item_size(clonedSet, &MXF_ITEM_K(Identification, ProductName), &size));
+    CHK_OFAIL(size == 40);
+    mxf_free_set(&clonedSet);
+
+
+    mxf_free_header_metadata(&headerMetadata);
+    mxf_free_data_model(&dataModel);
+    return 1;
+
+fail:
+    mxf_unref_arena(&arena);
+    mxf_free_set(&clonedSet);
+    mxf_free_header_metadata(&headerMetadata);
+    mxf_free_header_metadata(&toHeaderMetadata);
+    mxf_free_data_model(&dataModel);
+    return 0;
+}
+
+int test_dereference(void)
+{
+    MXFDataModel *dataModel = NULL;
+    MXFHeaderMetadata *headerMetadata = NULL;
+    MXFMetadataSet *sets[1000];
+    MXFMetadataSet *set;
+    MXFMetadataSet *dupSet = NULL;
+    MXFListIterator setsIter;
+    int i;
+
+    CHK_OFAIL(mxf_load_data_model(&dataModel));
+    CHK_OFAIL(mxf_finalise_data_model(dataModel));
+    CHK_OFAIL(mxf_create_header_metadata(&headerMetadata, dataModel));
+
+
+    /* TEST */
+
+    /* enough sets to grow the instanceUID index several times */
+    for (i = 0; i < 1000; i++)
+    {
+        CHK_OFAIL(mxf_create_set(headerMetadata, &MXF_SET_K(Identification), &sets[i]));
+    }
+    for (i = 0; i < 1000; i++)
+    {
+        CHK_OFAIL(mxf_dereference(headerMetadata, &sets[i]->instanceUID, &set) && set == sets[i]);
+    }
+    CHK_OFAIL(!mxf_dereference(headerMetadata, &someUUID, &set));
+
+    /* removed sets are no longer found and the remaining sets are */
+    for (i = 0; i < 1000; i += 2)
+    {
+        CHK_OFAIL(mxf_remove_set(headerMetadata, sets[i]));
+        mxf_free_set(&sets[i]);
+    }
+    mxf_initialise_sets_iter(headerMetadata, &setsIter);
+    for (i = 1; i < 1000; i += 2)
+    {
+        CHK_OFAIL(mxf_dereference_s(headerMetadata, &setsIter, &sets[i]->instanceUID, &set) && set == sets[i]);
+    }
+
+    /* the first set added with a duplicate instanceUID is returned until it is removed */
+    CHK_OFAIL(mxf_create_set(headerMetadata, &MXF_SET_K(Identification), &dupSet));
+    CHK_OFAIL(mxf_remove_set(headerMetadata, dupSet));
+    dupSet->instanceUID = sets[1]->instanceUID;
+    CHK_OFAIL(mxf_add_set(headerMetadata, dupSet));
+    CHK_OFAIL(mxf_dereference(headerMetadata, &sets[1]->instanceUID, &set) && set == sets[1]);
+    CHK_OFAIL(mxf_remove_set(headerMetadata, sets[1]));
+    mxf_free_set(&sets[1]);
+    CHK_OFAIL(mxf_dereference(headerMetadata, &dupSet->instanceUID, &set) && set == dupSet);
+
+
+    mxf_free_header_metadata(&headerMetadata);
+    mxf_free_data_model(&dataModel);
+    return 1;
+
+fail:
+    mxf_free_header_metadata(&headerMetadata);
+    mxf_free_data_model(&dataModel);
+    return 0;
+}
+
+
 void usage(const char *cmd)
 {
     fprintf(stderr, "Usage: %s filename\n", cmd);
@@ -634,7 +842,27 @@ int main(int argc, const char *argv[])
         return 1;
     }
 
-    if (!test_read(argv[1]))
+    if (!test_read(argv[1], 0))
+    {
+        return 1;
+    }
+
+    if (!test_read(argv[1], 1))
+    {
+        return 1;
+    }
+
+    if (!test_items())
+    {
+        return 1;
+    }
+
+    if (!test_arena())
+    {
+        return 1;
+    }
+
+    if (!test_dereference())
     {
         return 1;
     }
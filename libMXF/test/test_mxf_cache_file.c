@@ -65,8 +65,18 @@ int main(int argc, const char *argv[])
     MXFFile *target;
     MXFCacheFile *cacheFile;
     MXFFile *mxfFile;
+    MXFFile *growFile;
     unsigned char *writeData;
     unsigned char *readData;
+    unsigned char *fileData;
+    unsigned char *checkData;
+    int64_t fileSize;
+    int64_t numHits;
+    int64_t numMisses;
+    int64_t position;
+    uint32_t count;
+    uint32_t seed;
+    int i;
 
     if (argc != 2)
     {
@@ -132,6 +142,89 @@ int main(int argc, const char *argv[])
     mxf_file_close(&mxfFile);
 
 
+    CHECK(mxf_disk_file_open_read(argv[1], &target));
+    fileSize = mxf_file_size(target);
+    CHECK(fileSize == DATA_SIZE * 6 + DATA_SIZE / 3);
+    fileData = malloc((size_t)fileSize);
+    checkData = malloc((size_t)fileSize);
+    CHECK(mxf_file_read(target, fileData, (uint32_t)fileSize) == fileSize);
+    CHECK(mxf_file_seek(target, 0, SEEK_SET));
+    CHECK(mxf_cache_file_open_read(target, PAGE_SIZE, 3, 2, &cacheFile));
+    mxfFile = mxf_cache_file_get_file(cacheFile);
+
+    mxf_cache_file_get_stats(cacheFile, &numHits, &numMisses);
+    CHECK(numHits == 0 && numMisses == 0);
+    CHECK(mxf_file_getc(mxfFile) == 0x01);
+    mxf_cache_file_get_stats(cacheFile, &numHits, &numMisses);
+    CHECK(numHits == 0 && numMisses == 1);
+    CHECK(mxf_file_seek(mxfFile, 0, SEEK_SET));
+    CHECK(mxf_file_getc(mxfFile) == 0x01);
+    mxf_cache_file_get_stats(cacheFile, &numHits, &numMisses);
+    CHECK(numHits == 1 && numMisses == 1);
+    CHECK(mxf_file_size(mxfFile) == fileSize);
+
+    seed = 1;
+    for (i = 0; i < 1000; i++) {
+        seed = seed * 1103515245 + 12345;
+        position = (seed >> 8) % fileSize;
+        seed = seed * 1103515245 + 12345;
+        count = (seed >> 8) % (4 * PAGE_SIZE);
+        if (position + count > fileSize)
+            count = (uint32_t)(fileSize - position);
+        CHECK(mxf_file_seek(mxfFile, position, SEEK_SET));
+        CHECK(mxf_file_read(mxfFile, checkData, count) == count);
+        CHECK(memcmp(checkData, &fileData[position], count) == 0);
+        CHECK(mxf_file_tell(mxfFile) == position + count);
+    }
+
+    /* page aligned read that bypasses the cache */
+    CHECK(mxf_file_seek(mxfFile, PAGE_SIZE, SEEK_SET));
+    CHECK(mxf_file_read(mxfFile, checkData, 3 * PAGE_SIZE + 1) == 3 * PAGE_SIZE + 1);
+    CHECK(memcmp(checkData, &fileData[PAGE_SIZE], 3 * PAGE_SIZE + 1) == 0);
+
+    CHECK(mxf_file_seek(mxfFile, -DATA_SIZE / 2, SEEK_END));
+    CHECK(mxf_file_read(mxfFile, readData, DATA_SIZE) == DATA_SIZE / 2);
+    CHECK(mxf_file_eof(mxfFile));
+    CHECK(mxf_file_getc(mxfFile) == EOF);
+    CHECK(mxf_file_write(mxfFile, writeData, 1) == 0);
+    CHECK(mxf_file_putc(mxfFile, 0x01) == EOF);
+    mxf_cache_file_get_stats(cacheFile, &numHits, &numMisses);
+    CHECK(numHits > 0 && numMisses > 0);
+
+    mxf_file_close(&mxfFile);
+
+
+    /* the partially filled last page of a growing file is reloaded when the file has grown */
+    CHECK(mxf_disk_file_open_new(argv[1], &mxfFile));
+    CHECK(mxf_file_write(mxfFile, fileData, PAGE_SIZE + 100) == PAGE_SIZE + 100);
+    mxf_file_close(&mxfFile);
+
+    CHECK(mxf_disk_file_open_read(argv[1], &target));
+    CHECK(mxf_cache_file_open_read(target, PAGE_SIZE, 3, 2, &cacheFile));
+    mxfFile = mxf_cache_file_get_file(cacheFile);
+    CHECK(mxf_file_read(mxfFile, checkData, 100) == 100);
+    CHECK(mxf_file_seek(mxfFile, PAGE_SIZE, SEEK_SET));
+    CHECK(mxf_file_read(mxfFile, checkData, 200) == 100);
+    CHECK(memcmp(checkData, &fileData[PAGE_SIZE], 100) == 0);
+
+    CHECK(mxf_disk_file_open_modify(argv[1], &growFile));
+    CHECK(mxf_file_seek(growFile, 0, SEEK_END));
+    CHECK(mxf_file_write(growFile, &fileData[PAGE_SIZE + 100], PAGE_SIZE) == PAGE_SIZE);
+    mxf_file_close(&growFile);
+
+    CHECK(mxf_file_size(mxfFile) == 2 * PAGE_SIZE + 100);
+    CHECK(mxf_file_seek(mxfFile, PAGE_SIZE + 50, SEEK_SET));
+    CHECK(mxf_file_read(mxfFile, checkData, PAGE_SIZE) == PAGE_SIZE);
+    CHECK(memcmp(checkData, &fileData[PAGE_SIZE + 50], PAGE_SIZE) == 0);
+    CHECK(mxf_file_read(mxfFile, checkData, PAGE_SIZE) == 50);
+    CHECK(memcmp(checkData, &fileData[2 * PAGE_SIZE + 50], 50) == 0);
+    CHECK(mxf_file_eof(mxfFile));
+
+    mxf_file_close(&mxfFile);
+    free(fileData);
+    free(checkData);
+
+
     free(writeData);
     free(readData);
 
@@ -0,0 +1,213 @@
+/*
+ * Copyright (C) 2017, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Author: Philip de Nier
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include <mxf/mxf.h>
+
+
+/* larger than the direct I/O staging buffer and not a multiple of the block size */
+#define DATA_SIZE   (20 * 1024 * 1024 + 123)
+
+
+
+#define CHECK(cmd) \
+    if (!(cmd)) \
+    { \
+        fprintf(stderr, "'%s' failed in %s:%d\n", #cmd, __FILE__, __LINE__); \
+        exit(1); \
+    }
+
+
+
+static int g_numWarnings = 0;
+static int g_numErrors = 0;
+
+
+
+static void test_vlog(MXFLogLevel level, const char *format, va_list p_arg)
+{
+    if (level == MXF_WLOG)
+        g_numWarnings++;
+    else if (level == MXF_ELOG)
+        g_numErrors++;
+
+    mxf_vlog_default(level, format, p_arg);
+}
+
+static int direct_io_supported(const char *filename)
+{
+#if defined(O_DIRECT)
+    int fd = open(filename, O_RDWR | O_CREAT | O_TRUNC | O_DIRECT, 0666);
+    if (fd < 0)
+        return 0;
+    close(fd);
+    return 1;
+#else
+    (void)filename;
+    return 0;
+#endif
+}
+
+static void test_write_failure(const unsigned char *writeData)
+{
+#if defined(__linux__)
+    MXFFile *mxfFile;
+
+    /* writes to /dev/full fail with ENOSPC */
+    CHECK(mxf_disk_file_open_new_direct("/dev/full", &mxfFile));
+
+    /* the failure is reported when the staging buffer is flushed to make space */
+    g_numErrors = 0;
+    CHECK(mxf_file_write(mxfFile, writeData, 9 * 1024 * 1024) < 9 * 1024 * 1024);
+    CHECK(g_numErrors > 0);
+
+    /* and when the remaining buffered data is written when closing */
+    CHECK(mxf_file_seek(mxfFile, 0, SEEK_SET));
+    CHECK(mxf_file_write(mxfFile, writeData, 1000) == 1000);
+    g_numErrors = 0;
+    CHECK(!mxf_file_close_checked(&mxfFile));
+    CHECK(mxfFile == NULL);
+    CHECK(g_numErrors > 0);
+#else
+    (void)writeData;
+#endif
+}
+
+static void usage(const char *cmd)
+{
+    fprintf(stderr, "Usage: %s filename\n", cmd);
+}
+
+int main(int argc, const char *argv[])
+{
+    MXFFile *mxfFile;
+    unsigned char *writeData;
+    unsigned char *readData;
+    unsigned char header[100];
+    uint32_t chunkSize;
+    uint32_t offset;
+    int i;
+
+    if (argc != 2)
+    {
+        usage(argv[0]);
+        return 1;
+    }
+
+    writeData = malloc(DATA_SIZE);
+    for (i = 0; i < DATA_SIZE; i++)
+        writeData[i] = (unsigned char)(i % 251);
+    readData = malloc(DATA_SIZE);
+    memset(header, 0xaa, sizeof(header));
+
+
+    mxf_vlog = test_vlog;
+
+
+    /* the file is written using O_DIRECT if the file system supports it, without falling back */
+    if (direct_io_supported(argv[1])) {
+        g_numWarnings = 0;
+        CHECK(mxf_disk_file_open_new_direct(argv[1], &mxfFile));
+        CHECK(g_numWarnings == 0);
+    } else {
+        CHECK(mxf_disk_file_open_new_direct(argv[1], &mxfFile));
+    }
+    CHECK(mxf_file_is_seekable(mxfFile));
+
+    /* write unaligned chunks of varying size */
+    offset = 0;
+    chunkSize = 1;
+    while (offset < DATA_SIZE) {
+        if (chunkSize > DATA_SIZE - offset)
+            chunkSize = DATA_SIZE - offset;
+        CHECK(mxf_file_write(mxfFile, &writeData[offset], chunkSize) == chunkSize);
+        offset += chunkSize;
+        chunkSize = chunkSize * 3 + 7;
+    }
+    CHECK(mxf_file_tell(mxfFile) == DATA_SIZE);
+    CHECK(mxf_file_size(mxfFile) == DATA_SIZE);
+
+    /* seek back and rewrite the header, as is done when completing a file */
+    CHECK(mxf_file_seek(mxfFile, 10, SEEK_SET));
+    CHECK(mxf_file_write(mxfFile, header, sizeof(header)) == sizeof(header));
+    memcpy(&writeData[10], header, sizeof(header));
+
+    /* read back data from the start and the unaligned tail */
+    CHECK(mxf_file_seek(mxfFile, 0, SEEK_SET));
+    CHECK(mxf_file_read(mxfFile, readData, 1000) == 1000);
+    CHECK(memcmp(readData, writeData, 1000) == 0);
+    CHECK(mxf_file_seek(mxfFile, -10, SEEK_END));
+    CHECK(mxf_file_read(mxfFile, readData, 20) == 10);
+    CHECK(memcmp(readData, &writeData[DATA_SIZE - 10], 10) == 0);
+    CHECK(mxf_file_eof(mxfFile));
+    CHECK(mxf_file_getc(mxfFile) == EOF);
+
+    /* rewrite a section crossing the end of the file */
+    CHECK(mxf_file_seek(mxfFile, DATA_SIZE - 3, SEEK_SET));
+    CHECK(!mxf_file_eof(mxfFile));
+    CHECK(mxf_file_putc(mxfFile, 0x55) == 0x55);
+    CHECK(mxf_file_write(mxfFile, header, 5) == 5);
+    CHECK(mxf_file_size(mxfFile) == DATA_SIZE + 3);
+
+    g_numErrors = 0;
+    CHECK(mxf_file_close_checked(&mxfFile));
+    CHECK(g_numErrors == 0);
+    writeData[DATA_SIZE - 3] = 0x55;
+
+
+    CHECK(mxf_disk_file_open_read(argv[1], &mxfFile));
+    CHECK(mxf_file_size(mxfFile) == DATA_SIZE + 3);
+    CHECK(mxf_file_read(mxfFile, readData, DATA_SIZE - 2) == DATA_SIZE - 2);
+    CHECK(memcmp(readData, writeData, DATA_SIZE - 2) == 0);
+    CHECK(mxf_file_read(mxfFile, readData, 10) == 5);
+    CHECK(memcmp(readData, header, 5) == 0);
+    mxf_file_close(&mxfFile);
+
+
+    test_write_failure(writeData);
+
+
+    free(writeData);
+    free(readData);
+
+    return 0;
+}
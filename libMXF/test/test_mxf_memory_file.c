@@ -111,6 +111,13 @@ int main()
     CHECK(mxf_file_write(mxfFile, data, DATA_SIZE) == DATA_SIZE);
     CHECK(mxf_file_size(mxfFile) == DATA_SIZE * 6 + DATA_SIZE / 3);
 
+    CHECK(mxf_file_write_64(mxfFile, data, DATA_SIZE) == DATA_SIZE);
+    CHECK(mxf_file_size(mxfFile) == DATA_SIZE * 7 + DATA_SIZE / 3);
+    CHECK(mxf_file_seek(mxfFile, DATA_SIZE * 6, SEEK_SET));
+    CHECK(mxf_file_read_64(mxfFile, data, DATA_SIZE) == DATA_SIZE);
+    CHECK(mxf_file_read_64(mxfFile, data, DATA_SIZE) == DATA_SIZE / 3);
+    CHECK(mxf_file_eof(mxfFile));
+
     mxf_file_close(&mxfFile);
 
 
@@ -0,0 +1,160 @@
+/*
+ * Copyright (C) 2017, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Author: Philip de Nier
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+#include <mxf/mxf.h>
+#include <mxf/mxf_mmap_file.h>
+
+
+#define DATA_SIZE   100000
+
+
+
+#define CHECK(cmd) \
+    if (!(cmd)) \
+    { \
+        fprintf(stderr, "'%s' failed in %s:%d\n", #cmd, __FILE__, __LINE__); \
+        exit(1); \
+    }
+
+
+
+static void usage(const char *cmd)
+{
+    fprintf(stderr, "Usage: %s filename\n", cmd);
+}
+
+int main(int argc, const char *argv[])
+{
+    MXFFile *mxfFile;
+    MXFFile *diskFile;
+    MXFMMapRegion *region1;
+    MXFMMapRegion *region2;
+    const uint8_t *regionData1;
+    const uint8_t *regionData2;
+    unsigned char *writeData;
+    unsigned char *readData;
+    uint32_t pageSize;
+    int i;
+
+    if (argc != 2)
+    {
+        usage(argv[0]);
+        return 1;
+    }
+
+    writeData = malloc(DATA_SIZE);
+    for (i = 0; i < DATA_SIZE; i++)
+        writeData[i] = (unsigned char)(i % 251);
+    readData = malloc(DATA_SIZE);
+
+    CHECK(mxf_disk_file_open_new(argv[1], &mxfFile));
+    CHECK(mxf_file_write(mxfFile, writeData, DATA_SIZE) == DATA_SIZE);
+    mxf_file_close(&mxfFile);
+
+
+    /* use a small window to test reads that cross window boundaries */
+    pageSize = mxf_get_system_page_size();
+    CHECK(mxf_mmap_file_open_read(argv[1], MXF_MMAP_FLAG_SEQUENTIAL_SCAN, pageSize * 2, &mxfFile));
+
+    CHECK(mxf_file_is_seekable(mxfFile));
+    CHECK(mxf_file_size(mxfFile) == DATA_SIZE);
+    CHECK(mxf_file_read(mxfFile, readData, DATA_SIZE) == DATA_SIZE);
+    CHECK(memcmp(readData, writeData, DATA_SIZE) == 0);
+    CHECK(!mxf_file_eof(mxfFile));
+    CHECK(mxf_file_read(mxfFile, readData, DATA_SIZE) == 0);
+    CHECK(mxf_file_eof(mxfFile));
+    CHECK(mxf_file_getc(mxfFile) == EOF);
+    CHECK(mxf_file_tell(mxfFile) == DATA_SIZE);
+
+    CHECK(mxf_file_seek(mxfFile, -DATA_SIZE / 2, SEEK_CUR));
+    CHECK(!mxf_file_eof(mxfFile));
+    CHECK(mxf_file_read(mxfFile, readData, DATA_SIZE) == DATA_SIZE / 2);
+    CHECK(memcmp(readData, &writeData[DATA_SIZE / 2], DATA_SIZE / 2) == 0);
+    CHECK(mxf_file_eof(mxfFile));
+
+    CHECK(mxf_file_seek(mxfFile, pageSize * 2 - 1, SEEK_SET));
+    CHECK(mxf_file_getc(mxfFile) == writeData[pageSize * 2 - 1]);
+    CHECK(mxf_file_getc(mxfFile) == writeData[pageSize * 2]);
+    CHECK(mxf_file_seek(mxfFile, 3, SEEK_SET));
+    CHECK(mxf_file_read(mxfFile, readData, pageSize * 3) == pageSize * 3);
+    CHECK(memcmp(readData, &writeData[3], pageSize * 3) == 0);
+    CHECK(mxf_file_tell(mxfFile) == pageSize * 3 + 3);
+
+    CHECK(mxf_file_seek(mxfFile, -10, SEEK_END));
+    CHECK(mxf_file_read(mxfFile, readData, 20) == 10);
+    CHECK(memcmp(readData, &writeData[DATA_SIZE - 10], 10) == 0);
+    CHECK(mxf_file_seek(mxfFile, DATA_SIZE * 2, SEEK_SET));
+    CHECK(mxf_file_tell(mxfFile) == DATA_SIZE * 2);
+    CHECK(mxf_file_getc(mxfFile) == EOF);
+    CHECK(!mxf_file_seek(mxfFile, -1, SEEK_SET));
+
+    CHECK(mxf_file_write(mxfFile, writeData, 1) == 0);
+    CHECK(mxf_file_putc(mxfFile, 1) == EOF);
+
+    /* zero-copy regions, including one that is larger than the window and crosses window boundaries */
+    CHECK(mxf_mmap_file_is_mmap_file(mxfFile));
+    CHECK(mxf_file_seek(mxfFile, 5, SEEK_SET));
+    CHECK(mxf_mmap_file_read_region(mxfFile, 100, &region1, &regionData1));
+    CHECK(memcmp(regionData1, &writeData[5], 100) == 0);
+    CHECK(mxf_file_tell(mxfFile) == 105);
+    CHECK(mxf_mmap_file_read_region(mxfFile, pageSize * 5, &region2, &regionData2));
+    CHECK(memcmp(regionData2, &writeData[105], pageSize * 5) == 0);
+    CHECK(mxf_file_getc(mxfFile) == writeData[105 + pageSize * 5]);
+    CHECK(mxf_file_seek(mxfFile, DATA_SIZE - 10, SEEK_SET));
+    CHECK(!mxf_mmap_file_read_region(mxfFile, 20, &region2, &regionData2));
+
+    mxf_file_close(&mxfFile);
+
+    /* region data remains valid after the file is closed */
+    CHECK(memcmp(regionData1, &writeData[5], 100) == 0);
+    CHECK(memcmp(regionData2, &writeData[105], pageSize * 5) == 0);
+    mxf_mmap_region_unref(&region1);
+    mxf_mmap_region_unref(&region2);
+    CHECK(region1 == NULL && region2 == NULL);
+
+    CHECK(mxf_disk_file_open_read(argv[1], &diskFile));
+    CHECK(!mxf_mmap_file_is_mmap_file(diskFile));
+    mxf_file_close(&diskFile);
+
+
+    free(writeData);
+    free(readData);
+
+    return 0;
+}
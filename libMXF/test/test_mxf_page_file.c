@@ -47,6 +47,7 @@
 #define DATA_SIZE   (PAGE_SIZE * 3 / 2)
 
 static const char *g_testFile = "pagetest___%d.mxf";
+static const char *g_stripeTestFiles[] = {"pagetest_s0___%d.mxf", "pagetest_s1___%d.mxf", "pagetest_s2___%d.mxf"};
 
 
 
@@ -74,6 +75,90 @@ static void remove_test_files()
     }
 }
 
+#if !defined(_WIN32)
+static void remove_stripe_test_files()
+{
+    char filename[4096];
+    int count = 0;
+
+    while (1)
+    {
+        mxf_snprintf(filename, sizeof(filename), g_stripeTestFiles[count % 3], count);
+        if (remove(filename) != 0)
+        {
+            break;
+        }
+        count++;
+    }
+}
+
+static void test_striped()
+{
+    MXFPageFile *mxfPageFile;
+    MXFFile *mxfFile;
+    uint8_t *data;
+    uint8_t *readData;
+    char filename[4096];
+    FILE *file;
+    int i;
+
+    data = malloc(DATA_SIZE * 10);
+    readData = malloc(DATA_SIZE * 10);
+    for (i = 0; i < DATA_SIZE * 10; i++)
+    {
+        data[i] = (uint8_t)(i % 251);
+    }
+
+    remove_stripe_test_files();
+
+    CHECK(mxf_page_file_open_new_striped(g_stripeTestFiles, 3, PAGE_SIZE, &mxfPageFile));
+    mxfFile = mxf_page_file_get_file(mxfPageFile);
+
+    for (i = 0; i < 10; i++)
+    {
+        CHECK(mxf_file_write(mxfFile, &data[i * DATA_SIZE], DATA_SIZE) == DATA_SIZE);
+    }
+    CHECK(mxf_file_size(mxfFile) == DATA_SIZE * 10);
+
+    /* read back whilst writing */
+    CHECK(mxf_file_seek(mxfFile, PAGE_SIZE / 2, SEEK_SET));
+    CHECK(mxf_file_read(mxfFile, readData, DATA_SIZE * 2) == DATA_SIZE * 2);
+    CHECK(memcmp(readData, &data[PAGE_SIZE / 2], DATA_SIZE * 2) == 0);
+
+    /* overwrite across a page boundary */
+    memset(&data[PAGE_SIZE - 10], 0xff, 20);
+    CHECK(mxf_file_seek(mxfFile, PAGE_SIZE - 10, SEEK_SET));
+    CHECK(mxf_file_write(mxfFile, &data[PAGE_SIZE - 10], 20) == 20);
+    CHECK(mxf_file_seek(mxfFile, 0, SEEK_SET));
+    CHECK(mxf_file_read(mxfFile, readData, PAGE_SIZE * 2) == PAGE_SIZE * 2);
+    CHECK(memcmp(readData, data, PAGE_SIZE * 2) == 0);
+
+    mxf_file_close(&mxfFile);
+
+    /* page 4 is in the second stripe */
+    mxf_snprintf(filename, sizeof(filename), g_stripeTestFiles[1], 4);
+    CHECK((file = fopen(filename, "rb")) != NULL);
+    fclose(file);
+    mxf_snprintf(filename, sizeof(filename), g_stripeTestFiles[0], 4);
+    CHECK((file = fopen(filename, "rb")) == NULL);
+
+    CHECK(mxf_page_file_open_read_striped(g_stripeTestFiles, 3, &mxfPageFile));
+    mxfFile = mxf_page_file_get_file(mxfPageFile);
+
+    CHECK(mxf_file_size(mxfFile) == DATA_SIZE * 10);
+    CHECK(mxf_file_read(mxfFile, readData, DATA_SIZE * 10) == DATA_SIZE * 10);
+    CHECK(memcmp(readData, data, DATA_SIZE * 10) == 0);
+    CHECK(mxf_file_eof(mxfFile));
+
+    mxf_file_close(&mxfFile);
+
+    remove_stripe_test_files();
+
+    free(data);
+    free(readData);
+}
+#endif
+
 int main()
 {
     MXFPageFile *mxfPageFile;
@@ -206,6 +291,11 @@ int main()
     CHECK(mxf_page_file_remove(g_testFile));
 
 
+#if !defined(_WIN32)
+    test_striped();
+#endif
+
+
     free(data);
 
     return 0;
@@ -0,0 +1,171 @@
+/*
+ * Copyright (C) 2017, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Author: Philip de Nier
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+#include <mxf/mxf.h>
+#include <mxf/mxf_readahead_file.h>
+
+
+#define DATA_SIZE       100000
+#define BUFFER_SIZE     1000
+#define NUM_BUFFERS     3
+#define GROW_SIZE       1500
+
+
+
+#define CHECK(cmd) \
+    if (!(cmd)) \
+    { \
+        fprintf(stderr, "'%s' failed in %s:%d\n", #cmd, __FILE__, __LINE__); \
+        exit(1); \
+    }
+
+
+
+static void append_data(const char *filename, const unsigned char *data, uint32_t size)
+{
+    MXFFile *mxfFile;
+
+    CHECK(mxf_disk_file_open_modify(filename, &mxfFile));
+    CHECK(mxf_file_seek(mxfFile, 0, SEEK_END));
+    CHECK(mxf_file_write(mxfFile, data, size) == size);
+    mxf_file_close(&mxfFile);
+}
+
+static void usage(const char *cmd)
+{
+    fprintf(stderr, "Usage: %s filename\n", cmd);
+}
+
+int main(int argc, const char *argv[])
+{
+    MXFFile *mxfFile;
+    MXFFile *diskFile;
+    unsigned char *writeData;
+    unsigned char *readData;
+    uint32_t offset;
+    int i;
+
+    if (argc != 2)
+    {
+        usage(argv[0]);
+        return 1;
+    }
+
+    writeData = malloc(DATA_SIZE);
+    for (i = 0; i < DATA_SIZE; i++)
+        writeData[i] = (unsigned char)(i % 251);
+    readData = malloc(DATA_SIZE);
+
+    CHECK(mxf_disk_file_open_new(argv[1], &mxfFile));
+    CHECK(mxf_file_write(mxfFile, writeData, DATA_SIZE) == DATA_SIZE);
+    mxf_file_close(&mxfFile);
+
+
+    CHECK(mxf_disk_file_open_read(argv[1], &diskFile));
+    CHECK(mxf_readahead_file_wrap(diskFile, BUFFER_SIZE, NUM_BUFFERS, &mxfFile));
+
+    CHECK(mxf_file_is_seekable(mxfFile));
+    CHECK(mxf_file_size(mxfFile) == DATA_SIZE);
+
+    /* sequential reads of varying size that cross buffer boundaries */
+    offset = 0;
+    for (i = 1; offset < DATA_SIZE; i = (i * 7) % 3001 + 1) {
+        uint32_t count = (uint32_t)i;
+        if (count > DATA_SIZE - offset)
+            count = DATA_SIZE - offset;
+        CHECK(mxf_file_read(mxfFile, &readData[offset], count) == count);
+        offset += count;
+    }
+    CHECK(memcmp(readData, writeData, DATA_SIZE) == 0);
+    CHECK(!mxf_file_eof(mxfFile));
+    CHECK(mxf_file_read(mxfFile, readData, 10) == 0);
+    CHECK(mxf_file_eof(mxfFile));
+    CHECK(mxf_file_getc(mxfFile) == EOF);
+    CHECK(mxf_file_tell(mxfFile) == DATA_SIZE);
+
+    /* seek back within the buffered window */
+    CHECK(mxf_file_seek(mxfFile, -100, SEEK_CUR));
+    CHECK(!mxf_file_eof(mxfFile));
+    CHECK(mxf_file_read(mxfFile, readData, 200) == 100);
+    CHECK(memcmp(readData, &writeData[DATA_SIZE - 100], 100) == 0);
+
+    /* seek outside the window */
+    CHECK(mxf_file_seek(mxfFile, 5, SEEK_SET));
+    CHECK(mxf_file_getc(mxfFile) == writeData[5]);
+    CHECK(mxf_file_read(mxfFile, readData, BUFFER_SIZE * 5) == BUFFER_SIZE * 5);
+    CHECK(memcmp(readData, &writeData[6], BUFFER_SIZE * 5) == 0);
+
+    /* skip forward within and beyond the read ahead range */
+    CHECK(mxf_file_seek(mxfFile, BUFFER_SIZE / 2, SEEK_CUR));
+    CHECK(mxf_file_getc(mxfFile) == writeData[6 + BUFFER_SIZE * 5 + BUFFER_SIZE / 2]);
+    CHECK(mxf_file_seek(mxfFile, 50000, SEEK_SET));
+    CHECK(mxf_file_read(mxfFile, readData, 100) == 100);
+    CHECK(memcmp(readData, &writeData[50000], 100) == 0);
+    CHECK(mxf_file_tell(mxfFile) == 50100);
+
+    CHECK(mxf_file_seek(mxfFile, -10, SEEK_END));
+    CHECK(mxf_file_read(mxfFile, readData, 20) == 10);
+    CHECK(memcmp(readData, &writeData[DATA_SIZE - 10], 10) == 0);
+    CHECK(mxf_file_eof(mxfFile));
+    CHECK(!mxf_file_seek(mxfFile, -1, SEEK_SET));
+
+    /* reading continues after the end of file has been reached when the file grows */
+    append_data(argv[1], writeData, GROW_SIZE);
+    CHECK(mxf_file_read(mxfFile, readData, GROW_SIZE) == GROW_SIZE);
+    CHECK(memcmp(readData, writeData, GROW_SIZE) == 0);
+    CHECK(mxf_file_read(mxfFile, readData, 10) == 0);
+    CHECK(mxf_file_eof(mxfFile));
+
+    append_data(argv[1], &writeData[GROW_SIZE], GROW_SIZE);
+    CHECK(mxf_file_seek(mxfFile, DATA_SIZE + GROW_SIZE, SEEK_SET));
+    CHECK(mxf_file_read(mxfFile, readData, GROW_SIZE + 10) == GROW_SIZE);
+    CHECK(memcmp(readData, &writeData[GROW_SIZE], GROW_SIZE) == 0);
+    CHECK(mxf_file_size(mxfFile) == DATA_SIZE + 2 * GROW_SIZE);
+
+    CHECK(mxf_file_write(mxfFile, writeData, 1) == 0);
+    CHECK(mxf_file_putc(mxfFile, 1) == EOF);
+
+    mxf_file_close(&mxfFile);
+
+
+    free(writeData);
+    free(readData);
+
+    return 0;
+}
@@ -0,0 +1,147 @@
+/*
+ * Copyright (C) 2017, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Author: Philip de Nier
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+#include <mxf/mxf.h>
+#include <mxf/mxf_writebehind_file.h>
+
+
+#define DATA_SIZE       100000
+#define BUFFER_SIZE     1000
+#define NUM_BUFFERS     3
+
+
+
+#define CHECK(cmd) \
+    if (!(cmd)) \
+    { \
+        fprintf(stderr, "'%s' failed in %s:%d\n", #cmd, __FILE__, __LINE__); \
+        exit(1); \
+    }
+
+
+
+static void usage(const char *cmd)
+{
+    fprintf(stderr, "Usage: %s filename\n", cmd);
+}
+
+int main(int argc, const char *argv[])
+{
+    MXFFile *mxfFile;
+    unsigned char *writeData;
+    unsigned char *readData;
+    unsigned char header[100];
+    uint32_t offset;
+    int i;
+
+    if (argc != 2)
+    {
+        usage(argv[0]);
+        return 1;
+    }
+
+    writeData = malloc(DATA_SIZE);
+    for (i = 0; i < DATA_SIZE; i++)
+        writeData[i] = (unsigned char)(i % 251);
+    readData = malloc(DATA_SIZE);
+    memset(header, 0xaa, sizeof(header));
+
+
+    CHECK(mxf_writebehind_file_open_new(argv[1], BUFFER_SIZE, NUM_BUFFERS, &mxfFile));
+    CHECK(mxf_writebehind_file_is_writebehind_file(mxfFile));
+    CHECK(mxf_file_is_seekable(mxfFile));
+
+    /* small and large writes that cross buffer boundaries */
+    offset = 0;
+    for (i = 1; offset < DATA_SIZE; i = (i * 7) % 3001 + 1) {
+        uint32_t count = (uint32_t)i;
+        if (count > DATA_SIZE - offset)
+            count = DATA_SIZE - offset;
+        if (count == 1) {
+            CHECK(mxf_file_putc(mxfFile, writeData[offset]) == writeData[offset]);
+        } else {
+            CHECK(mxf_file_write(mxfFile, &writeData[offset], count) == count);
+        }
+        offset += count;
+    }
+    CHECK(mxf_file_tell(mxfFile) == DATA_SIZE);
+    CHECK(mxf_file_size(mxfFile) == DATA_SIZE);
+
+    /* seek back and rewrite, both before and after the data has been written to disk */
+    CHECK(mxf_file_seek(mxfFile, -50, SEEK_END));
+    CHECK(mxf_file_write(mxfFile, header, 10) == 10);
+    memcpy(&writeData[DATA_SIZE - 50], header, 10);
+    CHECK(mxf_file_seek(mxfFile, 10, SEEK_SET));
+    CHECK(mxf_file_write(mxfFile, header, sizeof(header)) == sizeof(header));
+    memcpy(&writeData[10], header, sizeof(header));
+
+    /* reading waits for the pending writes */
+    CHECK(mxf_file_seek(mxfFile, 0, SEEK_SET));
+    CHECK(mxf_file_read(mxfFile, readData, DATA_SIZE) == DATA_SIZE);
+    CHECK(memcmp(readData, writeData, DATA_SIZE) == 0);
+    CHECK(!mxf_file_eof(mxfFile));
+    CHECK(mxf_file_getc(mxfFile) == EOF);
+    CHECK(mxf_file_eof(mxfFile));
+
+    /* extend the file after a gap */
+    CHECK(mxf_file_seek(mxfFile, 10, SEEK_END));
+    CHECK(mxf_file_write(mxfFile, header, 5) == 5);
+    CHECK(mxf_file_size(mxfFile) == DATA_SIZE + 15);
+
+    mxf_file_close(&mxfFile);
+
+
+    CHECK(mxf_disk_file_open_read(argv[1], &mxfFile));
+    CHECK(!mxf_writebehind_file_is_writebehind_file(mxfFile));
+    CHECK(mxf_writebehind_file_get_num_stalls(mxfFile) == 0);
+    CHECK(mxf_file_size(mxfFile) == DATA_SIZE + 15);
+    CHECK(mxf_file_read(mxfFile, readData, DATA_SIZE) == DATA_SIZE);
+    CHECK(memcmp(readData, writeData, DATA_SIZE) == 0);
+    CHECK(mxf_file_read(mxfFile, readData, 15) == 15);
+    for (i = 0; i < 10; i++)
+        CHECK(readData[i] == 0);
+    CHECK(memcmp(&readData[10], header, 5) == 0);
+    mxf_file_close(&mxfFile);
+
+
+    free(writeData);
+    free(readData);
+
+    return 0;
+}
@@ -163,6 +163,74 @@ fail:
 }
 
 
+int test_dynamic_tags(void)
+{
+    MXFPrimerPack *primer = NULL;
+    mxfKey key;
+    mxfKey itemKey;
+    mxfLocalTag tag;
+    mxfLocalTag prevTag;
+    uint32_t i;
+
+
+    /* TEST */
+
+    CHK_OFAIL(mxf_create_primer_pack(&primer));
+
+    /* use up the highest block of 32 dynamic tags and one tag in the next block */
+    key = someKey1;
+    for (i = 0; i < 32; i++)
+    {
+        key.octet15 = (uint8_t)(i + 1);
+        CHK_OFAIL(mxf_register_primer_entry(primer, (const mxfUID*)&key, (mxfLocalTag)(0xffff - i), &tag));
+    }
+    key.octet15 = 0;
+    key.octet14 = 1;
+    CHK_OFAIL(mxf_register_primer_entry(primer, (const mxfUID*)&key, 0xffdd, &tag));
+    CHK_OFAIL(!mxf_register_primer_entry(primer, (const mxfUID*)&someKey2, 0xffdd, &tag));
+
+    /* assign all remaining dynamic tags, skipping those in use */
+    key = someKey2;
+    prevTag = 0xffff;
+    for (i = 0; i < 0x8000 - 33; i++)
+    {
+        key.octet14 = (uint8_t)(i >> 8);
+        key.octet15 = (uint8_t)(i & 0xff);
+        CHK_OFAIL(mxf_register_primer_entry(primer, (const mxfUID*)&key, g_Null_LocalTag, &tag));
+        CHK_OFAIL(tag < prevTag && tag >= 0x8000 && tag != 0xffdd);
+        if (i == 0)
+        {
+            CHK_OFAIL(tag == 0xffdf);
+        }
+        prevTag = tag;
+
+        CHK_OFAIL(mxf_get_item_key(primer, tag, &itemKey));
+        CHK_OFAIL(mxf_equals_key(&itemKey, &key));
+    }
+    CHK_OFAIL(prevTag == 0x8000);
+
+    key.octet13 = 1;
+    CHK_OFAIL(!mxf_register_primer_entry(primer, (const mxfUID*)&key, g_Null_LocalTag, &tag));
+
+    /* look up earlier entries */
+    key = someKey2;
+    key.octet14 = 0x12;
+    key.octet15 = 0x34;
+    CHK_OFAIL(mxf_get_item_tag(primer, &key, &tag));
+    CHK_OFAIL(mxf_get_item_key(primer, tag, &itemKey));
+    CHK_OFAIL(mxf_equals_key(&itemKey, &key));
+    CHK_OFAIL(!mxf_get_item_key(primer, 0x0101, &itemKey));
+
+
+    mxf_free_primer_pack(&primer);
+    return 1;
+
+fail:
+    mxf_free_primer_pack(&primer);
+    return 0;
+}
+
+
 void usage(const char *cmd)
 {
     fprintf(stderr, "Usage: %s filename\n", cmd);
@@ -190,6 +258,11 @@ int main(int argc, const char *argv[])
         return 1;
     }
 
+    if (!test_dynamic_tags())
+    {
+        return 1;
+    }
+
     return 0;
 }
 